@@ -0,0 +1,86 @@
+/*
+ * Generates a polar decoder specialized (fully unrolled) for a given frozen bits set. This program is built and called
+ * by CMake for each entry of the AFF3CT_POLAR_GEN_SC and AFF3CT_POLAR_GEN_SCL options (see CMakeLists.txt).
+ *
+ * usage: generate_polar_decoder <SC|SCL> <N> <K> <SNR|FILE> <source> <class_name> <fb_name> <output_file>
+ *   - SNR:  the frozen bits are computed with the Gaussian Approximation at <source> dB (Eb/N0, BPSK),
+ *   - FILE: the frozen bits are read from the <source> best channels file.
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <exception>
+
+#include "Tools/general_utils.h"
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_GA.hpp"
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_file.hpp"
+#include "Tools/Code/Polar/Generator/Generator_polar_SC_sys.hpp"
+#include "Tools/Code/Polar/Generator/Generator_polar_SCL_sys.hpp"
+
+using namespace aff3ct;
+
+int main(int argc, char **argv)
+{
+	if (argc != 9)
+	{
+		std::cerr << "usage: " << argv[0] << " <SC|SCL> <N> <K> <SNR|FILE> <source> <class_name> <fb_name> "
+		          << "<output_file>" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	const std::string type       = argv[1];
+	const int         N          = std::stoi(argv[2]);
+	const int         K          = std::stoi(argv[3]);
+	const std::string fb_type    = argv[4];
+	const std::string fb_source  = argv[5];
+	const std::string class_name = argv[6];
+	const std::string fb_name    = argv[7];
+	const std::string out_file   = argv[8];
+
+	try
+	{
+		std::unique_ptr<tools::Frozenbits_generator> fb_generator;
+		if (fb_type == "SNR")
+		{
+			const auto ebn0  = std::stof(fb_source);
+			const auto esn0  = tools::ebn0_to_esn0(ebn0, (float)K / (float)N);
+			const auto sigma = tools::esn0_to_sigma(esn0);
+			fb_generator.reset(new tools::Frozenbits_generator_GA(K, N, sigma));
+		}
+		else if (fb_type == "FILE")
+			fb_generator.reset(new tools::Frozenbits_generator_file(K, N, fb_source));
+		else
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Unknown frozen bits source type ('fb_type' = "
+			                                                            + fb_type + ").");
+
+		std::vector<bool> frozen_bits(N);
+		fb_generator->generate(frozen_bits);
+
+		std::unique_ptr<tools::Generator_polar> generator;
+		if (type == "SC")
+			generator.reset(new tools::Generator_polar_SC_sys (K, N, frozen_bits, class_name, fb_name));
+		else if (type == "SCL")
+			generator.reset(new tools::Generator_polar_SCL_sys(K, N, frozen_bits, class_name, fb_name));
+		else
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Unknown decoder type ('type' = "
+			                                                            + type + ").");
+
+		std::ofstream stream(out_file);
+		if (!stream.is_open())
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, "'" + out_file + "' can't be opened.");
+
+		generator->generate(stream);
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << e.what() << std::endl;
+		std::remove(out_file.c_str());
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
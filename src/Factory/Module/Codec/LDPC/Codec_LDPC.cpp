@@ -79,17 +79,25 @@ void Codec_LDPC::parameters
 	enc->store(vals);
 	dec->store(vals);
 
-	if (enc->type == "LDPC_DVBS2" || enc->type == "LDPC")
-		dec->N_cw = enc->N_cw; // then the encoder knows the N_cw
-	else
-		enc->N_cw = dec->N_cw; // then the decoder knows the N_cw
-
-	if (enc->K != 0)
-		dec->K = enc->K; // then the encoder knows the K
+	if (dec_ldpc->set_nr_dimensions(enc->K) != 0)
+	{	// 5G NR base graph: the lifting size gives both K and N_cw
+		enc->K    = dec->K;
+		enc->N_cw = dec->N_cw;
+	}
 	else
-		enc->K = dec->K; // then the decoder knows the K
+	{
+		if (enc->type == "LDPC_DVBS2" || enc->type == "LDPC")
+			dec->N_cw = enc->N_cw; // then the encoder knows the N_cw
+		else
+			enc->N_cw = dec->N_cw; // then the decoder knows the N_cw
+
+		if (enc->K != 0)
+			dec->K = enc->K; // then the encoder knows the K
+		else
+			enc->K = dec->K; // then the decoder knows the K
+	}
 
-	if (enc->type == "LDPC_H")
+	if (enc->type == "LDPC_H" || enc->type == "LDPC_RU")
 		enc_ldpc->H_path = dec_ldpc->H_path;
 
 	// if (dec->K == 0 || dec->N_cw == 0 || enc->K == 0 || enc->N_cw == 0)
@@ -1,9 +1,13 @@
+#include <sstream>
+#include <algorithm>
+
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Documentation/documentation.h"
 #include "Tools/Arguments/Splitter/Splitter.hpp"
 #include "Tools/Math/max.h"
 
 #include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
+#include "Tools/Code/LDPC/Standard/NR/NR_base_graph.hpp"
 
 #include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding.hpp"
 #include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered.hpp"
@@ -11,6 +15,7 @@
 
 #include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
 #include "Tools/Code/LDPC/Update_rule/LSPA/Update_rule_LSPA.hpp"
+#include "Tools/Code/LDPC/Update_rule/LSPA/Update_rule_LSPA_phi.hpp"
 #include "Tools/Code/LDPC/Update_rule/MS/Update_rule_MS.hpp"
 #include "Tools/Code/LDPC/Update_rule/OMS/Update_rule_OMS.hpp"
 #include "Tools/Code/LDPC/Update_rule/NMS/Update_rule_NMS.hpp"
@@ -22,6 +27,7 @@
 #include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_inter.hpp"
 #include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA_simd.hpp"
 #include "Tools/Code/LDPC/Update_rule/LSPA/Update_rule_LSPA_simd.hpp"
+#include "Tools/Code/LDPC/Update_rule/LSPA/Update_rule_LSPA_phi_simd.hpp"
 #include "Tools/Code/LDPC/Update_rule/MS/Update_rule_MS_simd.hpp"
 #include "Tools/Code/LDPC/Update_rule/OMS/Update_rule_OMS_simd.hpp"
 #include "Tools/Code/LDPC/Update_rule/NMS/Update_rule_NMS_simd.hpp"
@@ -29,13 +35,20 @@
 #endif
 
 #include "Module/Decoder/LDPC/BP/Horizontal_layered/ONMS/Decoder_LDPC_BP_horizontal_layered_ONMS_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/ONMS/Decoder_LDPC_BP_horizontal_layered_ONMS_intra.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_B.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_E.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_B_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_E_inter.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/SPA/Decoder_LDPC_BP_flooding_SPA.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/LSPA/Decoder_LDPC_BP_flooding_LSPA.hpp"
 #include "Module/Decoder/LDPC/BP/Peeling/Decoder_LDPC_BP_peeling.hpp"
+#include "Module/Decoder/LDPC/BP/Peeling/Decoder_LDPC_BP_peeling_inter.hpp"
 #include "Module/Decoder/LDPC/BF/OMWBF/Decoder_LDPC_bit_flipping_OMWBF.hpp"
 #include "Module/Decoder/LDPC/BF/PPBF/Decoder_LDPC_probabilistic_parallel_bit_flipping.hpp"
+#include "Module/Decoder/LDPC/BF/PPBF/Decoder_LDPC_probabilistic_parallel_bit_flipping_inter.hpp"
 
 #include "Decoder_LDPC.hpp"
 
@@ -59,6 +72,24 @@ Decoder_LDPC::parameters* Decoder_LDPC::parameters
 	return new Decoder_LDPC::parameters(*this);
 }
 
+// only the BP flooding and horizontal layered decoders (with the generic update rules) split a frame between threads
+static void check_n_threads(const Decoder_LDPC::parameters &params)
+{
+	const std::vector<std::string> implems = {"SPA", "LSPA", "MS", "OMS", "NMS", "AMS"};
+
+	if (params.n_threads > 1 &&
+	    (!(params.type == "BP_FLOODING" || params.type == "BP_HORIZONTAL_LAYERED") || !params.simd_strategy.empty() ||
+	     std::find(implems.begin(), implems.end(), params.implem) == implems.end()))
+	{
+		std::stringstream message;
+		message << "The intra-frame multi-threading is only available for the 'BP_FLOODING' and "
+		        << "'BP_HORIZONTAL_LAYERED' decoders without SIMD strategy ('n_threads' = " << params.n_threads
+		        << ", 'type' = " << params.type << ", 'implem' = " << params.implem
+		        << ", 'simd_strategy' = " << params.simd_strategy << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
 struct Real_splitter
 {
 	static std::vector<std::string> split(const std::string& val)
@@ -86,6 +117,7 @@ void Decoder_LDPC::parameters
 	args.add_link({p+"-h-path"}, {p+"-cw-size",   "N"}); // N_cw is H width
 	args.add_link({p+"-h-path"}, {p+"-info-bits", "K"}); // if there is no K, then H is considered regular,
 	                                                     // so K is the N - H's height
+	args.add_link({p+"-h-path"}, {p+"-base-graph"     }); // H is built from the base graph of the 5G NR standard
 
 	tools::add_options(args.at({p+"-type", "D"}), 0, "BP_FLOODING", "BP_HORIZONTAL_LAYERED", "BP_VERTICAL_LAYERED", "BP_PEELING", "BIT_FLIPPING");
 #ifdef __cpp_aligned_new
@@ -117,11 +149,26 @@ void Decoder_LDPC::parameters
 	tools::add_arg(args, p, class_name+"p+min",
 		tools::Text(tools::Including_set("MIN", "MINL", "MINS")));
 
+	tools::add_arg(args, p, class_name+"p+phi",
+		tools::Text(tools::Including_set("EXACT", "LUT", "PWL")));
+
+	tools::add_arg(args, p, class_name+"p+h-save-path",
+		tools::File(tools::openmode::write));
+
 	tools::add_arg(args, p, class_name+"p+h-reorder",
 		tools::Text(tools::Including_set("NONE", "ASC", "DSC")));
 
 	tools::add_arg(args, p, class_name+"p+ppbf-proba",
 		tools::List<float,Real_splitter>(tools::Real(), tools::Length(1)));
+
+	tools::add_arg(args, p, class_name+"p+threads",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+
+	tools::add_arg(args, p, class_name+"p+base-graph",
+		tools::Integer(tools::Including_set(1, 2)));
+
+	tools::add_arg(args, p, class_name+"p+lifting",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
 }
 
 void Decoder_LDPC::parameters
@@ -130,18 +177,25 @@ void Decoder_LDPC::parameters
 	auto p = this->get_prefix();
 
 	if(vals.exist({p+"-h-path"    })) this->H_path          = vals.to_file ({p+"-h-path"    });
+	if(vals.exist({p+"-h-save-path"})) this->H_save_path    = vals.to_file ({p+"-h-save-path"});
 	if(vals.exist({p+"-h-reorder" })) this->H_reorder       = vals.at      ({p+"-h-reorder" });
 	if(vals.exist({p+"-simd"      })) this->simd_strategy   = vals.at      ({p+"-simd"      });
 	if(vals.exist({p+"-min"       })) this->min             = vals.at      ({p+"-min"       });
+	if(vals.exist({p+"-phi"       })) this->phi             = vals.at      ({p+"-phi"       });
 	if(vals.exist({p+"-ite",   "i"})) this->n_ite           = vals.to_int  ({p+"-ite",   "i"});
 	if(vals.exist({p+"-synd-depth"})) this->syndrome_depth  = vals.to_int  ({p+"-synd-depth"});
 	if(vals.exist({p+"-off"       })) this->offset          = vals.to_float({p+"-off"       });
 	if(vals.exist({p+"-mwbf"      })) this->mwbf_factor     = vals.to_float({p+"-mwbf"      });
 	if(vals.exist({p+"-norm"      })) this->norm_factor     = vals.to_float({p+"-norm"      });
 	if(vals.exist({p+"-ppbf-proba"})) this->ppbf_proba      = vals.to_list<float>({p+"-ppbf-proba"});
+	if(vals.exist({p+"-threads"   })) this->n_threads       = vals.to_int  ({p+"-threads"   });
+	if(vals.exist({p+"-base-graph"})) this->base_graph      = vals.to_int  ({p+"-base-graph"});
+	if(vals.exist({p+"-lifting"   })) this->lifting         = vals.to_int  ({p+"-lifting"   });
 	if(vals.exist({p+"-no-synd"   })) this->enable_syndrome = false;
 
-	if (!this->H_path.empty())
+	const auto is_nr = this->is_nr();
+
+	if (!this->H_path.empty() && !is_nr)
 	{
 		int M;
 		tools::LDPC_matrix_handler::read_matrix_size(this->H_path, M, this->N_cw);
@@ -150,9 +204,61 @@ void Decoder_LDPC::parameters
 			std::swap(M, this->N_cw);
 
 		this->K = this->N_cw - M; // considered as regular so M = N - K
+
+		// converted here, once, and not in each of the codecs (built by every thread)
+		if (!this->H_save_path.empty())
+			tools::LDPC_matrix_handler::convert_to_bin(this->H_path, this->H_save_path);
 	}
 
 	Decoder::parameters::store(vals);
+
+	if (is_nr)
+		this->set_nr_dimensions(this->K);
+}
+
+bool Decoder_LDPC::parameters
+::is_nr() const
+{
+	return this->base_graph != 0 ||
+	       (!this->H_path.empty() &&
+	        tools::LDPC_matrix_handler::get_matrix_format(this->H_path) == tools::LDPC_matrix_handler::Matrix_format::NR);
+}
+
+bool Decoder_LDPC::parameters
+::is_circulant() const
+{
+	return this->is_nr() && this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy == "INTRA" &&
+	       (this->implem == "MS" || this->implem == "NMS" || this->implem == "OMS");
+}
+
+tools::NR_base_graph Decoder_LDPC::parameters
+::build_nr_base_graph() const
+{
+	if (this->base_graph != 0)
+		return tools::NR_base_graph(this->base_graph);
+	else
+		return tools::NR_base_graph(this->H_path);
+}
+
+int Decoder_LDPC::parameters
+::set_nr_dimensions(const int K_min)
+{
+	if (!this->is_nr())
+		return 0;
+
+	const auto bg = this->build_nr_base_graph();
+
+	int Z = this->lifting;
+	if (Z == 0)
+		Z = K_min > 0 ? bg.select_lifting_size(K_min) : 384;
+	tools::NR_base_graph::get_set_index(Z); // throw if Z is not a lifting size of the standard
+
+	// no filler bits: K is the size of the information block columns
+	this->K    = (int)bg.get_n_info_cols() * Z;
+	this->N_cw = (int)bg.get_n_cols     () * Z;
+	this->R    = (float)this->K / (float)this->N_cw;
+
+	return Z;
 }
 
 void Decoder_LDPC::parameters
@@ -164,12 +270,23 @@ void Decoder_LDPC::parameters
 	{
 		auto p = this->get_prefix();
 
-		if (!this->H_path.empty())
+		if (this->base_graph != 0)
+		{
+			headers[p].push_back(std::make_pair("Base graph (5G NR)", "BG" + std::to_string(this->base_graph)));
+			headers[p].push_back(std::make_pair("H matrix reordering", this->H_reorder));
+		}
+		else if (!this->H_path.empty())
 		{
 			headers[p].push_back(std::make_pair("H matrix path", this->H_path));
 			headers[p].push_back(std::make_pair("H matrix reordering", this->H_reorder));
+
+			if (!this->H_save_path.empty())
+				headers[p].push_back(std::make_pair("H matrix save path (BIN)", this->H_save_path));
 		}
 
+		if (this->lifting)
+			headers[p].push_back(std::make_pair("Lifting size (Z)", std::to_string(this->lifting)));
+
 		if (!this->simd_strategy.empty())
 			headers[p].push_back(std::make_pair("SIMD strategy", this->simd_strategy));
 
@@ -190,6 +307,12 @@ void Decoder_LDPC::parameters
 		if (this->implem == "AMS")
 			headers[p].push_back(std::make_pair("Min type", this->min));
 
+		if (this->implem == "LSPA" && this->type == "BP_FLOODING")
+			headers[p].push_back(std::make_pair("Phi function", this->phi));
+
+		if (this->n_threads > 1)
+			headers[p].push_back(std::make_pair("Num. of threads per frame", std::to_string(this->n_threads)));
+
 		if (this->implem == "PPBF")
 		{
 			std::stringstream bern_str;
@@ -208,36 +331,43 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 ::build_siso(const tools::Sparse_matrix &H, const std::vector<unsigned> &info_bits_pos,
              const std::unique_ptr<module::Encoder<B>>& encoder) const
 {
+	check_n_threads(*this);
+
 	if (this->type == "BP_FLOODING" && this->simd_strategy.empty())
 	{
 		const auto max_CN_degree = H.get_cols_max_degree();
 
-		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-		if (this->implem == "LSPA")  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_LSPA<Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA<Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+		if (this->implem == "LSPA")
+		{
+			if (this->phi == "EXACT") return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_LSPA    <Q                  >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA    <Q                  >(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+			if (this->phi == "LUT"  ) return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_LSPA_phi<Q,tools::phi_lut<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA_phi<Q,tools::phi_lut<Q>>(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+			if (this->phi == "PWL"  ) return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_LSPA_phi<Q,tools::phi_pwl<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA_phi<Q,tools::phi_pwl<Q>>(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+		}
 		if (this->implem == "AMS" )
 		{
-			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_AMS <Q,tools::min             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min             <Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-			if (this->min == "MINL") return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-			if (this->min == "MINS") return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_AMS <Q,tools::min_star        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star        <Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_AMS <Q,tools::min             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min             <Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+			if (this->min == "MINL") return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+			if (this->min == "MINS") return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_AMS <Q,tools::min_star        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star        <Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
 		}
 	}
 	else if (this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy.empty())
 	{
 		const auto max_CN_degree = H.get_cols_max_degree();
 
-		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-		if (this->implem == "LSPA")  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_LSPA<Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA<Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+		if (this->implem == "LSPA")  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_LSPA<Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA<Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
 		if (this->implem == "AMS" )
 		{
-			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_AMS <Q,tools::min             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min             <Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-			if (this->min == "MINL") return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-			if (this->min == "MINS") return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_AMS <Q,tools::min_star        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star        <Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_AMS <Q,tools::min             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min             <Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+			if (this->min == "MINL") return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
+			if (this->min == "MINS") return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_AMS <Q,tools::min_star        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star        <Q>>(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames, this->n_threads);
 		}
 	}
 	else if (this->type == "BP_VERTICAL_LAYERED" && this->simd_strategy.empty())
@@ -290,7 +420,7 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 		else if (this->implem == "AMS" )
 		{
 			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_horizontal_layered_inter<B,Q,tools::Update_rule_AMS_simd<Q,tools::min_i             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS_simd<Q,tools::min_i             <Q>>(), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-			if (this->min == "MINL") return new module::Decoder_LDPC_BP_horizontal_layered_inter<B,Q,tools::Update_rule_AMS_simd<Q,tools::min_star_linear2_i<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS_simd<Q,tools::min_star_linear2_i<Q>>(), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINL") return new module::Decoder_LDPC_BP_horizontal_layered_inter<B,Q,tools::Update_rule_AMS_simd<Q,tools::min_star_linear2_i<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS_simd<Q,tools::min_star_linear2_i<Q>>(this->n_decimals), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 			if (this->min == "MINS") return new module::Decoder_LDPC_BP_horizontal_layered_inter<B,Q,tools::Update_rule_AMS_simd<Q,tools::min_star_i        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS_simd<Q,tools::min_star_i        <Q>>(), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		}
 	}
@@ -311,7 +441,12 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 		const auto max_CN_degree = H.get_cols_max_degree();
 
 		if (this->implem == "SPA" ) return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_SPA_simd <Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA_simd <Q>(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-		if (this->implem == "LSPA") return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_LSPA_simd<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA_simd<Q>(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "LSPA")
+		{
+			if (this->phi == "EXACT") return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_LSPA_simd    <Q                    >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA_simd    <Q                    >(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->phi == "LUT"  ) return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_LSPA_phi_simd<Q,tools::phi_lut_i<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA_phi_simd<Q,tools::phi_lut_i<Q>>(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->phi == "PWL"  ) return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_LSPA_phi_simd<Q,tools::phi_pwl_i<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA_phi_simd<Q,tools::phi_pwl_i<Q>>(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
 		if (this->implem == "MS"  ) return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_MS_simd  <Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS_simd  <Q>(             ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "OMS" ) return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_OMS_simd <Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS_simd <Q>(this->offset ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "NMS" )
@@ -335,7 +470,7 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 		else if (this->implem == "AMS" )
 		{
 			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_AMS_simd<Q,tools::min_i             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS_simd<Q,tools::min_i             <Q>>(), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-			if (this->min == "MINL") return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_AMS_simd<Q,tools::min_star_linear2_i<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS_simd<Q,tools::min_star_linear2_i<Q>>(), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINL") return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_AMS_simd<Q,tools::min_star_linear2_i<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS_simd<Q,tools::min_star_linear2_i<Q>>(this->n_decimals), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 			if (this->min == "MINS") return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_AMS_simd<Q,tools::min_star_i        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS_simd<Q,tools::min_star_i        <Q>>(), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		}
 	}
@@ -370,7 +505,7 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 		else if (this->implem == "AMS" )
 		{
 			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_vertical_layered_inter<B,Q,tools::Update_rule_AMS_simd<Q,tools::min_i             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS_simd<Q,tools::min_i             <Q>>(), this->enable_syndrome, this->syndrome_depth, this->n_frames);
-			if (this->min == "MINL") return new module::Decoder_LDPC_BP_vertical_layered_inter<B,Q,tools::Update_rule_AMS_simd<Q,tools::min_star_linear2_i<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS_simd<Q,tools::min_star_linear2_i<Q>>(), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINL") return new module::Decoder_LDPC_BP_vertical_layered_inter<B,Q,tools::Update_rule_AMS_simd<Q,tools::min_star_linear2_i<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS_simd<Q,tools::min_star_linear2_i<Q>>(this->n_decimals), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 			if (this->min == "MINS") return new module::Decoder_LDPC_BP_vertical_layered_inter<B,Q,tools::Update_rule_AMS_simd<Q,tools::min_star_i        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS_simd<Q,tools::min_star_i        <Q>>(), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		}
 	}
@@ -378,6 +513,37 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 	else if (this->type == "BP_FLOODING" && this->simd_strategy == "INTRA")
 	{
 		if (this->implem == "SPA" ) return new module::Decoder_LDPC_BP_flooding_SPA<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "LSPA")
+		{
+			if (this->phi == "EXACT") return new module::Decoder_LDPC_BP_flooding_LSPA<B,Q,tools::phi    <Q>,tools::phi_i    <Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->phi == "LUT"  ) return new module::Decoder_LDPC_BP_flooding_LSPA<B,Q,tools::phi_lut<Q>,tools::phi_lut_i<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->phi == "PWL"  ) return new module::Decoder_LDPC_BP_flooding_LSPA<B,Q,tools::phi_pwl<Q>,tools::phi_pwl_i<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
+	}
+	else if (this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy == "INTRA" &&
+	         (this->implem == "MS" || this->implem == "NMS" || this->implem == "OMS"))
+	{
+		// the SIMD lanes process the Z check nodes of a layer of the QC matrix
+		const auto Z = tools::LDPC_matrix_handler::read_lifting_size(this->H_path);
+
+		if (this->implem == "MS" ) return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,Q>(this->K, this->N_cw, this->n_ite, H, Z, info_bits_pos, 1.f              , (Q)0           , this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "NMS") return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,Q>(this->K, this->N_cw, this->n_ite, H, Z, info_bits_pos, this->norm_factor, (Q)0           , this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "OMS") return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,Q>(this->K, this->N_cw, this->n_ite, H, Z, info_bits_pos, 1.f              , (Q)this->offset, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+	}
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
+template <typename B, typename Q>
+module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
+::build_siso(const std::vector<std::vector<int>> &base, const int Z, const std::vector<unsigned> &info_bits_pos,
+             const std::unique_ptr<module::Encoder<B>>& encoder) const
+{
+	if (this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy == "INTRA")
+	{
+		if (this->implem == "MS" ) return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,Q>(this->K, this->N_cw, this->n_ite, base, Z, info_bits_pos, 1.f              , (Q)0           , this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "NMS") return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,Q>(this->K, this->N_cw, this->n_ite, base, Z, info_bits_pos, this->norm_factor, (Q)0           , this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "OMS") return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,Q>(this->K, this->N_cw, this->n_ite, base, Z, info_bits_pos, 1.f              , (Q)this->offset, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
@@ -388,6 +554,8 @@ module::Decoder_SIHO<B,Q>* Decoder_LDPC::parameters
 ::build(const tools::Sparse_matrix &H, const std::vector<unsigned> &info_bits_pos,
         const std::unique_ptr<module::Encoder<B>>& encoder) const
 {
+	check_n_threads(*this);
+
 	try
 	{
 		return Decoder::parameters::build<B,Q>(encoder);
@@ -400,14 +568,28 @@ module::Decoder_SIHO<B,Q>* Decoder_LDPC::parameters
 			if (this->implem == "GALB") return new module::Decoder_LDPC_BP_flooding_GALB<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 			if (this->implem == "GALE") return new module::Decoder_LDPC_BP_flooding_GALE<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		}
-		else if (this->type == "BP_PEELING")
+		else if ((this->type == "BP" || this->type == "BP_FLOODING") && this->simd_strategy == "INTER")
+		{
+			if (this->implem == "GALA") return new module::Decoder_LDPC_BP_flooding_GALA_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->implem == "GALB") return new module::Decoder_LDPC_BP_flooding_GALB_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->implem == "GALE") return new module::Decoder_LDPC_BP_flooding_GALE_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
+		else if (this->type == "BP_PEELING" && this->simd_strategy.empty())
 		{
 			if (this->implem == "STD") return new module::Decoder_LDPC_BP_peeling<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		}
-		else if (this->type == "BIT_FLIPPING")
+		else if (this->type == "BP_PEELING" && this->simd_strategy == "INTER")
+		{
+			if (this->implem == "STD") return new module::Decoder_LDPC_BP_peeling_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
+		else if (this->type == "BIT_FLIPPING" && this->simd_strategy.empty())
 		{
 		    if (this->implem == "PPBF") return new module::Decoder_LDPC_PPBF<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->ppbf_proba,  this->enable_syndrome, this->syndrome_depth, this->seed, this->n_frames);
 		}
+		else if (this->type == "BIT_FLIPPING" && this->simd_strategy == "INTER")
+		{
+		    if (this->implem == "PPBF") return new module::Decoder_LDPC_PPBF_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->ppbf_proba,  this->enable_syndrome, this->syndrome_depth, this->seed, this->n_frames);
+		}
 		return build_siso<B,Q>(H, info_bits_pos);
 	}
 }
@@ -420,6 +602,14 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC
 	return params.template build_siso<B,Q>(H, info_bits_pos, encoder);
 }
 
+template <typename B, typename Q>
+module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC
+::build_siso(const parameters& params, const std::vector<std::vector<int>> &base, const int Z,
+             const std::vector<unsigned> &info_bits_pos, const std::unique_ptr<module::Encoder<B>>& encoder)
+{
+	return params.template build_siso<B,Q>(base, Z, info_bits_pos, encoder);
+}
+
 template <typename B, typename Q>
 module::Decoder_SIHO<B,Q>* Decoder_LDPC
 ::build(const parameters& params, const tools::Sparse_matrix &H, const std::vector<unsigned> &info_bits_pos,
@@ -439,9 +629,19 @@ template aff3ct::module::Decoder_SISO_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_
 template aff3ct::module::Decoder_SISO_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_LDPC::build_siso<B_16,Q_16>(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_16>>&);
 template aff3ct::module::Decoder_SISO_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_LDPC::build_siso<B_32,Q_32>(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_32>>&);
 template aff3ct::module::Decoder_SISO_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_LDPC::build_siso<B_64,Q_64>(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_64>>&);
+template aff3ct::module::Decoder_SISO_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B_8 ,Q_8 >(const std::vector<std::vector<int>>&, const int, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_8 >>&) const;
+template aff3ct::module::Decoder_SISO_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B_16,Q_16>(const std::vector<std::vector<int>>&, const int, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_16>>&) const;
+template aff3ct::module::Decoder_SISO_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B_32,Q_32>(const std::vector<std::vector<int>>&, const int, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_32>>&) const;
+template aff3ct::module::Decoder_SISO_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B_64,Q_64>(const std::vector<std::vector<int>>&, const int, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_64>>&) const;
+template aff3ct::module::Decoder_SISO_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_LDPC::build_siso<B_8 ,Q_8 >(const aff3ct::factory::Decoder_LDPC::parameters&, const std::vector<std::vector<int>>&, const int, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_8 >>&);
+template aff3ct::module::Decoder_SISO_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_LDPC::build_siso<B_16,Q_16>(const aff3ct::factory::Decoder_LDPC::parameters&, const std::vector<std::vector<int>>&, const int, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_16>>&);
+template aff3ct::module::Decoder_SISO_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_LDPC::build_siso<B_32,Q_32>(const aff3ct::factory::Decoder_LDPC::parameters&, const std::vector<std::vector<int>>&, const int, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_32>>&);
+template aff3ct::module::Decoder_SISO_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_LDPC::build_siso<B_64,Q_64>(const aff3ct::factory::Decoder_LDPC::parameters&, const std::vector<std::vector<int>>&, const int, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_64>>&);
 #else
 template aff3ct::module::Decoder_SISO_SIHO<B,Q>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B,Q>(const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B>>& ) const;
 template aff3ct::module::Decoder_SISO_SIHO<B,Q>* aff3ct::factory::Decoder_LDPC::build_siso<B,Q>(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B>>& );
+template aff3ct::module::Decoder_SISO_SIHO<B,Q>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B,Q>(const std::vector<std::vector<int>>&, const int, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B>>& ) const;
+template aff3ct::module::Decoder_SISO_SIHO<B,Q>* aff3ct::factory::Decoder_LDPC::build_siso<B,Q>(const aff3ct::factory::Decoder_LDPC::parameters&, const std::vector<std::vector<int>>&, const int, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B>>& );
 #endif
 
 #include "Tools/types.h"
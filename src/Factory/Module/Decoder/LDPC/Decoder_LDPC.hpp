@@ -5,6 +5,7 @@
 #include <string>
 
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/Standard/NR/NR_base_graph.hpp"
 
 #include "Module/Decoder/Decoder_SIHO.hpp"
 #include "Module/Decoder/Decoder_SISO_SIHO.hpp"
@@ -28,8 +29,10 @@ struct Decoder_LDPC : public Decoder
 		std::string H_path;
 
 		// optional parameters
+		std::string H_save_path;
 		std::string H_reorder       = "NONE";
 		std::string min             = "MINL";
+		std::string phi             = "EXACT";
 		std::string simd_strategy   = "";
 		float       norm_factor     = 1.f;
 		float       offset          = 0.f;
@@ -37,6 +40,10 @@ struct Decoder_LDPC : public Decoder
 		bool        enable_syndrome = true;
 		int         syndrome_depth  = 1;
 		int         n_ite           = 10;
+		int         n_threads       = 1;
+		int         n_decimals      = 2; // number of fractional bits of the fixed-point LLRs (given by the quantizer)
+		int         base_graph      = 0; // 5G NR base graph of the standard (1 or 2), 0 to read H from 'H_path'
+		int         lifting         = 0; // for a 5G NR base graph, 0 to select it from K
 
 		std::vector<float> ppbf_proba;
 
@@ -50,6 +57,26 @@ struct Decoder_LDPC : public Decoder
 		void store          (const tools::Argument_map_value &vals);
 		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
 
+		/*
+		 * true if the code is a 5G NR one: a base graph of the standard ('base_graph') or a base graph file ('H_path')
+		 */
+		bool is_nr() const;
+
+		/*
+		 * true if the decoder walks the circulants of the 5G NR base graph (horizontal layered MS, NMS or OMS with the
+		 * INTRA SIMD strategy), the other decoders need the expanded H matrix
+		 */
+		bool is_circulant() const;
+
+		/*
+		 * if the code is a 5G NR one: set 'K' and 'N_cw' from the lifting size ('lifting' or the smallest one that fits
+		 * 'K_min' information bits, the largest one if 'K_min' is 0) and return it, else return 0
+		 */
+		int set_nr_dimensions(const int K_min = 0);
+
+		// the 5G NR base graph, 'base_graph' takes precedence over 'H_path'
+		tools::NR_base_graph build_nr_base_graph() const;
+
 		// builder
 		template <typename B = int, typename Q = float>
 		module::Decoder_SIHO<B,Q>* build(const tools::Sparse_matrix &H,
@@ -60,6 +87,13 @@ struct Decoder_LDPC : public Decoder
 		module::Decoder_SISO_SIHO<B,Q>* build_siso(const tools::Sparse_matrix &H,
 		                                           const std::vector<unsigned> &info_bits_pos,
 		                                           const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
+
+		// decoders that walk the circulants of a QC base matrix of lifting size Z, without its expanded H
+		template <typename B = int, typename Q = float>
+		module::Decoder_SISO_SIHO<B,Q>* build_siso(const std::vector<std::vector<int>> &base,
+		                                           const int Z,
+		                                           const std::vector<unsigned> &info_bits_pos,
+		                                           const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
 	};
 
 	template <typename B = int, typename Q = float>
@@ -72,6 +106,13 @@ struct Decoder_LDPC : public Decoder
 	                                                  const tools::Sparse_matrix &H,
 	                                                  const std::vector<unsigned> &info_bits_pos,
 	                                                  const std::unique_ptr<module::Encoder<B>>& encoder = nullptr);
+
+	template <typename B = int, typename Q = float>
+	static module::Decoder_SISO_SIHO<B,Q>* build_siso(const parameters& params,
+	                                                  const std::vector<std::vector<int>> &base,
+	                                                  const int Z,
+	                                                  const std::vector<unsigned> &info_bits_pos,
+	                                                  const std::unique_ptr<module::Encoder<B>>& encoder = nullptr);
 };
 }
 }
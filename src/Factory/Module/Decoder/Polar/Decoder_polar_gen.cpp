@@ -6,8 +6,9 @@
 
 #define ENABLE_SHORT_GENERATED_DECODERS
 
-// before to uncomment these next lines, make sure to run the script to generate the decoders
-// (see "scripts/generate_polar_decoders.sh")
+// the decoders can be generated and registered at build time with the AFF3CT_POLAR_GEN_SC and AFF3CT_POLAR_GEN_SCL
+// CMake options (see the AFF3CT_POLAR_GENERATED section below), the next lines are for the decoders which have been
+// generated by hand in the "Module/Decoder/Polar/SC/Generated/" and "Module/Decoder/Polar/SCL/CRC/Generated/" folders
 
 // RATE 1/2
 //#define ENABLE_DECODER_SC_FAST_N4_K2_SNR25
@@ -549,6 +550,19 @@
 #include "Module/Decoder/Polar/SCL/CRC/Generated/Decoder_polar_SCL_fast_CA_sys_N256_K64_SNR30.hpp"
 #endif
 
+#ifdef AFF3CT_POLAR_GENERATED
+#include "Factory/Module/Decoder/Polar/Decoder_polar_gen_list.hpp"
+
+// X macros applied on the lists of the decoders generated from the AFF3CT_POLAR_GEN_SC and AFF3CT_POLAR_GEN_SCL CMake
+// options (see the Decoder_polar_gen_list.hpp file in the build folder)
+#define AFF3CT_POLAR_GEN_BUILD_SC(IMPLEM, DECODER, FB) \
+	if (this->implem == #IMPLEM) return new module::DECODER<B,Q,API_polar>(this->K, this->N_cw, this->n_frames);
+#define AFF3CT_POLAR_GEN_BUILD_SCL(IMPLEM, DECODER, FB) \
+	if (this->implem == #IMPLEM) return new module::DECODER<B,Q,API_polar>(this->K, this->N_cw, this->L, *crc, this->n_frames);
+#define AFF3CT_POLAR_GEN_FROZEN_BITS(IMPLEM, DECODER, FB) \
+	if (implem == #IMPLEM) return module::FB;
+#endif
+
 //#define API_POLAR_DYNAMIC 1
 
 #ifdef API_POLAR_DYNAMIC
@@ -576,6 +590,10 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 {
 	if (this->type == "SC")
 	{
+#ifdef AFF3CT_POLAR_GENERATED
+		AFF3CT_POLAR_GEN_SC_LIST(AFF3CT_POLAR_GEN_BUILD_SC)
+#endif
+
 		// RATE 1/2
 #ifdef ENABLE_DECODER_SC_FAST_N4_K2_SNR25
 		if (this->implem == "N4_K2_SNR25"           ) return new module::Decoder_polar_SC_fast_sys_N4_K2_SNR25           <B, Q, API_polar>(this->K, this->N_cw,                 this->n_frames);
@@ -771,6 +789,10 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 	}
 	else if (this->type == "SCL" && crc != nullptr && crc->get_size() > 0)
 	{
+#ifdef AFF3CT_POLAR_GENERATED
+		AFF3CT_POLAR_GEN_SCL_LIST(AFF3CT_POLAR_GEN_BUILD_SCL)
+#endif
+
 #ifdef ENABLE_DECODER_SCL_FAST_CA_N4_K2_SNR25
 		if (this->implem == "CA_N4_K2_SNR25"        ) return new module::Decoder_polar_SCL_fast_CA_sys_N4_K2_SNR25       <B, Q, API_polar>(this->K, this->N_cw, this->L, *crc, this->n_frames);
 #endif
@@ -874,6 +896,11 @@ module::Decoder_SIHO<B,Q>* Decoder_polar
 const std::vector<bool>& Decoder_polar
 ::get_frozen_bits(const std::string &implem)
 {
+#ifdef AFF3CT_POLAR_GENERATED
+	AFF3CT_POLAR_GEN_SC_LIST (AFF3CT_POLAR_GEN_FROZEN_BITS)
+	AFF3CT_POLAR_GEN_SCL_LIST(AFF3CT_POLAR_GEN_FROZEN_BITS)
+#endif
+
 	// RATE 1/2
 #ifdef ENABLE_DECODER_SC_FAST_N4_K2_SNR25
 	if (implem == "N4_K2_SNR25"           ) return module::Decoder_polar_SC_fast_sys_fb_4_2_25;
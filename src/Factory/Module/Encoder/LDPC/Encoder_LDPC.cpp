@@ -7,6 +7,7 @@
 #include "Module/Encoder/LDPC/From_H/Encoder_LDPC_from_H.hpp"
 #include "Module/Encoder/LDPC/From_QC/Encoder_LDPC_from_QC.hpp"
 #include "Module/Encoder/LDPC/From_IRA/Encoder_LDPC_from_IRA.hpp"
+#include "Module/Encoder/LDPC/RU/Encoder_LDPC_RU.hpp"
 #include "Module/Encoder/LDPC/DVBS2/Encoder_LDPC_DVBS2.hpp"
 
 #include "Encoder_LDPC.hpp"
@@ -38,7 +39,7 @@ void Encoder_LDPC::parameters
 	auto p = this->get_prefix();
 	const std::string class_name = "factory::Encoder_LDPC::parameters::";
 
-	tools::add_options(args.at({p+"-type"}), 0, "LDPC", "LDPC_H", "LDPC_DVBS2", "LDPC_QC", "LDPC_IRA");
+	tools::add_options(args.at({p+"-type"}), 0, "LDPC", "LDPC_H", "LDPC_DVBS2", "LDPC_QC", "LDPC_IRA", "LDPC_RU");
 
 	tools::add_arg(args, p, class_name+"p+h-path",
 		tools::File(tools::openmode::read));
@@ -61,6 +62,9 @@ void Encoder_LDPC::parameters
 
 	tools::add_arg(args, p, class_name+"p+g-save-path",
 		tools::File(tools::openmode::write));
+
+	tools::add_arg(args, p, class_name+"p+g-cache-path",
+		tools::Folder(tools::openmode::read_write));
 }
 
 void Encoder_LDPC::parameters
@@ -68,11 +72,12 @@ void Encoder_LDPC::parameters
 {
 	auto p = this->get_prefix();
 
-	if(vals.exist({p+"-h-path"     })) this->H_path      = vals.to_file({p+"-h-path"     });
-	if(vals.exist({p+"-g-path"     })) this->G_path      = vals.to_file({p+"-g-path"     });
-	if(vals.exist({p+"-h-reorder"  })) this->H_reorder   = vals.at     ({p+"-h-reorder"  });
-	if(vals.exist({p+"-g-method"   })) this->G_method    = vals.at     ({p+"-g-method"   });
-	if(vals.exist({p+"-g-save-path"})) this->G_save_path = vals.at     ({p+"-g-save-path"});
+	if(vals.exist({p+"-h-path"      })) this->H_path       = vals.to_file  ({p+"-h-path"      });
+	if(vals.exist({p+"-g-path"      })) this->G_path       = vals.to_file  ({p+"-g-path"      });
+	if(vals.exist({p+"-h-reorder"   })) this->H_reorder    = vals.at       ({p+"-h-reorder"   });
+	if(vals.exist({p+"-g-method"    })) this->G_method     = vals.at       ({p+"-g-method"    });
+	if(vals.exist({p+"-g-save-path" })) this->G_save_path  = vals.at       ({p+"-g-save-path" });
+	if(vals.exist({p+"-g-cache-path"})) this->G_cache_path = vals.to_folder({p+"-g-cache-path"});
 
 	if (!this->G_path.empty())
 	{
@@ -105,7 +110,7 @@ void Encoder_LDPC::parameters
 	if (this->type == "LDPC")
 		headers[p].push_back(std::make_pair("G matrix path", this->G_path));
 
-	if (this->type == "LDPC_H" || this->type == "LDPC_QC")
+	if (this->type == "LDPC_H" || this->type == "LDPC_QC" || this->type == "LDPC_RU")
 	{
 		headers[p].push_back(std::make_pair("H matrix path", this->H_path));
 		headers[p].push_back(std::make_pair("H matrix reordering", this->H_reorder));
@@ -116,6 +121,8 @@ void Encoder_LDPC::parameters
 		headers[p].push_back(std::make_pair("G build method", this->G_method));
 		if (this->G_save_path != "")
 		headers[p].push_back(std::make_pair("G save path", this->G_save_path));
+		if (this->G_cache_path != "")
+		headers[p].push_back(std::make_pair("G cache path", this->G_cache_path));
 	}
 }
 
@@ -124,9 +131,10 @@ module::Encoder_LDPC<B>* Encoder_LDPC::parameters
 ::build(const tools::Sparse_matrix &G, const tools::Sparse_matrix &H) const
 {
 	if (this->type == "LDPC"    ) return new module::Encoder_LDPC         <B>(this->K, this->N_cw, G, this->n_frames);
-	if (this->type == "LDPC_H"  ) return new module::Encoder_LDPC_from_H  <B>(this->K, this->N_cw, H, this->G_method, this->G_save_path, this->n_frames);
+	if (this->type == "LDPC_H"  ) return new module::Encoder_LDPC_from_H  <B>(this->K, this->N_cw, H, this->G_method, this->G_save_path, this->G_cache_path, this->n_frames);
 	if (this->type == "LDPC_QC" ) return new module::Encoder_LDPC_from_QC <B>(this->K, this->N_cw, H, this->n_frames);
 	if (this->type == "LDPC_IRA") return new module::Encoder_LDPC_from_IRA<B>(this->K, this->N_cw, H, this->n_frames);
+	if (this->type == "LDPC_RU" ) return new module::Encoder_LDPC_RU      <B>(this->K, this->N_cw, H, this->n_frames);
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -140,6 +148,15 @@ module::Encoder_LDPC<B>* Encoder_LDPC::parameters
 	return build<B>(G, H);
 }
 
+template <typename B>
+module::Encoder_LDPC<B>* Encoder_LDPC::parameters
+::build(const std::vector<std::vector<int>> &base, const int Z) const
+{
+	if (this->type == "LDPC_QC") return new module::Encoder_LDPC_from_QC<B>(this->K, this->N_cw, base, Z, this->n_frames);
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
 template <typename B>
 module::Encoder_LDPC<B>* Encoder_LDPC
 ::build(const parameters           &params,
@@ -159,6 +176,15 @@ module::Encoder_LDPC<B>* Encoder_LDPC
 	return params.template build<B>(G, H, dvbs2);
 }
 
+template <typename B>
+module::Encoder_LDPC<B>* Encoder_LDPC
+::build(const parameters                    &params,
+        const std::vector<std::vector<int>> &base,
+        const int                            Z)
+{
+	return params.template build<B>(base, Z);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -179,11 +205,23 @@ template aff3ct::module::Encoder_LDPC<B_8 >* aff3ct::factory::Encoder_LDPC::buil
 template aff3ct::module::Encoder_LDPC<B_16>* aff3ct::factory::Encoder_LDPC::build<B_16>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&);
 template aff3ct::module::Encoder_LDPC<B_32>* aff3ct::factory::Encoder_LDPC::build<B_32>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&);
 template aff3ct::module::Encoder_LDPC<B_64>* aff3ct::factory::Encoder_LDPC::build<B_64>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&);
+
+template aff3ct::module::Encoder_LDPC<B_8 >* aff3ct::factory::Encoder_LDPC::parameters::build<B_8 >(const std::vector<std::vector<int>>&, const int) const;
+template aff3ct::module::Encoder_LDPC<B_16>* aff3ct::factory::Encoder_LDPC::parameters::build<B_16>(const std::vector<std::vector<int>>&, const int) const;
+template aff3ct::module::Encoder_LDPC<B_32>* aff3ct::factory::Encoder_LDPC::parameters::build<B_32>(const std::vector<std::vector<int>>&, const int) const;
+template aff3ct::module::Encoder_LDPC<B_64>* aff3ct::factory::Encoder_LDPC::parameters::build<B_64>(const std::vector<std::vector<int>>&, const int) const;
+template aff3ct::module::Encoder_LDPC<B_8 >* aff3ct::factory::Encoder_LDPC::build<B_8 >(const aff3ct::factory::Encoder_LDPC::parameters&, const std::vector<std::vector<int>>&, const int);
+template aff3ct::module::Encoder_LDPC<B_16>* aff3ct::factory::Encoder_LDPC::build<B_16>(const aff3ct::factory::Encoder_LDPC::parameters&, const std::vector<std::vector<int>>&, const int);
+template aff3ct::module::Encoder_LDPC<B_32>* aff3ct::factory::Encoder_LDPC::build<B_32>(const aff3ct::factory::Encoder_LDPC::parameters&, const std::vector<std::vector<int>>&, const int);
+template aff3ct::module::Encoder_LDPC<B_64>* aff3ct::factory::Encoder_LDPC::build<B_64>(const aff3ct::factory::Encoder_LDPC::parameters&, const std::vector<std::vector<int>>&, const int);
 #else
 template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::parameters::build<B>(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&) const;
 template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::build<B>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&);
 
 template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::parameters::build<B>(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&) const;
 template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::build<B>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&);
+
+template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::parameters::build<B>(const std::vector<std::vector<int>>&, const int) const;
+template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::build<B>(const aff3ct::factory::Encoder_LDPC::parameters&, const std::vector<std::vector<int>>&, const int);
 #endif
 // ==================================================================================== explicit template instantiation
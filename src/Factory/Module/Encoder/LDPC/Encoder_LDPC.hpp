@@ -2,6 +2,7 @@
 #define FACTORY_ENCODER_LDPC_HPP
 
 #include <string>
+#include <vector>
 #include <memory>
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 #include "Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants.hpp"
@@ -30,8 +31,9 @@ struct Encoder_LDPC : public Encoder
 		std::string H_reorder = "NONE";
 
 		// G generator method
-		std::string G_method    = "IDENTITY";
-		std::string G_save_path = "";
+		std::string G_method     = "IDENTITY";
+		std::string G_save_path  = "";
+		std::string G_cache_path = "";
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Encoder_LDPC_prefix);
@@ -49,6 +51,8 @@ struct Encoder_LDPC : public Encoder
 		template <typename B = int>
 		module::Encoder_LDPC<B>* build(const tools::Sparse_matrix &G, const tools::Sparse_matrix &H,
 		                               const tools::dvbs2_values& dvbs2) const;
+		template <typename B = int>
+		module::Encoder_LDPC<B>* build(const std::vector<std::vector<int>> &base, const int Z) const;
 	};
 
 	template <typename B = int>
@@ -58,6 +62,9 @@ struct Encoder_LDPC : public Encoder
 	static module::Encoder_LDPC<B>* build(const parameters &params, const tools::Sparse_matrix &G,
 	                                                                const tools::Sparse_matrix &H,
 	                                                                const tools::dvbs2_values& dvbs2);
+	template <typename B = int>
+	static module::Encoder_LDPC<B>* build(const parameters &params, const std::vector<std::vector<int>> &base,
+	                                                                const int Z);
 };
 }
 }
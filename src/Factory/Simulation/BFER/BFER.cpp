@@ -2,6 +2,7 @@
 
 #include "Tools/Documentation/documentation.h"
 #include "Tools/Math/utils.h"
+#include "Tools/Threads/Thread_pinning.hpp"
 
 #include "BFER.hpp"
 
@@ -113,6 +114,18 @@ void BFER::parameters
 	tools::add_arg(args, p, class_name+"p+coded",
 		tools::None());
 
+	tools::add_arg(args, p, class_name+"p+pin-threads",
+		tools::Text(),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+conc-points",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+arena",
+		tools::None(),
+		tools::arg_rank::ADV);
+
 	auto pmnt = mnt_er->get_prefix();
 
 	tools::add_arg(args, pmnt, class_name+"p+mutinfo",
@@ -149,6 +162,9 @@ void BFER::parameters
 	if(vals.exist({p+"-err-trk"      })) this->err_track_enable    = true;
 	if(vals.exist({p+"-coset",    "c"})) this->coset               = true;
 	if(vals.exist({p+"-coded",       })) this->coded_monitoring    = true;
+	if(vals.exist({p+"-pin-threads"  })) this->pin_threads         = vals.at    ({p+"-pin-threads"    });
+	if(vals.exist({p+"-conc-points"  })) this->n_conc_points       = vals.to_int({p+"-conc-points"    });
+	if(vals.exist({p+"-arena"        })) this->sck_arena           = true;
 
 	if (this->err_track_revert)
 	{
@@ -156,6 +172,9 @@ void BFER::parameters
 		this->n_threads = 1;
 	}
 
+	if (!this->pin_threads.empty())
+		tools::Thread_pinning(this->pin_threads, this->n_threads); // throw if the policy is wrong
+
 	auto pmnt = mnt_er->get_prefix();
 
 	if(vals.exist({pmnt+"-mutinfo"})) this->mnt_mutinfo = true;
@@ -201,6 +220,32 @@ void BFER::parameters
 	if (this->err_track_threshold)
 		headers[p].push_back(std::make_pair("Bad frames threshold", std::to_string(this->err_track_threshold)));
 
+	if (this->n_conc_points > 1)
+	{
+		headers[p].push_back(std::make_pair("Concurrent noise points", std::to_string(this->n_conc_points)));
+
+		// the noise points are simulated together, they are traced in a single file
+		for (auto &h : headers[p])
+			if (h.first == "Trace base path")
+				h = std::make_pair("Trace file", this->trace_path + ".json");
+	}
+
+	if (this->sck_arena)
+		headers[p].push_back(std::make_pair("Socket buffers arena", "on"));
+
+	if (!this->pin_threads.empty())
+	{
+		tools::Thread_pinning pinning(this->pin_threads, this->n_threads);
+
+		std::stringstream pin_str;
+		pin_str << pinning.get_policy() << " (cores: ";
+		for (size_t tid = 0; tid < pinning.get_mapping().size(); tid++)
+			pin_str << (tid ? ", " : "") << pinning.get_mapping()[tid];
+		pin_str << ")";
+
+		headers[p].push_back(std::make_pair("Thread pinning", pin_str.str()));
+	}
+
 	if (this->err_track_enable || this->err_track_revert)
 	{
 		std::string path = this->err_track_path + std::string("_$noise.[src,enc,chn]");
@@ -29,12 +29,15 @@ struct BFER : Simulation
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
 		// optional parameters
 		std::string err_track_path      = "error_tracker";
+		std::string pin_threads         = "";
 		int         err_track_threshold = 0;
+		int         n_conc_points       = 1;
 		bool        err_track_revert    = false;
 		bool        err_track_enable    = false;
 		bool        coset               = false;
 		bool        coded_monitoring    = false;
 		bool        mnt_mutinfo         = false;
+		bool        sck_arena           = false;
 
 #ifdef AFF3CT_MPI
 		std::chrono::milliseconds mnt_mpi_comm_freq = std::chrono::milliseconds(1000);
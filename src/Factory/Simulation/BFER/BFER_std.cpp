@@ -1,3 +1,5 @@
+#include "Tools/Documentation/documentation.h"
+
 #include "Simulation/BFER/Standard/SystemC/SC_BFER_std.hpp"
 #include "Simulation/BFER/Standard/Threads/BFER_std_threads.hpp"
 
@@ -39,18 +41,46 @@ void BFER_std::parameters
 ::get_description(tools::Argument_map_info &args) const
 {
 	BFER::parameters::get_description(args);
+
+	auto p = this->get_prefix();
+	const std::string class_name = "factory::BFER_std::parameters::";
+
+	tools::add_arg(args, p, class_name+"p+pipeline",
+		tools::Integer(tools::Positive()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+pip-queue",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
 }
 
 void BFER_std::parameters
 ::store(const tools::Argument_map_value &vals)
 {
 	BFER::parameters::store(vals);
+
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-pipeline" })) this->pip_gen_threads = vals.to_int({p+"-pipeline" });
+	if(vals.exist({p+"-pip-queue"})) this->pip_queue_size  = vals.to_int({p+"-pip-queue"});
 }
 
 void BFER_std::parameters
 ::get_headers(std::map<std::string,header_list>& headers, const bool full) const
 {
 	BFER::parameters::get_headers(headers, full);
+
+	auto p = this->get_prefix();
+
+	if (this->pip_gen_threads)
+	{
+		std::stringstream pip_str;
+		pip_str << this->pip_gen_threads << "/" << (this->n_threads - this->pip_gen_threads);
+		headers[p].push_back(std::make_pair("Pipeline (gen./dec. threads)", pip_str.str()));
+
+		auto queue_size = this->pip_queue_size ? this->pip_queue_size : 2 * this->n_threads;
+		headers[p].push_back(std::make_pair("Pipeline queue size", std::to_string(queue_size)));
+	}
 }
 
 const Codec_SIHO::parameters* BFER_std::parameters
@@ -28,6 +28,10 @@ struct BFER_std : BFER
 	{
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		int pip_gen_threads = 0; // number of threads dedicated to the generation stage (0 = no pipeline)
+		int pip_queue_size  = 0; // number of frames in flight between the two stages (0 = 2 * 'n_threads')
+
 		// module parameters
 		// Codec_SIHO::parameters *cdc = nullptr;
 
@@ -59,6 +59,14 @@ void Simulation::parameters
 		tools::None(),
 		tools::arg_rank::ADV);
 
+	tools::add_arg(args, p, class_name+"p+fra-auto",
+		tools::List<int>(tools::Integer(tools::Positive(), tools::Non_zero()), tools::Length(1)),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+fra-auto-time",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
 	tools::add_arg(args, p, class_name+"p+dbg",
 		tools::None());
 
@@ -77,6 +85,14 @@ void Simulation::parameters
 	tools::add_arg(args, p, class_name+"p+stats",
 		tools::None());
 
+	tools::add_arg(args, p, class_name+"p+stats-hw",
+		tools::None(),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+trace-path",
+		tools::File(tools::openmode::write),
+		tools::arg_rank::ADV);
+
 	tools::add_arg(args, p, class_name+"p+threads,t",
 		tools::Integer(tools::Positive()));
 
@@ -97,9 +113,17 @@ void Simulation::parameters
 
 	if(vals.exist({p+"-meta"          })) this->meta        =         vals.at    ({p+"-meta"        });
 	if(vals.exist({p+"-stop-time"     })) this->stop_time   = seconds(vals.to_int({p+"-stop-time"   }));
+	if(vals.exist({p+"-fra-auto"      })) this->fra_auto    = vals.to_list<int>({p+"-fra-auto"});
+	if(vals.exist({p+"-fra-auto-time" })) this->fra_auto_time = milliseconds(vals.to_int({p+"-fra-auto-time"}));
 	if(vals.exist({p+"-max-fra",   "n"})) this->max_frame   =         vals.to_int({p+"-max-fra", "n"});
 	if(vals.exist({p+"-seed",      "S"})) this->global_seed =         vals.to_int({p+"-seed",    "S"});
 	if(vals.exist({p+"-stats"         })) this->statistics  = true;
+	if(vals.exist({p+"-stats-hw"      }))
+	{
+		this->statistics    = true;
+		this->statistics_hw = true;
+	}
+	if(vals.exist({p+"-trace-path"    })) this->trace_path  =         vals.at    ({p+"-trace-path"  });
 	if(vals.exist({p+"-dbg"           })) this->debug       = true;
 	if(vals.exist({p+"-crit-nostop"   })) this->crit_nostop = true;
 	if(vals.exist({p+"-dbg-limit", "d"}))
@@ -153,6 +177,15 @@ void Simulation::parameters
 	if(vals.exist({p+"-prec", "p"})) this->sim_prec = vals.to_int({p+"-prec", "p"});
 #endif
 
+#ifdef AFF3CT_MPI
+	if (!this->fra_auto.empty())
+	{
+		std::stringstream message;
+		message << "The inter frame level autotuning is not compatible with MPI.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+#endif
+
 	if (this->debug && !(vals.exist({p+"-threads", "t"}) && vals.to_int({p+"-threads", "t"}) > 0))
 		// check if debug is asked and if n_thread kept its default value
 		this->n_threads = 1;
@@ -169,6 +202,20 @@ void Simulation::parameters
 
 	headers[p].push_back(std::make_pair("Seed", std::to_string(this->global_seed)));
 	headers[p].push_back(std::make_pair("Statistics", this->statistics ? "on" : "off"));
+	if (this->statistics_hw)
+		headers[p].push_back(std::make_pair("Hardware counters", "on"));
+	if (!this->trace_path.empty())
+		headers[p].push_back(std::make_pair("Trace base path", this->trace_path + "_$noise.json"));
+	if (!this->fra_auto.empty())
+	{
+		std::stringstream fra_auto_str;
+		fra_auto_str << "{";
+		for (size_t i = 0; i < this->fra_auto.size(); i++)
+			fra_auto_str << (i ? "," : "") << this->fra_auto[i];
+		fra_auto_str << "} (" << this->fra_auto_time.count() << " ms per value)";
+
+		headers[p].push_back(std::make_pair("Inter frame autotuning", fra_auto_str.str()));
+	}
 	headers[p].push_back(std::make_pair("Debug mode", this->debug ? "on" : "off"));
 	if (this->debug)
 	{
@@ -26,22 +26,26 @@ struct Simulation : Launcher
 		tools::auto_cloned_unique_ptr<Noise::parameters> noise;
 
 		// optional parameters
-		std::chrono::seconds stop_time       = std::chrono::seconds(0);
-		std::string          meta            = "";
-		unsigned             max_frame       = 0;
-		bool                 debug           = false;
-		bool                 debug_hex       = false;
-		bool                 statistics      = false;
-		bool                 crit_nostop     = false;
-		int                  n_threads       = 1;
-		int                  local_seed      = 0;
-		int                  global_seed     = 0;
-		int                  debug_limit     = 0;
-		int                  debug_precision = 2;
-		int                  debug_frame_max = 0;
+		std::chrono::seconds      stop_time       = std::chrono::seconds(0);
+		std::chrono::milliseconds fra_auto_time   = std::chrono::milliseconds(1000);
+		std::vector<int>          fra_auto;
+		std::string               meta            = "";
+		std::string               trace_path      = "";
+		unsigned                  max_frame       = 0;
+		bool                      debug           = false;
+		bool                      debug_hex       = false;
+		bool                      statistics      = false;
+		bool                      statistics_hw   = false;
+		bool                      crit_nostop     = false;
+		int                       n_threads       = 1;
+		int                       local_seed      = 0;
+		int                       global_seed     = 0;
+		int                       debug_limit     = 0;
+		int                       debug_precision = 2;
+		int                       debug_frame_max = 0;
 #ifdef AFF3CT_MPI
-		int                  mpi_rank        = 0;
-		int                  mpi_size        = 1;
+		int                       mpi_rank        = 0;
+		int                       mpi_size        = 1;
 #endif
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
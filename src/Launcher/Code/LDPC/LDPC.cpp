@@ -68,6 +68,8 @@ void LDPC<L,B,R,Q>
 
 	L::store_args();
 
+	dec_ldpc->n_decimals = this->params.qnt->n_decimals;
+
 	params_cdc->enc->n_frames = this->params.src->n_frames;
 	if (params_cdc->pct != nullptr)
 	params_cdc->pct->n_frames = this->params.src->n_frames;
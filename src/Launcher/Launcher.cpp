@@ -1,6 +1,7 @@
 #include <rang.hpp>
 #include <cstdlib>
 #include <sstream>
+#include <iomanip>
 #include <iostream>
 #include <algorithm>
 #include <functional>
@@ -37,7 +38,7 @@ using namespace aff3ct::launcher;
 
 Launcher::Launcher(const int argc, const char **argv, factory::Simulation::parameters &params_common,
                    std::ostream &stream)
-: simu(nullptr), ah(argc, argv), params_common(params_common), stream(stream)
+: simu(nullptr), fra_auto_best(0), ah(argc, argv), params_common(params_common), stream(stream)
 {
 	cmd_line += std::string(argv[0]) + std::string(" ");
 	for (auto i = 1; i < argc; i++)
@@ -125,6 +126,84 @@ void Launcher::print_header()
 	stream << rang::tag::comment << rang::style::bold << rang::style::underline << "Parameters:"<< rang::style::reset << std::endl;
 	factory::Header::print_parameters({&params_common}, this->params_common.full_legend, this->stream);
 	this->stream << rang::tag::comment << std::endl;
+
+	if (!this->fra_auto_curve.empty())
+	{
+		stream << rang::tag::comment << rang::style::bold << rang::style::underline << "Inter frame autotuning:"
+		       << rang::style::reset << std::endl;
+		for (auto &point : this->fra_auto_curve)
+		{
+			stream << rang::tag::comment << "   ** F = " << std::setw(4) << point.first << " -> ";
+			if (point.second != 0.)
+				stream << std::setw(10) << std::fixed << std::setprecision(3) << point.second << " Mb/s per thread";
+			else
+				stream << "     error";
+			if (point.first == this->fra_auto_best)
+				stream << rang::style::bold << " (selected)" << rang::style::reset;
+			stream << std::endl;
+		}
+		this->stream << rang::tag::comment << std::endl;
+	}
+}
+
+void Launcher::autotune_n_frames()
+{
+	const auto arg_vals_save = this->arg_vals;
+
+	this->fra_auto_curve.clear();
+	for (auto n_frames : this->params_common.fra_auto)
+	{
+		auto thr = 0.;
+		try
+		{
+			this->set_n_frames(n_frames);
+
+			std::unique_ptr<simulation::Simulation> calib(this->build_simu());
+			thr = calib->calibrate(this->params_common.fra_auto_time);
+		}
+		// this inter frame level is not supported by a module, the other exceptions stop the autotuning
+		catch (tools::invalid_argument const&)
+		{
+			thr = 0.;
+		}
+		catch (tools::length_error const&)
+		{
+			thr = 0.;
+		}
+		catch (tools::cannot_allocate const&)
+		{
+			thr = 0.;
+		}
+
+		tools::Terminal::reset();
+		this->fra_auto_curve.push_back(std::make_pair(n_frames, thr));
+	}
+
+	auto best = std::max_element(this->fra_auto_curve.begin(), this->fra_auto_curve.end(),
+	                             [](const std::pair<int,double> &a, const std::pair<int,double> &b)
+	                             { return a.second < b.second; });
+
+	if (best->second != 0.)
+	{
+		this->fra_auto_best = best->first;
+		this->set_n_frames(this->fra_auto_best);
+	}
+	else
+	{
+		this->cmd_warn.push_back("The inter frame level autotuning failed, the default inter frame level is used.");
+		this->arg_vals = arg_vals_save;
+		this->store_args();
+	}
+}
+
+void Launcher::set_n_frames(const int n_frames)
+{
+	// all the modules share the "F" short tag for their inter frame level
+	for (auto &a : this->args)
+		if (std::find(a.first.begin(), a.first.end(), "F") != a.first.end())
+			this->arg_vals[a.first] = std::make_pair(std::to_string(n_frames), a.second);
+
+	this->store_args();
 }
 
 std::string remove_argument(const std::string& cmd, std::string arg)
@@ -170,6 +249,19 @@ int Launcher::launch()
 		return EXIT_FAILURE;
 	}
 
+	if (!this->params_common.fra_auto.empty())
+	{
+		try
+		{
+			this->autotune_n_frames();
+		}
+		catch(const std::exception& e)
+		{
+			rang::format_on_each_line(std::cerr, std::string(e.what()) + "\n", rang::tag::error);
+			return EXIT_FAILURE;
+		}
+	}
+
 	// write the command and he curve name in the PyBER format
 #ifdef AFF3CT_MPI
 	if (this->params_common.mpi_rank == 0)
@@ -35,6 +35,8 @@ private:
 	std::unique_ptr<simulation::Simulation> simu; /*!< A generic simulation pointer to allocate a specific simulation. */
 	std::string                      cmd_line;
 	std::vector<std::string>         cmd_warn;
+	std::vector<std::pair<int,double>> fra_auto_curve; /*!< The throughput per thread measured for each inter frame level. */
+	int                              fra_auto_best;
 
 protected:
 	tools::Argument_handler         ah;       /*!< An argument reader to manage the parsing and the documentation of the command line parameters. */
@@ -96,6 +98,20 @@ protected:
 
 private:
 	int read_arguments();
+
+	/*!
+	 * \brief Selects the inter frame level with the best throughput per thread.
+	 *
+	 * A short calibration simulation is built and run for each inter frame level of the list, then the parameters
+	 * are stored again with the best one. A level is skipped when a module rejects it (invalid argument, length error
+	 * or no implementation), the other exceptions are propagated.
+	 */
+	void autotune_n_frames();
+
+	/*!
+	 * \brief Stores the parameters as if "-F n_frames" was given on the command line.
+	 */
+	void set_n_frames(const int n_frames);
 };
 }
 }
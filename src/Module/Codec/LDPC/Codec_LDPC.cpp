@@ -24,7 +24,8 @@ Codec_LDPC<B,Q>
              const factory::Decoder_LDPC  ::parameters &dec_params,
                    factory::Puncturer_LDPC::parameters *pct_params)
 : Codec          <B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
-  Codec_SISO_SIHO<B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames)
+  Codec_SISO_SIHO<B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
+  Z(0)
 {
 	const std::string name = "Codec_LDPC";
 	this->set_name(name);
@@ -55,6 +56,41 @@ Codec_LDPC<B,Q>
 	}
 
 	// ---------------------------------------------------------------------------------------------------------- tools
+	if (dec_params.is_nr())
+	{	// 5G NR base graph: lifted here to the size of the code
+		nr_bg.reset(new tools::NR_base_graph(dec_params.build_nr_base_graph()));
+
+		Z    = enc_params.N_cw / (int)nr_bg->get_n_cols();
+		base = nr_bg->get_base_matrix(Z);
+
+		if (enc_params.N_cw != (int)nr_bg->get_n_cols() * Z || enc_params.K != (int)nr_bg->get_n_info_cols() * Z)
+		{
+			std::stringstream message;
+			message << "The code dimensions do not match the '" << nr_bg->get_name() << "' base graph ("
+			        << "'enc_params.K' = " << enc_params.K << ", 'enc_params.N_cw' = " << enc_params.N_cw
+			        << ", 'Z' = " << Z << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	// the QC encoder and the horizontal layered INTRA MS/NMS/OMS decoders walk the circulants of the base graph, the
+	// other ones need the expanded H matrix
+	const auto circulant_enc = Z != 0 && enc_params.type == "LDPC_QC";
+	const auto circulant_dec = Z != 0 && dec_params.is_circulant();
+
+	if (circulant_dec && dec_params.H_reorder != "NONE")
+	{
+		std::stringstream message;
+		message << "The H matrix can't be reordered when the decoder walks the circulants of the 5G NR base graph, "
+		        << "'dec_params.H_reorder' has to be 'NONE' ('dec_params.H_reorder' = " << dec_params.H_reorder
+		        << ", 'dec_params.type' = " << dec_params.type << ", 'dec_params.implem' = " << dec_params.implem
+		        << ", 'dec_params.simd_strategy' = " << dec_params.simd_strategy << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (Z != 0 && (!circulant_enc || !circulant_dec))
+		H = tools::Shared_sparse_matrix::make(nr_bg->expand(Z));
+
 	if (enc_params.type == "LDPC")
 	{
 		G = tools::LDPC_matrix_handler::read(enc_params.G_path, &info_bits_pos);
@@ -62,10 +98,10 @@ Codec_LDPC<B,Q>
 	else if (enc_params.type == "LDPC_DVBS2")
 	{
 		dvbs2 = tools::build_dvbs2(this->K, this->N);
-		H     = tools::build_H(*dvbs2);
+		H     = tools::Shared_sparse_matrix::make(tools::build_H(*dvbs2));
 	}
 
-	if (H.get_n_connections() == 0)
+	if (H == nullptr && Z == 0)
 	{
 		tools::LDPC_matrix_handler::Positions_vector* ibp = nullptr;
 		std::vector<bool>* pct = nullptr;
@@ -76,20 +112,30 @@ Codec_LDPC<B,Q>
 		if (pct_params != nullptr && pct_params->pattern.empty())
 			pct = &pct_params->pattern;
 
-		H = tools::LDPC_matrix_handler::read(dec_params.H_path, ibp, pct);
+		H = tools::LDPC_matrix_handler::read_shared(dec_params.H_path, ibp, pct);
 	}
 
+	if (H == nullptr) // the QC encoder and the horizontal layered INTRA decoder do not use it
+		H = std::make_shared<const tools::Sparse_matrix>();
+
 	if (dec_params.H_reorder != "NONE")
 	{	// reorder the H matrix following the check node degrees
-		H.sort_cols_per_density(dec_params.H_reorder == "ASC" ? tools::Matrix::Sort::ASCENDING : tools::Matrix::Sort::DESCENDING);
+		auto H_sorted = *H;
+		H_sorted.sort_cols_per_density(dec_params.H_reorder == "ASC" ? tools::Matrix::Sort::ASCENDING : tools::Matrix::Sort::DESCENDING);
+		H = tools::Shared_sparse_matrix::make(std::move(H_sorted));
 	}
 
 
 
-	if (info_bits_pos.empty())
+	if (enc_params.type == "LDPC_RU")
+	{	// the positions of the information bits come from the triangulation of the H matrix
+		this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, *H));
+		info_bits_pos = this->get_encoder()->get_info_bits_pos();
+	}
+	else if (info_bits_pos.empty())
 	{
 		if (enc_params.type == "LDPC_H")
-			this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, H));
+			this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, *H));
 	}
 	else
 	{
@@ -129,7 +175,10 @@ Codec_LDPC<B,Q>
 	{ // encoder not set when building encoder LDPC_H
 		try
 		{
-			this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, H, *dvbs2));
+			if (circulant_enc)
+				this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, base, Z));
+			else
+				this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, *H, *dvbs2));
 		}
 		catch(tools::cannot_allocate const&)
 		{
@@ -151,13 +200,20 @@ Codec_LDPC<B,Q>
 		}
 	}
 
-	try
+	if (circulant_dec)
 	{
-		this->set_decoder_siso_siho(factory::Decoder_LDPC::build_siso<B,Q>(dec_params, H, info_bits_pos, this->get_encoder()));
+		this->set_decoder_siso_siho(factory::Decoder_LDPC::build_siso<B,Q>(dec_params, base, Z, info_bits_pos, this->get_encoder()));
 	}
-	catch (const std::exception&)
+	else
 	{
-		this->set_decoder_siho(factory::Decoder_LDPC::build<B,Q>(dec_params, H, info_bits_pos, this->get_encoder()));
+		try
+		{
+			this->set_decoder_siso_siho(factory::Decoder_LDPC::build_siso<B,Q>(dec_params, *H, info_bits_pos, this->get_encoder()));
+		}
+		catch (const std::exception&)
+		{
+			this->set_decoder_siho(factory::Decoder_LDPC::build<B,Q>(dec_params, *H, info_bits_pos, this->get_encoder()));
+		}
 	}
 }
 
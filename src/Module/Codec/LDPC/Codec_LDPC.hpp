@@ -2,14 +2,18 @@
 #define CODEC_LDPC_HPP_
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "Factory/Module/Encoder/LDPC/Encoder_LDPC.hpp"
 #include "Factory/Module/Puncturer/LDPC/Puncturer_LDPC.hpp"
 #include "Factory/Module/Decoder/LDPC/Decoder_LDPC.hpp"
 
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Shared_sparse_matrix.hpp"
 #include "Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants.hpp"
 #include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
+#include "Tools/Code/LDPC/Standard/NR/NR_base_graph.hpp"
 
 #include "../Codec_SISO_SIHO.hpp"
 
@@ -21,11 +25,14 @@ template <typename B = int, typename Q = float>
 class Codec_LDPC : public Codec_SISO_SIHO<B,Q>
 {
 protected:
-	tools::Sparse_matrix H;
+	std::shared_ptr<const tools::Sparse_matrix> H; // read-only, shared with the decoder
 	tools::Sparse_matrix G;
 	tools::LDPC_matrix_handler::Positions_vector info_bits_pos;
 	std::vector<bool> pctPattern;
 	std::unique_ptr<tools::dvbs2_values> dvbs2;
+	std::unique_ptr<tools::NR_base_graph> nr_bg;
+	std::vector<std::vector<int>> base; // the shifts of the circulants of the lifted 5G NR base graph
+	int Z;                              // the lifting size, 0 if the code is not a 5G NR one
 
 public:
 	Codec_LDPC(const factory::Encoder_LDPC::parameters   &enc_params,
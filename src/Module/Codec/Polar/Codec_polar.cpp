@@ -18,7 +18,8 @@ Codec_polar<B,Q>
   Codec_SISO_SIHO<B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
   adaptive_fb(fb_params.sigma == -1.f),
   frozen_bits(fb_params.N_cw, true),
-  generated_decoder((dec_params.implem.find("_SNR") != std::string::npos)),
+  generated_decoder((dec_params.implem.find("_SNR") != std::string::npos) ||
+                    (dec_params.implem.find("_FB_") != std::string::npos)),
   puncturer_shortlast(nullptr),
   fb_decoder(nullptr),
   fb_encoder(nullptr)
@@ -32,6 +32,7 @@ Decoder_LDPC_bit_flipping<B,R>
   enable_syndrome       (enable_syndrome                          ),
   syndrome_depth        (syndrome_depth                           ),
   H                     (H                                        ),
+  Hc                    (H                                        ),
   init_flag             (true                                     ),
   info_bits_pos         (info_bits_pos                            ),
   Lp_N                  (N,                                      -1), // -1 in order to fail when AZCW
@@ -216,7 +217,7 @@ void Decoder_LDPC_bit_flipping<B,R>
 		auto min_val = std::numeric_limits<R>::max();
 		for (auto mmin = 0; mmin < length; ++mmin)
 		{
-			auto comp = (R)std::abs(Y_N[this->H.get_rows_from_col(imin)[mmin]]);
+			auto comp = (R)std::abs(Y_N[this->Hc.get_rows_from_col(imin)[mmin]]);
 			min_val = (min_val > comp)?comp:min_val;
 		}
 		Y_min[imin] = min_val;
@@ -230,6 +231,9 @@ void Decoder_LDPC_bit_flipping<B,R>
 	// actual decoding
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
+		if (this->is_cancelled()) // the frame will be thrown away
+			break;
+
 		// specific inner code depending on the selected implementation (WBF for example)
 		auto syndrome = this->BF_process(Y_N, this->V_to_C[frame_id], this->C_to_V[frame_id]);
 
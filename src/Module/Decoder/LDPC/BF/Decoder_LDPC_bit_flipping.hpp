@@ -3,6 +3,7 @@
 
 #include "../../Decoder_SISO_SIHO.hpp"
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Compact_sparse_matrix.hpp"
 
 namespace aff3ct
 {
@@ -23,7 +24,8 @@ protected:
 	const bool enable_syndrome;
 	const int  syndrome_depth;
 
-	const tools::Sparse_matrix &H;
+	const tools::Sparse_matrix           &H;
+	const tools::Compact_sparse_matrix<>  Hc; // same connections as H, stored contiguously (CSR/CSC) for the hot loops
 
 	// reset so C_to_V and V_to_C structures can be cleared only at the begining of the loop in iterative decoding
 	bool init_flag;
@@ -22,16 +22,19 @@ Decoder_LDPC_bit_flipping_hard<B,R>
                            const bool enable_syndrome,
                            const int syndrome_depth,
                            const int n_frames)
-: Decoder               (K, N, n_frames, 1   ),
-  Decoder_SIHO_HIHO<B,R>(K, N, n_frames, 1   ),
-  n_ite                 (n_ite               ),
-  enable_syndrome       (enable_syndrome     ),
-  syndrome_depth        (syndrome_depth      ),
-  H                     (_H.turn(tools::Sparse_matrix::Way::VERTICAL)),
-  var_nodes             (N                   ),
-  check_nodes           (this->H.get_n_cols()),
-  YH_N                  (N                   ),
-  info_bits_pos         (info_bits_pos       )
+: Decoder               (K, N, n_frames, 1                             ),
+  Decoder_SIHO_HIHO<B,R>(K, N, n_frames, 1                             ),
+  n_ite                 (n_ite                                         ),
+  enable_syndrome       (enable_syndrome                               ),
+  syndrome_depth        (syndrome_depth                                ),
+  H_shared              (tools::Shared_sparse_matrix::vertical(_H)     ),
+  Hc_shared             (tools::Shared_sparse_matrix::compact(*H_shared)),
+  H                     (*H_shared                                     ),
+  Hc                    (*Hc_shared                                    ),
+  var_nodes             (N                                             ),
+  check_nodes           (this->H.get_n_cols()                          ),
+  YH_N                  (N                                             ),
+  info_bits_pos         (info_bits_pos                                 )
 {
 	const std::string name = "Decoder_LDPC_bit_flipping_hard";
 	this->set_name(name);
@@ -168,6 +171,9 @@ bool Decoder_LDPC_bit_flipping_hard<B,R>
 
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
+		if (this->is_cancelled()) // the frame will be thrown away
+			break;
+
 		this->cn_process(VN, CN, frame_id);
 
 		if (this->enable_syndrome && (synd = check_syndrome()))
@@ -3,6 +3,8 @@
 
 #include "../../Decoder_SIHO_HIHO.hpp"
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Compact_sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Shared_sparse_matrix.hpp"
 
 namespace aff3ct
 {
@@ -26,10 +28,14 @@ protected:
 	const int  syndrome_depth;
 	int cur_syndrome_depth;
 
-	const tools::Sparse_matrix  H; // In vertical way
-	                               // CN are along the columns -> H.get_n_cols() == M (often M=N-K)
-	                               // VN are along the rows    -> H.get_n_rows() == N
-	                               // automatically transpose in the constructor if needed
+	const std::shared_ptr<const tools::Sparse_matrix>           H_shared;  // shared with the other decoders when the
+	const std::shared_ptr<const tools::Compact_sparse_matrix<>> Hc_shared; // given H is a 'Shared_sparse_matrix'
+	const tools::Sparse_matrix                                 &H;  // In vertical way
+	                                                                // CN are along the columns -> H.get_n_cols() == M (often M=N-K)
+	                                                                // VN are along the rows    -> H.get_n_rows() == N
+	                                                                // automatically transpose in the constructor if needed
+	const tools::Compact_sparse_matrix<>                       &Hc; // same connections as H, stored contiguously (CSR/CSC)
+	                                                                // for the hot loops
 
 	// data structures for iterative decoding
 	std::vector<B> var_nodes;
@@ -47,7 +47,7 @@ bool Decoder_LDPC_bit_flipping_OMWBF<B,R>
 		synd[i] = 0;
 
 		for (auto j = 0; j < this->n_variables_per_parity[i]; ++j)
-			synd[i] ^= this->decis[this->H.get_rows_from_col(i).at(j)];
+			synd[i] ^= this->decis[this->Hc.get_rows_from_col(i)[j]];
 
 		syndrome |= (synd[i] != 0);
 	}
@@ -57,7 +57,7 @@ bool Decoder_LDPC_bit_flipping_OMWBF<B,R>
 		energy[i] = 0;
 		for (auto j = 0; j < this->n_parities_per_variable[i]; ++j)
 		{
-			auto m = this->H.get_cols_from_row(i)[j];
+			auto m = this->Hc.get_cols_from_row(i)[j];
 			energy[i] += (2 * synd[m] - 1) * this->Y_min[m];
 		}
 		energy[i] -= this->mwbf_factor * (R)std::abs(Y_N[i]);
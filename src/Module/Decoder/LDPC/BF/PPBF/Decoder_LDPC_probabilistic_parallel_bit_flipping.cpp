@@ -54,10 +54,10 @@ void Decoder_LDPC_probabilistic_parallel_bit_flipping<B,R>
 ::cn_process(const B *VN, B *CN, const int frame_id)
 {
 	// for each check nodes
-	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
 	for (auto c = 0; c < n_chk_nodes; c++)
 	{
-		const auto& chk_node = this->H.get_col_to_rows()[c];
+		const auto chk_node = this->Hc.get_rows_from_col(c);
 		const auto chk_degree = chk_node.size();
 
 		CN[c] = 0;
@@ -71,10 +71,10 @@ void Decoder_LDPC_probabilistic_parallel_bit_flipping<B,R>
 ::vn_process(const B *Y_N, B *VN, const B *CN, const int frame_id)
 {
 	// for each variable nodes
-	const auto n_var_nodes = (int)this->H.get_n_rows();
+	const auto n_var_nodes = (int)this->Hc.get_n_rows();
 	for (auto v = 0; v < n_var_nodes; v++)
 	{
-		const auto& var_node = this->H.get_row_to_cols()[v];
+		const auto var_node = this->Hc.get_cols_from_row(v);
 		const auto var_degree = var_node.size();
 
 		auto energy = VN[v] ^ Y_N[v];
@@ -0,0 +1,347 @@
+#include <algorithm>
+#include <sstream>
+
+#include "Tools/Perf/common/hard_decide.h"
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_LDPC_probabilistic_parallel_bit_flipping_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+constexpr size_t Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>::n_words;
+
+template <typename B, typename R>
+constexpr size_t Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>::n_lanes;
+
+// number of bits needed to count up to 'max'
+static size_t n_planes(const unsigned max)
+{
+	size_t n = 1;
+	while ((max >> n) != 0)
+		n++;
+	return n;
+}
+
+template <typename B, typename R>
+Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::Decoder_LDPC_probabilistic_parallel_bit_flipping_inter(const int &K, const int &N, const int& n_ite,
+                                                         const tools::Sparse_matrix &_H,
+                                                         const std::vector<unsigned> &info_bits_pos,
+                                                         const std::vector<float> &bernouilli_probas,
+                                                         const bool enable_syndrome,
+                                                         const int syndrome_depth,
+                                                         const int seed,
+                                                         const int n_frames)
+: Decoder               (K, N, n_frames, (int)n_lanes                                       ),
+  Decoder_SIHO_HIHO<B,R>(K, N, n_frames, (int)n_lanes                                       ),
+  n_ite                 (n_ite                                                              ),
+  enable_syndrome       (enable_syndrome                                                    ),
+  syndrome_depth        (syndrome_depth                                                     ),
+  H_shared              (tools::Shared_sparse_matrix::vertical(_H)                          ),
+  Hc_shared             (tools::Shared_sparse_matrix::compact(*H_shared)                    ),
+  H                     (*H_shared                                                          ),
+  Hc                    (*Hc_shared                                                         ),
+  info_bits_pos         (info_bits_pos                                                      ),
+  thresholds            (bernouilli_probas.size()                                           ),
+  rd_engine             (seed                                                               ),
+  HY_N                  (N                                                                  ),
+  Y                     (N * n_words                                                        ),
+  VN                    (N * n_words                                                        ),
+  CN                    (this->H.get_n_cols() * n_words                                     ),
+  V_frozen              (N * n_words                                                        ),
+  frozen                (n_words                                                            ),
+  cnt                   (n_planes((unsigned)this->H.get_rows_max_degree() +1) * n_words     ),
+  levels                (bernouilli_probas.size() * n_words                                 ),
+  synd_depth            (n_lanes, 0                                                         ),
+  n_cnt_planes          (n_planes((unsigned)this->H.get_rows_max_degree() +1)               )
+{
+	const std::string name = "Decoder_LDPC_probabilistic_parallel_bit_flipping_inter";
+	this->set_name(name);
+
+	if (n_ite <= 0)
+	{
+		std::stringstream message;
+		message << "'n_ite' has to be greater than 0 ('n_ite' = " << n_ite << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (syndrome_depth <= 0)
+	{
+		std::stringstream message;
+		message << "'syndrome_depth' has to be greater than 0 ('syndrome_depth' = " << syndrome_depth << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (N != (int)this->H.get_n_rows())
+	{
+		std::stringstream message;
+		message << "'N' is not compatible with the H matrix ('N' = " << N << ", 'H.get_n_rows()' = "
+		        << this->H.get_n_rows() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (bernouilli_probas.size() != (this->H.get_rows_max_degree() + 2))
+	{
+		std::stringstream message;
+		message << "'bernouilli_probas.size()' must be equal to the biggest variable node degree plus 2"
+		        << "('bernouilli_probas.size() = '" << bernouilli_probas.size() << ", 'variable node max degree' = "
+		        << this->H.get_rows_max_degree() << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (size_t e = 0; e < bernouilli_probas.size(); e++)
+	{
+		const auto p = bernouilli_probas[e];
+		thresholds[e] = p <= 0.f ? (uint64_t)0 :
+		                p >= 1.f ? (uint64_t)1 << 32 :
+		                           std::min((uint64_t)((double)p * 4294967296.), ((uint64_t)1 << 32) -1);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::_load(const B *Y_N)
+{
+	std::fill(this->Y.begin(), this->Y.end(), (W)0);
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto v = 0; v < this->N; v++)
+			this->Y[v * n_words + f / 64] |= (W)(Y_N[f * this->N + v] != 0) << (f % 64);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N);
+	this->_decode();
+
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto i = 0; i < this->K; i++)
+			V_K[f * this->K + i] = (B)((this->V_frozen[this->info_bits_pos[i] * n_words + f / 64] >> (f % 64)) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N);
+	this->_decode();
+
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto v = 0; v < this->N; v++)
+			V_N[f * this->N + v] = (B)((this->V_frozen[v * n_words + f / 64] >> (f % 64)) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	std::fill(this->Y.begin(), this->Y.end(), (W)0);
+	for (size_t f = 0; f < n_lanes; f++)
+	{
+		tools::hard_decide(Y_N + f * this->N, this->HY_N.data(), this->N);
+		for (auto v = 0; v < this->N; v++)
+			this->Y[v * n_words + f / 64] |= (W)(this->HY_N[v] != 0) << (f % 64);
+	}
+
+	this->_decode();
+
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto i = 0; i < this->K; i++)
+			V_K[f * this->K + i] = (B)((this->V_frozen[this->info_bits_pos[i] * n_words + f / 64] >> (f % 64)) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	std::fill(this->Y.begin(), this->Y.end(), (W)0);
+	for (size_t f = 0; f < n_lanes; f++)
+	{
+		tools::hard_decide(Y_N + f * this->N, this->HY_N.data(), this->N);
+		for (auto v = 0; v < this->N; v++)
+			this->Y[v * n_words + f / 64] |= (W)(this->HY_N[v] != 0) << (f % 64);
+	}
+
+	this->_decode();
+
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto v = 0; v < this->N; v++)
+			V_N[f * this->N + v] = (B)((this->V_frozen[v * n_words + f / 64] >> (f % 64)) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::_decode()
+{
+	std::copy(this->Y.begin(), this->Y.end(), this->VN.begin());
+	std::fill(this->V_frozen  .begin(), this->V_frozen  .end(), (W)0);
+	std::fill(this->frozen    .begin(), this->frozen    .end(), (W)0);
+	std::fill(this->synd_depth.begin(), this->synd_depth.end(), 0   );
+
+	// same steps as 'Decoder_LDPC_bit_flipping_hard::decode' for each frame
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		if (this->is_cancelled()) // the frames will be thrown away
+			break;
+
+		this->cn_process();
+
+		if (this->enable_syndrome && this->_freeze_valid_frames())
+			return;
+
+		this->vn_process();
+	}
+
+	// the frames which are not frozen take the decisions of the last iteration
+	for (auto v = 0; v < this->N; v++)
+		for (size_t w = 0; w < n_words; w++)
+			this->V_frozen[v * n_words + w] |= this->VN[v * n_words + w] & ~this->frozen[w];
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::cn_process()
+{
+	// for each check nodes
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		auto CN = this->CN.data() + c * n_words;
+
+		std::fill(CN, CN + n_words, (W)0);
+		for (auto v : this->Hc.get_rows_from_col(c))
+			for (size_t w = 0; w < n_words; w++)
+				CN[w] ^= this->VN[v * n_words + w];
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::vn_process()
+{
+	const auto n_levels = this->thresholds.size();
+	const auto one      = (uint64_t)1 << 32;
+
+	// for each variable nodes
+	const auto n_var_nodes = (int)this->Hc.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		auto VN = this->VN.data() + v * n_words;
+
+		// energy = (VN ^ Y) + the number of unsatisfied check nodes, for each frame
+		std::fill(this->cnt.begin(), this->cnt.end(), (W)0);
+		for (size_t w = 0; w < n_words; w++)
+		{
+			auto carry = VN[w] ^ this->Y[v * n_words + w];
+			for (size_t p = 0; p < this->n_cnt_planes && carry; p++)
+			{
+				const auto c = this->cnt[p * n_words + w] & carry;
+				this->cnt[p * n_words + w] ^= carry;
+				carry = c;
+			}
+		}
+		for (auto c : this->Hc.get_cols_from_row(v))
+			for (size_t w = 0; w < n_words; w++)
+			{
+				auto carry = this->CN[c * n_words + w];
+				for (size_t p = 0; p < this->n_cnt_planes && carry; p++)
+				{
+					const auto cc = this->cnt[p * n_words + w] & carry;
+					this->cnt[p * n_words + w] ^= carry;
+					carry = cc;
+				}
+			}
+
+		for (size_t w = 0; w < n_words; w++)
+		{
+			// the frames of each energy level, the frames which always flip and the frames to draw
+			W flip = 0, undecided = 0;
+			for (size_t e = 0; e < n_levels; e++)
+			{
+				auto eq = ~(W)0;
+				for (size_t p = 0; p < this->n_cnt_planes; p++)
+				{
+					const auto c = this->cnt[p * n_words + w];
+					eq &= ((e >> p) & 1) ? c : ~c;
+				}
+				if (this->n_cnt_planes < 32 && (e >> this->n_cnt_planes))
+					eq = 0;
+
+				this->levels[e * n_words + w] = eq;
+				     if (this->thresholds[e] == one) flip      |= eq;
+				else if (this->thresholds[e] != 0  ) undecided |= eq;
+			}
+
+			// compare a random number to the probability of the energy level of each frame, from the MSB to the LSB,
+			// one PRNG word draws one bit of the random numbers of 64 frames
+			for (auto b = 31; b >= 0 && undecided; b--)
+			{
+				W proba_bit = 0;
+				for (size_t e = 0; e < n_levels; e++)
+					if ((this->thresholds[e] >> b) & 1)
+						proba_bit |= this->levels[e * n_words + w];
+
+				const W rand_bit = (W)this->rd_engine();
+				flip      |= undecided & proba_bit & ~rand_bit; // random number < probability
+				undecided &= ~(proba_bit ^ rand_bit);
+			}
+
+			VN[w] ^= flip;
+		}
+	}
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::_freeze_valid_frames()
+{
+	// the frames with at least one unsatisfied check node
+	W unsat[n_words] = {};
+
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+		for (size_t w = 0; w < n_words; w++)
+			unsat[w] |= this->CN[c * n_words + w];
+
+	// same rule as 'Decoder_LDPC_bit_flipping_hard::decode' for each frame
+	W newly_frozen[n_words] = {};
+	for (size_t f = 0; f < n_lanes; f++)
+	{
+		const auto mask = (W)1 << (f % 64);
+		if (this->frozen[f / 64] & mask)
+			continue;
+
+		const auto valid = !(unsat[f / 64] & mask);
+		this->synd_depth[f] = valid ? this->synd_depth[f] +1 : 0;
+		if (this->synd_depth[f] >= this->syndrome_depth)
+			newly_frozen[f / 64] |= mask;
+	}
+
+	auto all_frozen = true;
+	for (size_t w = 0; w < n_words; w++)
+	{
+		this->frozen[w] |= newly_frozen[w];
+		all_frozen &= this->frozen[w] == ~(W)0;
+	}
+
+	for (auto v = 0; v < this->N; v++)
+		for (size_t w = 0; w < n_words; w++)
+			this->V_frozen[v * n_words + w] |= this->VN[v * n_words + w] & newly_frozen[w];
+
+	return all_frozen;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
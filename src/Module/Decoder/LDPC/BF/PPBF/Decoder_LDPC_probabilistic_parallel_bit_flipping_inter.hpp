@@ -0,0 +1,98 @@
+#ifndef DECODER_LDPC_PROBABILISTIC_PARALLEL_BIT_FLIPPING_INTER_HPP_
+#define DECODER_LDPC_PROBABILISTIC_PARALLEL_BIT_FLIPPING_INTER_HPP_
+
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <mipp.h>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Compact_sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Shared_sparse_matrix.hpp"
+
+#include "../../../Decoder_SIHO_HIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Bit-sliced PPBF decoder: a variable node or a check node is stored in 'n_words' 64-bit words which hold its value
+ * for 'n_lanes' = 64 * 'n_words' frames (one bit per frame). The energies of a variable node are counted with a
+ * bit-sliced adder and each frame flips its bit with the Bernouilli probability of its own energy: a random number is
+ * drawn for each frame one bit at a time (one PRNG word per 64 frames and per bit) and compared to the probability
+ * of the frame, until all the comparisons are decided.
+ *
+ * The frames are frozen when their syndrome is valid and the decoding stops when all the frames are frozen.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_probabilistic_parallel_bit_flipping_inter : public Decoder_SIHO_HIHO<B,R>
+{
+public:
+	using W = uint64_t;
+	static constexpr size_t n_words = (size_t)mipp::N<int64_t>();
+	static constexpr size_t n_lanes = 64 * n_words;
+
+protected:
+	const int  n_ite;      // number of iterations to perform
+	const bool enable_syndrome;
+	const int  syndrome_depth;
+
+	const std::shared_ptr<const tools::Sparse_matrix>           H_shared;  // shared with the other decoders when the
+	const std::shared_ptr<const tools::Compact_sparse_matrix<>> Hc_shared; // given H is a 'Shared_sparse_matrix'
+	const tools::Sparse_matrix                                 &H;  // In vertical way (VN are along the rows)
+	const tools::Compact_sparse_matrix<>                       &Hc; // same connections as H, stored contiguously
+	                                                                // (CSR/CSC) for the hot loops
+
+	const std::vector<unsigned> &info_bits_pos;
+
+	// the Bernouilli probability of each energy level in 32-bit fixed-point (2^32 means that the bit always flips)
+	std::vector<uint64_t> thresholds;
+
+	std::mt19937_64 rd_engine; // Mersenne Twister 19937 (64-bit words)
+
+	std::vector<B> HY_N;        // hard decisions of one frame
+	std::vector<W> Y;           // hard decisions of the channel       (N words groups)
+	std::vector<W> VN;          // variable nodes                       (N words groups)
+	std::vector<W> CN;          // check nodes                          (M words groups)
+	std::vector<W> V_frozen;    // decisions of the frozen frames       (N words groups)
+	std::vector<W> frozen;      // mask of the frozen frames            (1 words group )
+	std::vector<W> cnt;         // bit-sliced energy of a variable node (one words group per bit)
+	std::vector<W> levels;      // mask of the frames of each energy level
+	std::vector<int> synd_depth; // number of consecutive valid syndromes of each frame
+	const size_t n_cnt_planes;
+
+public:
+	Decoder_LDPC_probabilistic_parallel_bit_flipping_inter(const int &K, const int &N, const int& n_ite,
+	                                                       const tools::Sparse_matrix &H,
+	                                                       const std::vector<unsigned> &info_bits_pos,
+	                                                       const std::vector<float> &bernouilli_probas,
+	                                                       const bool enable_syndrome = true,
+	                                                       const int syndrome_depth = 1,
+	                                                       const int seed = 0,
+	                                                       const int n_frames = 1);
+	virtual ~Decoder_LDPC_probabilistic_parallel_bit_flipping_inter() = default;
+
+protected:
+	void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
+	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+
+	void _load  (const B *Y_N);
+	void _decode(            );
+
+	void cn_process();
+	void vn_process();
+
+	// freeze the frames with a valid syndrome, return true when all the frames are frozen
+	bool _freeze_valid_frames();
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_PPBF_inter = Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>;
+
+}
+}
+
+#endif /* DECODER_LDPC_PROBABILISTIC_PARALLEL_BIT_FLIPPING_INTER_HPP_ */
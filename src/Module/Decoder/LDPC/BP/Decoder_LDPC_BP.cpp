@@ -12,31 +12,56 @@ Decoder_LDPC_BP
                   const tools::Sparse_matrix &_H,
                   const bool enable_syndrome,
                   const int syndrome_depth)
-: n_ite             (n_ite                                       ),
-  H                 (_H.turn(tools::Sparse_matrix::Way::VERTICAL)),
-  enable_syndrome   (enable_syndrome                             ),
-  syndrome_depth    (syndrome_depth                              ),
-  cur_syndrome_depth(0                                           )
+: n_ite             (n_ite                                          ),
+  H_shared          (tools::Shared_sparse_matrix::vertical(_H)      ),
+  Hc_shared         (tools::Shared_sparse_matrix::compact(*H_shared)),
+  H                 (*H_shared                                      ),
+  Hc                (*Hc_shared                                     ),
+  enable_syndrome   (enable_syndrome                                ),
+  syndrome_depth    (syndrome_depth                                 ),
+  cur_syndrome_depth(0                                              )
 {
-	if (n_ite <= 0)
+	this->check_parameters();
+
+	if (N != (int)this->H.get_n_rows())
 	{
 		std::stringstream message;
-		message << "'n_ite' has to be greater than 0 ('n_ite' = " << n_ite << ").";
+		message << "'N' is not compatible with the H matrix ('N' = " << N << ", 'H.get_n_rows()' = "
+		        << this->H.get_n_rows() << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
+}
 
-	if (syndrome_depth <= 0)
+Decoder_LDPC_BP
+::Decoder_LDPC_BP(const int K, const int N, const int n_ite,
+                  const bool enable_syndrome,
+                  const int syndrome_depth)
+: n_ite             (n_ite                                                             ),
+  H_shared          (std::make_shared<const tools::Sparse_matrix>()                    ),
+  Hc_shared         (std::make_shared<const tools::Compact_sparse_matrix<>>(*H_shared)),
+  H                 (*H_shared                                                         ),
+  Hc                (*Hc_shared                                                        ),
+  enable_syndrome   (enable_syndrome                                                   ),
+  syndrome_depth    (syndrome_depth                                                    ),
+  cur_syndrome_depth(0                                                                 )
+{
+	this->check_parameters();
+}
+
+void Decoder_LDPC_BP
+::check_parameters() const
+{
+	if (n_ite <= 0)
 	{
 		std::stringstream message;
-		message << "'syndrome_depth' has to be greater than 0 ('syndrome_depth' = " << syndrome_depth << ").";
+		message << "'n_ite' has to be greater than 0 ('n_ite' = " << n_ite << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (N != (int)this->H.get_n_rows())
+	if (syndrome_depth <= 0)
 	{
 		std::stringstream message;
-		message << "'N' is not compatible with the H matrix ('N' = " << N << ", 'H.get_n_rows()' = "
-		        << this->H.get_n_rows() << ").";
+		message << "'syndrome_depth' has to be greater than 0 ('syndrome_depth' = " << syndrome_depth << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define DECODER_LDPC_BP_HPP_
 
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Compact_sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Shared_sparse_matrix.hpp"
 #include "Tools/Code/LDPC/Syndrome/LDPC_syndrome.hpp"
 
 namespace aff3ct
@@ -11,13 +13,17 @@ namespace module
 class Decoder_LDPC_BP
 {
 protected:
-	const int                   n_ite;
-	const tools::Sparse_matrix  H; // In vertical way
-	                               // CN are along the columns -> H.get_n_cols() == M (often M=N-K)
-	                               // VN are along the rows    -> H.get_n_rows() == N
-	                               // automatically transpose in the constructor if needed
-	const bool                  enable_syndrome;
-	const int                   syndrome_depth;
+	const int                                                   n_ite;
+	const std::shared_ptr<const tools::Sparse_matrix>           H_shared;  // shared with the other decoders when the
+	const std::shared_ptr<const tools::Compact_sparse_matrix<>> Hc_shared; // given H is a 'Shared_sparse_matrix'
+	const tools::Sparse_matrix                                 &H;  // In vertical way
+	                                                                // CN are along the columns -> H.get_n_cols() == M (often M=N-K)
+	                                                                // VN are along the rows    -> H.get_n_rows() == N
+	                                                                // automatically transpose in the constructor if needed
+	const tools::Compact_sparse_matrix<>                       &Hc; // same connections as H, stored contiguously (CSR/CSC)
+	                                                                // for the hot loops
+	const bool                                                  enable_syndrome;
+	const int                                                   syndrome_depth;
 
 	int cur_syndrome_depth;
 
@@ -27,6 +33,11 @@ public:
 	                const bool enable_syndrome = true,
 	                const int syndrome_depth = 1);
 
+	// for the decoders which walk through the circulants of a QC matrix: H and Hc are left empty
+	Decoder_LDPC_BP(const int K, const int N, const int n_ite,
+	                const bool enable_syndrome,
+	                const int syndrome_depth);
+
 	virtual ~Decoder_LDPC_BP() = default;
 
 	template <typename R>
@@ -34,7 +45,7 @@ public:
 	{
 		if (this->enable_syndrome)
 		{
-			const auto syndrome = tools::LDPC_syndrome::check_soft(Y_N, this->H);
+			const auto syndrome = tools::LDPC_syndrome::check_soft(Y_N, this->Hc);
 			this->cur_syndrome_depth = syndrome ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
 			return syndrome && (this->cur_syndrome_depth == 0);
 		}
@@ -47,13 +58,16 @@ public:
 	{
 		if (this->enable_syndrome)
 		{
-			const auto syndrome = tools::LDPC_syndrome::check_hard(V_N, this->H);
+			const auto syndrome = tools::LDPC_syndrome::check_hard(V_N, this->Hc);
 			this->cur_syndrome_depth = syndrome ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
 			return syndrome && (this->cur_syndrome_depth == 0);
 		}
 		else
 			return false;
 	}
+
+private:
+	void check_parameters() const;
 };
 }
 }
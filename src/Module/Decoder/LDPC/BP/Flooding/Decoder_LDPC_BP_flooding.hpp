@@ -1,7 +1,11 @@
 #ifndef DECODER_LDPC_BP_FLOODING_HPP_
 #define DECODER_LDPC_BP_FLOODING_HPP_
 
+#include <atomic>
+#include <memory>
+
 #include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
+#include "Tools/Threads/Thread_team.hpp"
 
 #include "../../../Decoder_SISO_SIHO.hpp"
 #include "../Decoder_LDPC_BP.hpp"
@@ -25,6 +29,13 @@ protected:
 
 	bool init_flag; // reset the msg_chk_to_var vector at the begining of the iterative decoding
 
+	// intra-frame multi-threading: each thread updates a range of variable nodes and a range of check nodes
+	std::unique_ptr<tools::Thread_team> team;
+	std::vector<Update_rule           > up_rules;   // one update rule per thread
+	std::vector<size_t                > var_ranges; // the variable nodes of the thread 't' are [var_ranges[t];var_ranges[t+1][
+	std::vector<size_t                > chk_ranges; // the check    nodes of the thread 't' are [chk_ranges[t];chk_ranges[t+1][
+	std::atomic<int                   > team_flags[3];
+
 public:
 	Decoder_LDPC_BP_flooding(const int K, const int N, const int n_ite,
 	                         const tools::Sparse_matrix &H,
@@ -32,7 +43,8 @@ public:
 	                         const Update_rule &up_rule,
 	                         const bool enable_syndrome = true,
 	                         const int syndrome_depth = 1,
-	                         const int n_frames = 1);
+	                         const int n_frames = 1,
+	                         const int n_threads = 1);
 	virtual ~Decoder_LDPC_BP_flooding() = default;
 	void reset();
 
@@ -42,9 +54,19 @@ protected:
 	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
 
 	        void _decode               (const R *Y_N, const int frame_id);
+	        void _decode_team          (const R *Y_N, const int frame_id);
 	        void _initialize_var_to_chk(const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &msg_var_to_chk);
 	virtual void _decode_single_ite    (              const std::vector<R> &msg_var_to_chk, std::vector<R> &msg_chk_to_var);
 	        void _compute_post         (const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &post);
+
+	// the same computations on a range of variable nodes or of check nodes
+	void _initialize_var_to_chk(const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &msg_var_to_chk,
+	                            const int v_first, const int v_last);
+	void _update_chk_nodes     (Update_rule &up_rule, const std::vector<R> &msg_var_to_chk,
+	                            std::vector<R> &msg_chk_to_var, const int c_first, const int c_last);
+	void _compute_post         (const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &post,
+	                            const int v_first, const int v_last);
+	bool _check_syndrome_soft  (const std::vector<R> &post, const int c_first, const int c_last);
 };
 }
 }
@@ -20,7 +20,8 @@ Decoder_LDPC_BP_flooding<B,R,Update_rule>
                            const Update_rule &up_rule,
                            const bool enable_syndrome,
                            const int syndrome_depth,
-                           const int n_frames)
+                           const int n_frames,
+                           const int n_threads)
 : Decoder               (K, N, n_frames, 1                                    ),
   Decoder_SISO_SIHO<B,R>(K, N, n_frames, 1                                    ),
   Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth     ),
@@ -35,6 +36,29 @@ Decoder_LDPC_BP_flooding<B,R,Update_rule>
 	const std::string name = "Decoder_LDPC_BP_flooding<" + this->up_rule.get_name() + ">";
 	this->set_name(name);
 
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto &f : this->team_flags)
+		f = 0;
+
+	if (n_threads > 1)
+	{
+		this->team.reset(new tools::Thread_team((size_t)n_threads));
+		for (auto t = 0; t < n_threads; t++)
+			this->up_rules.push_back(up_rule);
+
+		// the ranges are balanced on the number of connections
+		this->var_ranges = tools::Thread_team::split(this->Hc.get_n_rows(), (size_t)n_threads,
+		                                             [this](const size_t v) { return this->Hc.get_row_offset(v); });
+		this->chk_ranges = tools::Thread_team::split(this->Hc.get_n_cols(), (size_t)n_threads,
+		                                             [this](const size_t c) { return this->Hc.get_col_offset(c); });
+	}
+
 	mipp::vector<unsigned char> connections(this->H.get_n_rows(), 0);
 
 	const auto &msg_chk_to_var_id = this->H.get_col_to_rows();
@@ -162,11 +186,20 @@ template <typename B, typename R, class Update_rule>
 void Decoder_LDPC_BP_flooding<B,R,Update_rule>
 ::_decode(const R *Y_N, const int frame_id)
 {
+	if (this->team != nullptr)
+	{
+		this->_decode_team(Y_N, frame_id);
+		return;
+	}
+
 	this->up_rule.begin_decoding(this->n_ite);
 
 	auto ite = 0;
 	for (; ite < this->n_ite; ite++)
 	{
+		if (this->is_cancelled()) // the frame will be thrown away
+			break;
+
 		this->up_rule.begin_ite(ite);
 		this->_initialize_var_to_chk(Y_N, this->msg_chk_to_var[frame_id], this->msg_var_to_chk[frame_id]);
 		this->_decode_single_ite(this->msg_var_to_chk[frame_id], this->msg_chk_to_var[frame_id]);
@@ -185,17 +218,105 @@ void Decoder_LDPC_BP_flooding<B,R,Update_rule>
 	this->up_rule.end_decoding();
 }
 
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding<B,R,Update_rule>
+::_decode_team(const R *Y_N, const int frame_id)
+{
+	if (this->is_cancelled()) // the frame will be thrown away
+		return;
+
+	auto &msg_chk_to_var = this->msg_chk_to_var[frame_id];
+	auto &msg_var_to_chk = this->msg_var_to_chk[frame_id];
+
+	constexpr int unsat  = 1; // a parity check is not verified in the range of a thread
+	constexpr int cancel = 2; // the frame will be thrown away
+
+	for (auto &f : this->team_flags)
+		f = 0;
+
+	const auto syndrome_depth = this->cur_syndrome_depth;
+	this->team->run([&](const size_t tid)
+	{
+		auto &up_rule = this->up_rules[tid];
+		const auto v_first = (int)this->var_ranges[tid], v_last = (int)this->var_ranges[tid +1];
+		const auto c_first = (int)this->chk_ranges[tid], c_last = (int)this->chk_ranges[tid +1];
+
+		// all the threads take the same decisions from the shared flags
+		auto cur_syndrome_depth = syndrome_depth;
+
+		up_rule.begin_decoding(this->n_ite);
+
+		auto ite = 0;
+		for (; ite < this->n_ite; ite++)
+		{
+			// the flags of the iteration 'ite' are in 'team_flags[ite % 3]', the flags of the next iteration can be
+			// reset here: nobody reads them anymore (they were used two iterations ago) and nobody writes them before
+			// the next barrier
+			auto &flags = this->team_flags[ite % 3];
+			if (tid == 0)
+				this->team_flags[(ite +1) % 3] = 0;
+
+			up_rule.begin_ite(ite);
+			this->_initialize_var_to_chk(Y_N, msg_chk_to_var, msg_var_to_chk, v_first, v_last);
+			this->team->barrier();
+			this->_update_chk_nodes(up_rule, msg_var_to_chk, msg_chk_to_var, c_first, c_last);
+			up_rule.end_ite();
+
+			const auto check = this->enable_syndrome && ite != this->n_ite -1;
+			if (check)
+			{
+				this->team->barrier();
+				this->_compute_post(Y_N, msg_chk_to_var, this->post, v_first, v_last);
+				this->team->barrier();
+				if (!this->_check_syndrome_soft(this->post, c_first, c_last))
+					flags.fetch_or(unsat);
+			}
+
+			if (tid == 0 && this->is_cancelled())
+				flags.fetch_or(cancel);
+
+			this->team->barrier();
+
+			const auto f = flags.load();
+			if (f & cancel)
+				break;
+
+			if (check)
+			{
+				const auto syndrome = !(f & unsat);
+				cur_syndrome_depth = syndrome ? (cur_syndrome_depth +1) % this->syndrome_depth : 0;
+				if (syndrome && cur_syndrome_depth == 0)
+					break;
+			}
+		}
+		if (ite == this->n_ite)
+			this->_compute_post(Y_N, msg_chk_to_var, this->post, v_first, v_last);
+
+		up_rule.end_decoding();
+
+		if (tid == 0)
+			this->cur_syndrome_depth = cur_syndrome_depth;
+	});
+}
+
 template <typename B, typename R, class Update_rule>
 void Decoder_LDPC_BP_flooding<B,R,Update_rule>
 ::_initialize_var_to_chk(const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &msg_var_to_chk)
 {
-	auto *msg_chk_to_var_ptr = msg_chk_to_var.data();
-	auto *msg_var_to_chk_ptr = msg_var_to_chk.data();
+	this->_initialize_var_to_chk(Y_N, msg_chk_to_var, msg_var_to_chk, 0, (int)this->Hc.get_n_rows());
+}
 
-	const auto n_var_nodes = (int)this->H.get_n_rows();;
-	for (auto v = 0; v < n_var_nodes; v++)
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding<B,R,Update_rule>
+::_initialize_var_to_chk(const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &msg_var_to_chk,
+                         const int v_first, const int v_last)
+{
+	auto *msg_chk_to_var_ptr = msg_chk_to_var.data() + this->Hc.get_row_offset(v_first);
+	auto *msg_var_to_chk_ptr = msg_var_to_chk.data() + this->Hc.get_row_offset(v_first);
+
+	for (auto v = v_first; v < v_last; v++)
 	{
-		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto var_degree = (int)this->Hc.get_row_degree(v);
 
 		auto sum_msg_chk_to_var = (R)0;
 		for (auto c = 0; c < var_degree; c++)
@@ -214,23 +335,30 @@ template <typename B, typename R, class Update_rule>
 void Decoder_LDPC_BP_flooding<B,R,Update_rule>
 ::_decode_single_ite(const std::vector<R> &msg_var_to_chk, std::vector<R> &msg_chk_to_var)
 {
-	auto transpose_ptr = this->transpose.data();
+	this->_update_chk_nodes(this->up_rule, msg_var_to_chk, msg_chk_to_var, 0, (int)this->Hc.get_n_cols());
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding<B,R,Update_rule>
+::_update_chk_nodes(Update_rule &up_rule, const std::vector<R> &msg_var_to_chk, std::vector<R> &msg_chk_to_var,
+                    const int c_first, const int c_last)
+{
+	auto transpose_ptr = this->transpose.data() + this->Hc.get_col_offset(c_first);
 
 	// flooding scheduling
-	const auto n_chk_nodes = (int)this->H.get_n_cols();
-	for (auto c = 0; c < n_chk_nodes; c++)
+	for (auto c = c_first; c < c_last; c++)
 	{
-		const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+		const auto chk_degree = (int)this->Hc.get_col_degree(c);
 
-		this->up_rule.begin_chk_node_in(c, chk_degree);
+		up_rule.begin_chk_node_in(c, chk_degree);
 		for (auto v = 0; v < chk_degree; v++)
-			this->up_rule.compute_chk_node_in(v, msg_var_to_chk[transpose_ptr[v]]);
-		this->up_rule.end_chk_node_in();
+			up_rule.compute_chk_node_in(v, msg_var_to_chk[transpose_ptr[v]]);
+		up_rule.end_chk_node_in();
 
-		this->up_rule.begin_chk_node_out(c, chk_degree);
+		up_rule.begin_chk_node_out(c, chk_degree);
 		for (auto v = 0; v < chk_degree; v++)
-			msg_chk_to_var[transpose_ptr[v]] = this->up_rule.compute_chk_node_out(v, msg_var_to_chk[transpose_ptr[v]]);
-		this->up_rule.end_chk_node_out();
+			msg_chk_to_var[transpose_ptr[v]] = up_rule.compute_chk_node_out(v, msg_var_to_chk[transpose_ptr[v]]);
+		up_rule.end_chk_node_out();
 
 		transpose_ptr += chk_degree;
 	}
@@ -239,13 +367,20 @@ void Decoder_LDPC_BP_flooding<B,R,Update_rule>
 template <typename B, typename R, class Update_rule>
 void Decoder_LDPC_BP_flooding<B,R,Update_rule>
 ::_compute_post(const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &post)
+{
+	this->_compute_post(Y_N, msg_chk_to_var, post, 0, (int)this->Hc.get_n_rows());
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding<B,R,Update_rule>
+::_compute_post(const R *Y_N, const std::vector<R> &msg_chk_to_var, std::vector<R> &post,
+                const int v_first, const int v_last)
 {
 	// compute the a posteriori info
-	const auto *msg_chk_to_var_ptr = msg_chk_to_var.data();
-	const auto n_var_nodes = (int)this->H.get_n_rows();;
-	for (auto v = 0; v < n_var_nodes; v++)
+	const auto *msg_chk_to_var_ptr = msg_chk_to_var.data() + this->Hc.get_row_offset(v_first);
+	for (auto v = v_first; v < v_last; v++)
 	{
-		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto var_degree = (int)this->Hc.get_row_degree(v);
 
 		auto sum_msg_chk_to_var = (R)0;
 		for (auto c = 0; c < var_degree; c++)
@@ -257,5 +392,22 @@ void Decoder_LDPC_BP_flooding<B,R,Update_rule>
 		msg_chk_to_var_ptr += var_degree;
 	}
 }
+
+template <typename B, typename R, class Update_rule>
+bool Decoder_LDPC_BP_flooding<B,R,Update_rule>
+::_check_syndrome_soft(const std::vector<R> &post, const int c_first, const int c_last)
+{
+	for (auto c = c_first; c < c_last; c++)
+	{
+		auto sign = 0;
+		for (auto v : this->Hc[c])
+			sign ^= (post[v] < 0) ? 1 : 0;
+
+		if (sign)
+			return false;
+	}
+
+	return true;
+}
+}
 }
-}
\ No newline at end of file
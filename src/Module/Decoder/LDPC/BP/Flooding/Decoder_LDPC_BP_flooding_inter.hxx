@@ -216,6 +216,9 @@ void Decoder_LDPC_BP_flooding_inter<B,R,Update_rule>
 	auto ite = 0;
 	for (; ite < this->n_ite; ite++)
 	{
+		if (this->is_cancelled()) // the frame will be thrown away
+			break;
+
 		this->up_rule.begin_ite(ite);
 		this->_initialize_var_to_chk(Y_N, this->msg_chk_to_var[cur_wave], this->msg_var_to_chk[cur_wave]);
 		this->_decode_single_ite(this->msg_var_to_chk[cur_wave], this->msg_chk_to_var[cur_wave]);
@@ -243,10 +246,10 @@ void Decoder_LDPC_BP_flooding_inter<B,R,Update_rule>
 	auto *msg_chk_to_var_ptr = msg_chk_to_var.data();
 	auto *msg_var_to_chk_ptr = msg_var_to_chk.data();
 
-	const auto n_var_nodes = (int)this->H.get_n_rows();;
+	const auto n_var_nodes = (int)this->Hc.get_n_rows();
 	for (auto v = 0; v < n_var_nodes; v++)
 	{
-		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto var_degree = (int)this->Hc.get_row_degree(v);
 
 		auto sum_msg_chk_to_var = mipp::Reg<R>((R)0);
 		for (auto c = 0; c < var_degree; c++)
@@ -268,10 +271,10 @@ void Decoder_LDPC_BP_flooding_inter<B,R,Update_rule>
 	auto transpose_ptr = this->transpose.data();
 
 	// flooding scheduling
-	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
 	for (auto c = 0; c < n_chk_nodes; c++)
 	{
-		const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+		const auto chk_degree = (int)this->Hc.get_col_degree(c);
 
 		this->up_rule.begin_chk_node_in(c, chk_degree);
 		for (auto v = 0; v < chk_degree; v++)
@@ -298,10 +301,10 @@ void Decoder_LDPC_BP_flooding_inter<B,R,Update_rule>
 {
 	// compute the a posteriori info
 	const auto *msg_chk_to_var_ptr = msg_chk_to_var.data();
-	const auto n_var_nodes = (int)this->H.get_n_rows();;
+	const auto n_var_nodes = (int)this->Hc.get_n_rows();
 	for (auto v = 0; v < n_var_nodes; v++)
 	{
-		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto var_degree = (int)this->Hc.get_row_degree(v);
 
 		auto sum_msg_chk_to_var = mipp::Reg<R>((R)0);
 		for (auto c = 0; c < var_degree; c++)
@@ -321,16 +324,17 @@ bool Decoder_LDPC_BP_flooding_inter<B,R,Update_rule>
 	const auto zero = mipp::Msk<mipp::N<B>()>(false);
 	auto syndrome = zero;
 
-	auto n_chk_nodes = (int)H.get_n_cols();
+	auto n_chk_nodes = (int)this->Hc.get_n_cols();
 	auto c = 0;
 	auto syndrome_scalar = true;
 	while (c < n_chk_nodes && (syndrome_scalar = mipp::testz(syndrome)))
 	{
 		auto sign = zero;
-		const auto chk_degree = (int)this->H[c].size();
+		const auto chk_node   = this->Hc[c];
+		const auto chk_degree = (int)chk_node.size();
 		for (auto v = 0; v < chk_degree; v++)
 		{
-			const auto value = var_nodes[this->H[c][v]];
+			const auto value = var_nodes[chk_node[v]];
 			sign ^= mipp::sign(value);
 		}
 
@@ -169,10 +169,10 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 	auto var_to_chk_ptr = var_to_chk.data();
 
 	// for each variable nodes
-	const auto n_var_nodes = (int)this->H.get_n_rows();
+	const auto n_var_nodes = (int)this->Hc.get_n_rows();
 	for (auto v = 0; v < n_var_nodes; v++)
 	{
-		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto var_degree = (int)this->Hc.get_row_degree(v);
 
 		for (auto c = 0; c < var_degree; c++)
 		{
@@ -202,10 +202,10 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 	auto transpose_ptr = this->transpose.data();
 
 	// for each check nodes
-	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
 	for (auto c = 0; c < n_chk_nodes; c++)
 	{
-		const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+		const auto chk_degree = (int)this->Hc.get_col_degree(c);
 
 		auto acc = 0;
 		for (auto v = 0; v < chk_degree; v++)
@@ -225,10 +225,10 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 	auto chk_to_var_ptr = this->chk_to_var.data();
 
 	// for the K variable nodes (make a majority vote with the entering messages)
-	const auto n_var_nodes = (int)this->H.get_n_rows();
+	const auto n_var_nodes = (int)this->Hc.get_n_rows();
 	for (auto v = 0; v < n_var_nodes; v++)
 	{
-		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto var_degree = (int)this->Hc.get_row_degree(v);
 		auto count = 0;
 
 		for (auto c = 0; c < var_degree; c++)
@@ -0,0 +1,111 @@
+#include <algorithm>
+
+#include "Decoder_LDPC_BP_flooding_Gallager_A_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::Decoder_LDPC_BP_flooding_Gallager_A_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
+                                            const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
+                                            const int syndrome_depth, const int n_frames)
+: Decoder(K, N, n_frames, (int)Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::n_lanes),
+  Decoder_LDPC_BP_flooding_Gallager_inter<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth,
+                                               n_frames),
+  prefix      ((this->Hc.get_rows_max_degree() +1) * this->n_words),
+  cnt         (this->n_planes((unsigned)this->Hc.get_rows_max_degree() +1) * this->n_words),
+  n_cnt_planes(this->n_planes((unsigned)this->Hc.get_rows_max_degree() +1))
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_A_inter";
+	this->set_name(name);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::_initialize_var_to_chk(const int ite)
+{
+	constexpr auto n_words = Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::n_words;
+
+	// for each variable nodes
+	const auto n_var_nodes = (int)this->Hc.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto var_degree = (int)this->Hc.get_row_degree(v);
+		const auto Y          = this->Y.data() + v * n_words;
+		const auto chk_to_var = this->chk_to_var.data() + this->Hc.get_row_offset(v) * n_words;
+		      auto var_to_chk = this->var_to_chk.data() + this->Hc.get_row_offset(v) * n_words;
+
+		if (ite == 0)
+		{
+			for (auto c = 0; c < var_degree; c++)
+				std::copy(Y, Y + n_words, var_to_chk + c * n_words);
+			continue;
+		}
+
+		// the state is flipped when all the other messages disagree with the channel
+		auto prefix = this->prefix.data();
+		std::fill(prefix, prefix + n_words, ~(W)0);
+		for (auto c = 0; c < var_degree; c++)
+			for (size_t w = 0; w < n_words; w++)
+				prefix[(c +1) * n_words + w] = prefix[c * n_words + w] & (chk_to_var[c * n_words + w] ^ Y[w]);
+
+		W suffix[n_words];
+		std::fill(suffix, suffix + n_words, ~(W)0);
+		for (auto c = var_degree -1; c >= 0; c--)
+			for (size_t w = 0; w < n_words; w++)
+			{
+				var_to_chk[c * n_words + w] = Y[w] ^ (prefix[c * n_words + w] & suffix[w]);
+				suffix[w] &= chk_to_var[c * n_words + w] ^ Y[w];
+			}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::_decode_single_ite()
+{
+	this->_xor_check_nodes();
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::_make_majority_vote()
+{
+	constexpr auto n_words = Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::n_words;
+
+	// for the K variable nodes (make a majority vote with the entering messages)
+	const auto n_var_nodes = (int)this->Hc.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto var_degree = (int)this->Hc.get_row_degree(v);
+		const auto chk_to_var = this->chk_to_var.data() + this->Hc.get_row_offset(v) * n_words;
+
+		std::fill(this->cnt.begin(), this->cnt.end(), (W)0);
+		for (auto c = 0; c < var_degree; c++)
+			this->count(this->cnt.data(), this->n_cnt_planes, chk_to_var + c * n_words);
+
+		// the channel breaks the ties when the degree is even
+		auto n_votes = var_degree;
+		if (var_degree % 2 == 0)
+		{
+			this->count(this->cnt.data(), this->n_cnt_planes, this->Y.data() + v * n_words);
+			n_votes++;
+		}
+
+		this->greater_equal(this->cnt.data(), this->n_cnt_planes, (unsigned)(n_votes +1) / 2,
+		                    this->V.data() + v * n_words);
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
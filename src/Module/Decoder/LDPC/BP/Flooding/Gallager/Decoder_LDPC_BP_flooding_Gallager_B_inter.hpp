@@ -0,0 +1,41 @@
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_B_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_GALLAGER_B_INTER_HPP_
+
+#include "Decoder_LDPC_BP_flooding_Gallager_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Bit-sliced version of the Decoder_LDPC_BP_flooding_Gallager_B decoder (same decisions, several frames at once)
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_Gallager_B_inter : public Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+{
+protected:
+	using W = typename Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::W;
+
+	std::vector<W> cnt; // bit-sliced count of the messages of a variable node
+	size_t         n_cnt_planes;
+
+public:
+	Decoder_LDPC_BP_flooding_Gallager_B_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
+	                                          const std::vector<unsigned> &info_bits_pos,
+	                                          const bool enable_syndrome = true,
+	                                          const int syndrome_depth = 1,
+	                                          const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_Gallager_B_inter() = default;
+
+protected:
+	void _initialize_var_to_chk(const int ite);
+	void _decode_single_ite    (             );
+	void _make_majority_vote   (             );
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_BP_flooding_GALB_inter = Decoder_LDPC_BP_flooding_Gallager_B_inter<B,R>;
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_GALLAGER_B_INTER_HPP_ */
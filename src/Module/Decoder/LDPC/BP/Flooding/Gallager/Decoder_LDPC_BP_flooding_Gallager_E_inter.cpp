@@ -0,0 +1,196 @@
+#include <algorithm>
+
+#include "Decoder_LDPC_BP_flooding_Gallager_E_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::Decoder_LDPC_BP_flooding_Gallager_E_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
+                                            const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
+                                            const int syndrome_depth, const int n_frames)
+: Decoder(K, N, n_frames, (int)Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::n_lanes),
+  Decoder_LDPC_BP_flooding_Gallager_inter<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth,
+                                               n_frames),
+  chk_to_var_nz(this->H.get_n_connections() * this->n_words, 0),
+  var_to_chk_nz(this->H.get_n_connections() * this->n_words, 0),
+  prefix       ((this->Hc.get_cols_max_degree() +1) * this->n_words),
+  cnt          (this->n_planes(2 * ((unsigned)this->Hc.get_rows_max_degree() +2)) * this->n_words),
+  n_cnt_planes (this->n_planes(2 * ((unsigned)this->Hc.get_rows_max_degree() +2)))
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_E_inter";
+	this->set_name(name);
+}
+
+/*
+ * The sum of the messages in {-1,0,+1} is counted with an offset to stay positive: each message adds 2 if it is +1,
+ * 1 if it is 0 and nothing if it is -1 (one bit for "is +1" and one bit for "is not -1"). The channel counts
+ * 'scaling' times and a sum of 'n' messages is positive when the count is greater than 'n'.
+ */
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::_initialize_var_to_chk(const int ite)
+{
+	constexpr auto n_words = Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::n_words;
+
+	const auto scaling = ite < 2 ? 2 : 1;
+
+	W plus[n_words], not_minus[n_words], ge_p2[n_words], ge_p1[n_words], ge_0[n_words], ge_m1[n_words];
+
+	// for each variable nodes
+	const auto n_var_nodes = (int)this->Hc.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto var_degree    = (int)this->Hc.get_row_degree(v);
+		const auto Y             = this->Y.data() + v * n_words;
+		const auto chk_to_var    = this->chk_to_var   .data() + this->Hc.get_row_offset(v) * n_words;
+		const auto chk_to_var_nz = this->chk_to_var_nz.data() + this->Hc.get_row_offset(v) * n_words;
+		      auto var_to_chk    = this->var_to_chk   .data() + this->Hc.get_row_offset(v) * n_words;
+		      auto var_to_chk_nz = this->var_to_chk_nz.data() + this->Hc.get_row_offset(v) * n_words;
+
+		if (ite == 0)
+		{
+			for (auto c = 0; c < var_degree; c++)
+			{
+				std::copy(Y, Y + n_words, var_to_chk + c * n_words);
+				std::fill(var_to_chk_nz + c * n_words, var_to_chk_nz + (c +1) * n_words, ~(W)0);
+			}
+			continue;
+		}
+
+		std::fill(this->cnt.begin(), this->cnt.end(), (W)0);
+		for (auto c = 0; c < var_degree; c++)
+		{
+			for (size_t w = 0; w < n_words; w++)
+			{
+				plus     [w] =   chk_to_var_nz[c * n_words + w] & ~chk_to_var[c * n_words + w];
+				not_minus[w] = ~(chk_to_var_nz[c * n_words + w] &  chk_to_var[c * n_words + w]);
+			}
+			this->count(this->cnt.data(), this->n_cnt_planes, plus     );
+			this->count(this->cnt.data(), this->n_cnt_planes, not_minus);
+		}
+		for (size_t w = 0; w < n_words; w++)
+			plus[w] = ~Y[w];
+		for (auto s = 0; s < 2 * scaling; s++)
+			this->count(this->cnt.data(), this->n_cnt_planes, plus);
+
+		// sign of the sum minus the message of each check node: the count is compared to the offset plus the message
+		const auto offset = (unsigned)(var_degree + scaling);
+		this->greater_equal(this->cnt.data(), this->n_cnt_planes, offset +2, ge_p2);
+		this->greater_equal(this->cnt.data(), this->n_cnt_planes, offset +1, ge_p1);
+		this->greater_equal(this->cnt.data(), this->n_cnt_planes, offset +0, ge_0 );
+		this->greater_equal(this->cnt.data(), this->n_cnt_planes, offset -1, ge_m1);
+
+		for (auto c = 0; c < var_degree; c++)
+			for (size_t w = 0; w < n_words; w++)
+			{
+				const auto nz   = chk_to_var_nz[c * n_words + w];
+				const auto sign = chk_to_var   [c * n_words + w];
+				const auto m_p  =  nz & ~sign;
+				const auto m_m  =  nz &  sign;
+				const auto m_0  = ~nz;
+
+				const auto pos =   (m_p & ge_p2[w]) | (m_0 & ge_p1[w]) | (m_m & ge_0 [w]);
+				const auto neg = ~((m_p & ge_p1[w]) | (m_0 & ge_0 [w]) | (m_m & ge_m1[w]));
+
+				var_to_chk   [c * n_words + w] = neg;
+				var_to_chk_nz[c * n_words + w] = pos | neg;
+			}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::_decode_single_ite()
+{
+	constexpr auto n_words = Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::n_words;
+
+	auto transpose_ptr = this->transpose.data();
+
+	W acc[n_words], suffix[n_words];
+
+	// for each check nodes: the sign is the xor of the other signs and the message is zero if one of the others is
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		const auto chk_degree = (int)this->Hc.get_col_degree(c);
+
+		auto prefix = this->prefix.data();
+		std::fill(acc,    acc    + n_words, (W)0);
+		std::fill(prefix, prefix + n_words, ~(W)0);
+		for (auto v = 0; v < chk_degree; v++)
+			for (size_t w = 0; w < n_words; w++)
+			{
+				acc[w] ^= this->var_to_chk[transpose_ptr[v] * n_words + w];
+				prefix[(v +1) * n_words + w] = prefix[v * n_words + w] & this->var_to_chk_nz[transpose_ptr[v] * n_words + w];
+			}
+
+		std::fill(suffix, suffix + n_words, ~(W)0);
+		for (auto v = chk_degree -1; v >= 0; v--)
+			for (size_t w = 0; w < n_words; w++)
+			{
+				const auto e = transpose_ptr[v] * n_words + w;
+				this->chk_to_var   [e] = acc[w] ^ this->var_to_chk[e];
+				this->chk_to_var_nz[e] = prefix[v * n_words + w] & suffix[w];
+				suffix[w] &= this->var_to_chk_nz[e];
+			}
+
+		transpose_ptr += chk_degree;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::_make_majority_vote()
+{
+	constexpr auto n_words = Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::n_words;
+
+	W plus[n_words], not_minus[n_words], ge_p1[n_words], ge_0[n_words];
+
+	// for the K variable nodes (make a majority vote with the entering messages)
+	const auto n_var_nodes = (int)this->Hc.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto var_degree    = (int)this->Hc.get_row_degree(v);
+		const auto Y             = this->Y.data() + v * n_words;
+		const auto chk_to_var    = this->chk_to_var   .data() + this->Hc.get_row_offset(v) * n_words;
+		const auto chk_to_var_nz = this->chk_to_var_nz.data() + this->Hc.get_row_offset(v) * n_words;
+
+		std::fill(this->cnt.begin(), this->cnt.end(), (W)0);
+		for (auto c = 0; c < var_degree; c++)
+		{
+			for (size_t w = 0; w < n_words; w++)
+			{
+				plus     [w] =   chk_to_var_nz[c * n_words + w] & ~chk_to_var[c * n_words + w];
+				not_minus[w] = ~(chk_to_var_nz[c * n_words + w] &  chk_to_var[c * n_words + w]);
+			}
+			this->count(this->cnt.data(), this->n_cnt_planes, plus     );
+			this->count(this->cnt.data(), this->n_cnt_planes, not_minus);
+		}
+		for (size_t w = 0; w < n_words; w++)
+			plus[w] = ~Y[w];
+		this->count(this->cnt.data(), this->n_cnt_planes, plus);
+		this->count(this->cnt.data(), this->n_cnt_planes, plus);
+
+		// the channel breaks the ties
+		const auto offset = (unsigned)(var_degree +1);
+		this->greater_equal(this->cnt.data(), this->n_cnt_planes, offset +1, ge_p1);
+		this->greater_equal(this->cnt.data(), this->n_cnt_planes, offset +0, ge_0 );
+
+		for (size_t w = 0; w < n_words; w++)
+			this->V[v * n_words + w] = (Y[w] & ~ge_p1[w]) | (~Y[w] & ~ge_0[w]);
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
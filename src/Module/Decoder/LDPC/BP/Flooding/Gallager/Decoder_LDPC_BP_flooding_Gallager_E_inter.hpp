@@ -0,0 +1,46 @@
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_E_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_GALLAGER_E_INTER_HPP_
+
+#include "Decoder_LDPC_BP_flooding_Gallager_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Bit-sliced version of the Decoder_LDPC_BP_flooding_Gallager_E decoder (same decisions, several frames at once): the
+ * messages of the extended alphabet {-1,0,+1} are stored in two bits, the sign (in chk_to_var and var_to_chk) and the
+ * non-zero flag (in chk_to_var_nz and var_to_chk_nz)
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_Gallager_E_inter : public Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+{
+protected:
+	using W = typename Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::W;
+
+	std::vector<W> chk_to_var_nz; // non-zero flags of the check    nodes to variable nodes messages
+	std::vector<W> var_to_chk_nz; // non-zero flags of the variable nodes to check    nodes messages
+	std::vector<W> prefix;        // non-zero flags of the products of the first messages of a check node
+	std::vector<W> cnt;           // bit-sliced count of the messages of a variable node
+	size_t         n_cnt_planes;
+
+public:
+	Decoder_LDPC_BP_flooding_Gallager_E_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
+	                                          const std::vector<unsigned> &info_bits_pos,
+	                                          const bool enable_syndrome = true,
+	                                          const int syndrome_depth = 1,
+	                                          const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_Gallager_E_inter() = default;
+
+protected:
+	void _initialize_var_to_chk(const int ite);
+	void _decode_single_ite    (             );
+	void _make_majority_vote   (             );
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_BP_flooding_GALE_inter = Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>;
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_GALLAGER_E_INTER_HPP_ */
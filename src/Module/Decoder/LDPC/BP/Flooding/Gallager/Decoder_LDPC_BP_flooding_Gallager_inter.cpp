@@ -0,0 +1,249 @@
+#include <algorithm>
+#include <sstream>
+
+#include "Tools/Perf/common/hard_decide.h"
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_LDPC_BP_flooding_Gallager_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+constexpr size_t Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::n_words;
+
+template <typename B, typename R>
+constexpr size_t Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::n_lanes;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::Decoder_LDPC_BP_flooding_Gallager_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &_H,
+                                          const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
+                                          const int syndrome_depth, const int n_frames)
+: Decoder               (K, N, n_frames, (int)n_lanes                       ),
+  Decoder_SIHO_HIHO<B,R>(K, N, n_frames, (int)n_lanes                       ),
+  Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth   ),
+  info_bits_pos         (info_bits_pos                                      ),
+  transpose             (this->H.get_n_connections()                        ),
+  HY_N                  (N                                                  ),
+  Y                     (N * n_words                                        ),
+  V                     (N * n_words                                        ),
+  V_frozen              (N * n_words                                        ),
+  frozen                (n_words                                            ),
+  chk_to_var            (this->H.get_n_connections() * n_words, 0           ),
+  var_to_chk            (this->H.get_n_connections() * n_words, 0           ),
+  synd_depth            (n_lanes, 0                                         )
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_inter";
+	this->set_name(name);
+
+	// the connections are stored in the order of the variable nodes, find the position of each connection of the
+	// check nodes
+	auto k = 0;
+	for (size_t c = 0; c < this->Hc.get_n_cols(); c++)
+		for (auto v : this->Hc.get_rows_from_col(c))
+		{
+			const auto var_node = this->Hc.get_cols_from_row(v);
+			const auto pos = std::find(var_node.begin(), var_node.end(), c) - var_node.begin();
+			transpose[k++] = (uint32_t)(this->Hc.get_row_offset(v) + pos);
+		}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+	std::fill(this->Y.begin(), this->Y.end(), (W)0);
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto v = 0; v < this->N; v++)
+			this->Y[v * n_words + f / 64] |= (W)(Y_N[f * this->N + v] != 0) << (f % 64);
+
+	this->_decode();
+
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto i = 0; i < this->K; i++)
+			V_K[f * this->K + i] = (B)((this->V_frozen[this->info_bits_pos[i] * n_words + f / 64] >> (f % 64)) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+	std::fill(this->Y.begin(), this->Y.end(), (W)0);
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto v = 0; v < this->N; v++)
+			this->Y[v * n_words + f / 64] |= (W)(Y_N[f * this->N + v] != 0) << (f % 64);
+
+	this->_decode();
+
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto v = 0; v < this->N; v++)
+			V_N[f * this->N + v] = (B)((this->V_frozen[v * n_words + f / 64] >> (f % 64)) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	std::fill(this->Y.begin(), this->Y.end(), (W)0);
+	for (size_t f = 0; f < n_lanes; f++)
+	{
+		tools::hard_decide(Y_N + f * this->N, this->HY_N.data(), this->N);
+		for (auto v = 0; v < this->N; v++)
+			this->Y[v * n_words + f / 64] |= (W)(this->HY_N[v] != 0) << (f % 64);
+	}
+
+	this->_decode();
+
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto i = 0; i < this->K; i++)
+			V_K[f * this->K + i] = (B)((this->V_frozen[this->info_bits_pos[i] * n_words + f / 64] >> (f % 64)) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	std::fill(this->Y.begin(), this->Y.end(), (W)0);
+	for (size_t f = 0; f < n_lanes; f++)
+	{
+		tools::hard_decide(Y_N + f * this->N, this->HY_N.data(), this->N);
+		for (auto v = 0; v < this->N; v++)
+			this->Y[v * n_words + f / 64] |= (W)(this->HY_N[v] != 0) << (f % 64);
+	}
+
+	this->_decode();
+
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto v = 0; v < this->N; v++)
+			V_N[f * this->N + v] = (B)((this->V_frozen[v * n_words + f / 64] >> (f % 64)) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode()
+{
+	std::fill(this->V_frozen  .begin(), this->V_frozen  .end(), (W)0);
+	std::fill(this->frozen    .begin(), this->frozen    .end(), (W)0);
+	std::fill(this->synd_depth.begin(), this->synd_depth.end(), 0   );
+
+	auto ite = 0;
+	for (; ite < this->n_ite; ite++)
+	{
+		this->_initialize_var_to_chk(ite);
+		this->_decode_single_ite();
+
+		if (this->enable_syndrome && ite != this->n_ite -1)
+		{
+			this->_make_majority_vote();
+			if (this->_freeze_valid_frames())
+				break;
+		}
+	}
+
+	if (ite == this->n_ite)
+	{
+		// the frames which are not frozen take the decisions of the last iteration
+		this->_make_majority_vote();
+		for (auto v = 0; v < this->N; v++)
+			for (size_t w = 0; w < n_words; w++)
+				this->V_frozen[v * n_words + w] |= this->V[v * n_words + w] & ~this->frozen[w];
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_xor_check_nodes()
+{
+	auto transpose_ptr = this->transpose.data();
+
+	W acc[n_words];
+
+	// for each check nodes
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		const auto chk_degree = (int)this->Hc.get_col_degree(c);
+
+		std::fill(acc, acc + n_words, (W)0);
+		for (auto v = 0; v < chk_degree; v++)
+			for (size_t w = 0; w < n_words; w++)
+				acc[w] ^= this->var_to_chk[transpose_ptr[v] * n_words + w];
+
+		for (auto v = 0; v < chk_degree; v++)
+			for (size_t w = 0; w < n_words; w++)
+				this->chk_to_var[transpose_ptr[v] * n_words + w] = acc[w] ^ this->var_to_chk[transpose_ptr[v] * n_words + w];
+
+		transpose_ptr += chk_degree;
+	}
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_freeze_valid_frames()
+{
+	// the frames with at least one unsatisfied check node
+	W unsat[n_words] = {};
+	W parity[n_words];
+
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		std::fill(parity, parity + n_words, (W)0);
+		for (auto v : this->Hc.get_rows_from_col(c))
+			for (size_t w = 0; w < n_words; w++)
+				parity[w] ^= this->V[v * n_words + w];
+
+		for (size_t w = 0; w < n_words; w++)
+			unsat[w] |= parity[w];
+	}
+
+	// same rule as 'Decoder_LDPC_BP::check_syndrome' for each frame
+	W newly_frozen[n_words] = {};
+	for (size_t f = 0; f < n_lanes; f++)
+	{
+		const auto mask = (W)1 << (f % 64);
+		if (this->frozen[f / 64] & mask)
+			continue;
+
+		const auto valid = !(unsat[f / 64] & mask);
+		this->synd_depth[f] = valid ? (this->synd_depth[f] +1) % this->syndrome_depth : 0;
+		if (valid && this->synd_depth[f] == 0)
+			newly_frozen[f / 64] |= mask;
+	}
+
+	auto all_frozen = true;
+	for (size_t w = 0; w < n_words; w++)
+	{
+		this->frozen[w] |= newly_frozen[w];
+		all_frozen &= this->frozen[w] == ~(W)0;
+	}
+
+	for (auto v = 0; v < this->N; v++)
+		for (size_t w = 0; w < n_words; w++)
+			this->V_frozen[v * n_words + w] |= this->V[v * n_words + w] & newly_frozen[w];
+
+	return all_frozen;
+}
+
+template <typename B, typename R>
+size_t Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::n_planes(const unsigned max)
+{
+	size_t n = 1;
+	while ((max >> n) != 0)
+		n++;
+	return n;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,122 @@
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_
+
+#include <vector>
+#include <cstdint>
+#include <mipp.h>
+
+#include "../../../../Decoder_SIHO_HIHO.hpp"
+#include "../../Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Bit-sliced flooding decoders with hard messages (Gallager A, B and E): a message is stored in 'n_words' 64-bit
+ * words which hold the same message for 'n_lanes' = 64 * 'n_words' frames (one bit per frame), so the updates of
+ * the nodes are made of bitwise operations that process all the frames at once. 'n_words' is the number of 64-bit
+ * elements in a SIMD register, the words of a message are contiguous for the compiler to vectorize the loops on them.
+ * The counts needed by the majority votes are computed with bit-sliced adders (one word per bit of the count).
+ *
+ * The frames are frozen when their syndrome is valid (they give the same decisions as the one frame decoders) and the
+ * decoding stops when all the frames are frozen.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_Gallager_inter : public Decoder_SIHO_HIHO<B,R>, public Decoder_LDPC_BP
+{
+public:
+	using W = uint64_t;
+	static constexpr size_t n_words = (size_t)mipp::N<int64_t>();
+	static constexpr size_t n_lanes = 64 * n_words;
+
+protected:
+	const std::vector<uint32_t> &info_bits_pos;
+
+	std::vector<uint32_t> transpose;  // position in the variable nodes order of each connection of the check nodes
+	std::vector<B       > HY_N;       // hard decisions of one frame
+	std::vector<W       > Y;          // hard decisions of the channel     (N words groups)
+	std::vector<W       > V;          // decisions of the last vote        (N words groups)
+	std::vector<W       > V_frozen;   // decisions of the frozen frames    (N words groups)
+	std::vector<W       > frozen;     // mask of the frozen frames         (1 words group )
+	std::vector<W       > chk_to_var; // check    nodes to variable nodes messages (one words group per connection)
+	std::vector<W       > var_to_chk; // variable nodes to check    nodes messages (one words group per connection)
+	std::vector<int     > synd_depth; // number of consecutive valid syndromes of each frame
+
+public:
+	Decoder_LDPC_BP_flooding_Gallager_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
+	                                        const std::vector<unsigned> &info_bits_pos,
+	                                        const bool enable_syndrome = true,
+	                                        const int syndrome_depth = 1,
+	                                        const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_Gallager_inter() = default;
+
+protected:
+	void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
+	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+
+	void _decode();
+
+	// update the variable nodes, then the check nodes, of all the frames
+	virtual void _initialize_var_to_chk(const int ite) = 0;
+	virtual void _decode_single_ite    (             ) = 0;
+	// compute the decisions in V
+	virtual void _make_majority_vote   (             ) = 0;
+
+	// check nodes update when the messages are bits (chk_to_var is the xor of the other var_to_chk messages)
+	void _xor_check_nodes();
+
+	// freeze the frames with a valid syndrome, return true when all the frames are frozen
+	bool _freeze_valid_frames();
+
+	// number of bits needed to count up to 'max'
+	static size_t n_planes(const unsigned max);
+
+	// add the bits of the words group 'x' to the bit-sliced counter 'cnt' ('n_planes' words groups, LSB first)
+	static inline void count(W *cnt, const size_t n_planes, const W *x)
+	{
+		for (size_t w = 0; w < n_words; w++)
+		{
+			auto carry = x[w];
+			for (size_t p = 0; p < n_planes; p++)
+			{
+				const auto c = cnt[p * n_words + w] & carry;
+				cnt[p * n_words + w] ^= carry;
+				carry = c;
+			}
+		}
+	}
+
+	// 'res' = 'cnt' >= 'threshold' for each frame
+	static inline void greater_equal(const W *cnt, const size_t n_planes, const unsigned threshold, W *res)
+	{
+		for (size_t w = 0; w < n_words; w++)
+		{
+			if (n_planes < 32 && (threshold >> n_planes))
+			{
+				res[w] = 0;
+				continue;
+			}
+
+			W gt = 0, eq = ~(W)0;
+			for (auto p = n_planes; p > 0; p--)
+			{
+				const auto c = cnt[(p -1) * n_words + w];
+				if ((threshold >> (p -1)) & 1)
+					eq &= c;
+				else
+				{
+					gt |= eq & c;
+					eq &= ~c;
+				}
+			}
+			res[w] = gt | eq;
+		}
+	}
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_ */
@@ -0,0 +1,38 @@
+#ifndef DECODER_LDPC_BP_FLOODING_LSPA_HPP_
+#define DECODER_LDPC_BP_FLOODING_LSPA_HPP_
+
+#include "Tools/Math/phi.h"
+#include "Tools/Code/LDPC/Update_rule/LSPA/Update_rule_LSPA_phi.hpp"
+
+#include "../Decoder_LDPC_BP_flooding.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * LSPA flooding decoder vectorized inside a frame: the phi function ('PHI_I', or 'PHI' for the tail) is computed on
+ * the SIMD registers along the edges, only the sums and the signs are computed check node per check node.
+ */
+template <typename B = int, typename R = float, tools::proto_phi  <R> PHI   = tools::phi_pwl,
+                                                tools::proto_phi_i<R> PHI_I = tools::phi_pwl_i>
+class Decoder_LDPC_BP_flooding_LSPA : public Decoder_LDPC_BP_flooding<B,R,tools::Update_rule_LSPA_phi<R,PHI>>
+{
+public:
+	Decoder_LDPC_BP_flooding_LSPA(const int K, const int N, const int n_ite,
+	                              const tools::Sparse_matrix &H,
+	                              const std::vector<uint32_t> &info_bits_pos,
+	                              const bool enable_syndrome = true,
+	                              const int syndrome_depth = 1,
+	                              const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_LSPA() = default;
+
+protected:
+	void _decode_single_ite(const std::vector<R> &msg_var_to_chk, std::vector<R> &msg_chk_to_var);
+};
+}
+}
+
+#include "Decoder_LDPC_BP_flooding_LSPA.hxx"
+
+#endif /* DECODER_LDPC_BP_FLOODING_LSPA_HPP_ */
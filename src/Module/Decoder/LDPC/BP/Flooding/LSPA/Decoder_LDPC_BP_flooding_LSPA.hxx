@@ -0,0 +1,82 @@
+#include <cmath>
+#include <algorithm>
+#include <mipp.h>
+
+#include "Decoder_LDPC_BP_flooding_LSPA.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, tools::proto_phi<R> PHI, tools::proto_phi_i<R> PHI_I>
+Decoder_LDPC_BP_flooding_LSPA<B,R,PHI,PHI_I>
+::Decoder_LDPC_BP_flooding_LSPA(const int K, const int N, const int n_ite,
+                                const tools::Sparse_matrix &_H,
+                                const std::vector<uint32_t> &info_bits_pos,
+                                const bool enable_syndrome,
+                                const int syndrome_depth,
+                                const int n_frames)
+: Decoder(K, N, n_frames, 1),
+  Decoder_LDPC_BP_flooding<B,R,tools::Update_rule_LSPA_phi<R,PHI>>(K, N, n_ite, _H, info_bits_pos,
+                                                                   tools::Update_rule_LSPA_phi<R,PHI>(_H.get_cols_max_degree()),
+                                                                   enable_syndrome, syndrome_depth, n_frames)
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_LSPA";
+	this->set_name(name);
+}
+
+template <typename B, typename R, tools::proto_phi<R> PHI, tools::proto_phi_i<R> PHI_I>
+void Decoder_LDPC_BP_flooding_LSPA<B,R,PHI,PHI_I>
+::_decode_single_ite(const std::vector<R> &msg_var_to_chk, std::vector<R> &msg_chk_to_var)
+{
+	const auto n_branches = (int)this->H.get_n_connections();
+	auto transpose_ptr = this->transpose.data();
+
+	// phi of the magnitude of the incoming messages
+	const auto vec_loop_size = (n_branches / mipp::N<R>()) * mipp::N<R>();
+	for (auto b = 0; b < vec_loop_size; b += mipp::N<R>())
+	{
+		const auto r_in = mipp::Reg<R>(mipp::loadu<R>(&msg_var_to_chk[b]));
+		PHI_I(mipp::abs(r_in)).storeu(&msg_chk_to_var[b]);
+	}
+	// tail loop to compute the remaining elements
+	for (auto b = vec_loop_size; b < n_branches; b++)
+		msg_chk_to_var[b] = PHI(std::abs(msg_var_to_chk[b]));
+
+	// flooding scheduling: the sum of the phi values of the other variable nodes, with the sign of the outgoing message
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		const auto chk_degree = (int)this->Hc.get_col_degree(c);
+
+		auto sum  = (R)0;
+		auto sign = false;
+		for (auto v = 0; v < chk_degree; v++)
+		{
+			sum  += msg_chk_to_var[transpose_ptr[v]];
+			sign ^= std::signbit(msg_var_to_chk[transpose_ptr[v]]);
+		}
+
+		for (auto v = 0; v < chk_degree; v++)
+		{
+			// the rounding errors can give a small negative value
+			const auto val = std::max((R)(sum - msg_chk_to_var[transpose_ptr[v]]), (R)0);
+			const auto sgn = sign ^ std::signbit(msg_var_to_chk[transpose_ptr[v]]);
+			msg_chk_to_var[transpose_ptr[v]] = sgn ? -val : val;
+		}
+
+		transpose_ptr += chk_degree;
+	}
+
+	// phi of the magnitude of the outgoing messages (-0 is a negative message)
+	for (auto b = 0; b < vec_loop_size; b += mipp::N<R>())
+	{
+		const auto r_out = mipp::Reg<R>(mipp::loadu<R>(&msg_chk_to_var[b]));
+		mipp::copysign(PHI_I(mipp::abs(r_out)), mipp::sign(r_out)).storeu(&msg_chk_to_var[b]);
+	}
+	// tail loop to compute the remaining elements
+	for (auto b = vec_loop_size; b < n_branches; b++)
+		msg_chk_to_var[b] = (R)std::copysign(PHI(std::abs(msg_chk_to_var[b])), msg_chk_to_var[b]);
+}
+}
+}
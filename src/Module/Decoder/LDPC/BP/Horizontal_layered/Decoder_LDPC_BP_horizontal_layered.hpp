@@ -1,7 +1,11 @@
 #ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_HPP_
 #define DECODER_LDPC_BP_HORIZONTAL_LAYERED_HPP_
 
+#include <atomic>
+#include <memory>
+
 #include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
+#include "Tools/Threads/Thread_team.hpp"
 
 #include "../../../Decoder_SISO_SIHO.hpp"
 #include "../Decoder_LDPC_BP.hpp"
@@ -25,6 +29,14 @@ protected:
 
 	bool init_flag; // reset the chk_to_var vector at the begining of the iterative decoding
 
+	// intra-frame multi-threading: the consecutive check nodes that do not share any variable node form a group (ex: a
+	// layer of a QC-LDPC code), the check nodes of a group are split between the threads
+	std::unique_ptr<tools::Thread_team> team;
+	std::vector<Update_rule           > up_rules;            // one update rule per thread
+	std::vector<std::vector<R>        > team_contributions;  // one contributions buffer per thread
+	std::vector<size_t                > groups;              // the group 'g' is [groups[g];groups[g+1][
+	std::atomic<int                   > team_flags[3];
+
 public:
 	Decoder_LDPC_BP_horizontal_layered(const int K, const int N, const int n_ite,
 	                                   const tools::Sparse_matrix &H,
@@ -32,7 +44,8 @@ public:
 	                                   const Update_rule &up_rule,
 	                                   const bool enable_syndrome = true,
 	                                   const int syndrome_depth = 1,
-	                                   const int n_frames = 1);
+	                                   const int n_frames = 1,
+	                                   const int n_threads = 1);
 	virtual ~Decoder_LDPC_BP_horizontal_layered() = default;
 	void reset();
 
@@ -43,7 +56,10 @@ protected:
 
 	void _load             (const R *Y_N, const int frame_id);
 	void _decode           (const int frame_id);
+	void _decode_team      (const int frame_id);
 	void _decode_single_ite(std::vector<R> &var_nodes, std::vector<R> &messages);
+	void _update_chk_nodes (Update_rule &up_rule, std::vector<R> &contributions, std::vector<R> &var_nodes,
+	                        std::vector<R> &messages, const int c_first, const int c_last);
 };
 }
 }
@@ -2,7 +2,10 @@
 #include <limits>
 #include <cmath>
 #include <stdexcept>
+#include <sstream>
+#include <algorithm>
 
+#include "Tools/Exception/exception.hpp"
 #include "Tools/Perf/common/hard_decide.h"
 #include "Tools/Math/utils.h"
 
@@ -20,7 +23,8 @@ Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
                                      const Update_rule &up_rule,
                                      const bool enable_syndrome,
                                      const int syndrome_depth,
-                                     const int n_frames)
+                                     const int n_frames,
+                                     const int n_threads)
 : Decoder               (K, N, n_frames, 1                                    ),
   Decoder_SISO_SIHO<B,R>(K, N, n_frames, 1                                    ),
   Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth     ),
@@ -33,6 +37,54 @@ Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
 {
 	const std::string name = "Decoder_LDPC_BP_horizontal_layered<" + this->up_rule.get_name() + ">";
 	this->set_name(name);
+
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto &f : this->team_flags)
+		f = 0;
+
+	if (n_threads > 1)
+	{
+		// a new group starts when a check node shares a variable node with a previous check node of the group
+		const auto n_chk_nodes = (int)this->Hc.get_n_cols();
+		std::vector<int> var_group(N, -1);
+		size_t max_group_size = 0;
+		this->groups.push_back(0);
+		for (auto c = 0; c < n_chk_nodes; c++)
+		{
+			const auto cur_group = (int)this->groups.size() -1;
+			for (auto v : this->Hc[c])
+				if (var_group[v] == cur_group)
+				{
+					max_group_size = std::max(max_group_size, (size_t)c - this->groups.back());
+					this->groups.push_back((size_t)c);
+					break;
+				}
+
+			for (auto v : this->Hc[c])
+				var_group[v] = (int)this->groups.size() -1;
+		}
+		max_group_size = std::max(max_group_size, (size_t)n_chk_nodes - this->groups.back());
+		this->groups.push_back((size_t)n_chk_nodes);
+
+		if (max_group_size < 2)
+		{
+			std::stringstream message;
+			message << "The consecutive check nodes of 'H' always share variable nodes, they can't be updated in "
+			        << "parallel ('n_threads' = " << n_threads << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->team.reset(new tools::Thread_team((size_t)n_threads));
+		for (auto t = 0; t < n_threads; t++)
+			this->up_rules.push_back(up_rule);
+		this->team_contributions.resize(n_threads, std::vector<R>(this->H.get_cols_max_degree()));
+	}
 }
 
 template <typename B, typename R, class Update_rule>
@@ -131,10 +183,19 @@ template <typename B, typename R, class Update_rule>
 void Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
 ::_decode(const int frame_id)
 {
+	if (this->team != nullptr)
+	{
+		this->_decode_team(frame_id);
+		return;
+	}
+
 	this->up_rule.begin_decoding(this->n_ite);
 
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
+		if (this->is_cancelled()) // the frame will be thrown away
+			break;
+
 		this->up_rule.begin_ite(ite);
 		this->_decode_single_ite(this->var_nodes[frame_id], this->messages[frame_id]);
 		this->up_rule.end_ite();
@@ -146,33 +207,127 @@ void Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
 	this->up_rule.end_decoding();
 }
 
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
+::_decode_team(const int frame_id)
+{
+	auto &var_nodes = this->var_nodes[frame_id];
+	auto &messages  = this->messages [frame_id];
+
+	constexpr int unsat  = 1; // a parity check is not verified at the end of the iteration
+	constexpr int cancel = 2; // the frame will be thrown away
+
+	for (auto &f : this->team_flags)
+		f = 0;
+
+	const auto syndrome_depth = this->cur_syndrome_depth;
+	this->team->run([&](const size_t tid)
+	{
+		auto &up_rule       = this->up_rules[tid];
+		auto &contributions = this->team_contributions[tid];
+		const auto n_threads = this->team->get_n_threads();
+
+		// all the threads take the same decisions from the shared flags
+		auto cur_syndrome_depth = syndrome_depth;
+
+		up_rule.begin_decoding(this->n_ite);
+
+		for (auto ite = 0; ite < this->n_ite; ite++)
+		{
+			// the flags of the iteration 'ite' are in 'team_flags[ite % 3]', the flags of the next iteration can be
+			// reset here: nobody reads them anymore (they were used two iterations ago) and nobody writes them before
+			// the next barrier
+			auto &flags = this->team_flags[ite % 3];
+			if (tid == 0)
+			{
+				this->team_flags[(ite +1) % 3] = 0;
+				if (this->is_cancelled())
+					flags.fetch_or(cancel);
+			}
+
+			up_rule.begin_ite(ite);
+			for (size_t g = 0; g < this->groups.size() -1; g++)
+			{
+				const auto size    = this->groups[g +1] - this->groups[g];
+				const auto c_first = (int)(this->groups[g] + (size * (tid +0)) / n_threads);
+				const auto c_last  = (int)(this->groups[g] + (size * (tid +1)) / n_threads);
+
+				this->_update_chk_nodes(up_rule, contributions, var_nodes, messages, c_first, c_last);
+
+				this->team->barrier();
+			}
+			up_rule.end_ite();
+
+			// the syndrome is checked once the iteration is over, each thread checks a slice of the check nodes
+			if (this->enable_syndrome)
+			{
+				const auto n_chk_nodes = this->Hc.get_n_cols();
+				const auto c_first = (int)((n_chk_nodes * (tid +0)) / n_threads);
+				const auto c_last  = (int)((n_chk_nodes * (tid +1)) / n_threads);
+
+				if (!(flags.load() & unsat) &&
+				    !tools::LDPC_syndrome::check_soft(var_nodes.data(), this->Hc, c_first, c_last))
+					flags.fetch_or(unsat);
+
+				this->team->barrier();
+			}
+
+			const auto f = flags.load();
+			if (f & cancel)
+				break;
+
+			if (this->enable_syndrome)
+			{
+				const auto syndrome = !(f & unsat);
+				cur_syndrome_depth = syndrome ? (cur_syndrome_depth +1) % this->syndrome_depth : 0;
+				if (syndrome && cur_syndrome_depth == 0)
+					break;
+			}
+		}
+
+		up_rule.end_decoding();
+
+		if (tid == 0)
+			this->cur_syndrome_depth = cur_syndrome_depth;
+	});
+}
+
 template <typename B, typename R, class Update_rule>
 void Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
 ::_decode_single_ite(std::vector<R> &var_nodes, std::vector<R> &messages)
 {
-	auto kr = 0;
-	auto kw = 0;
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
+	this->_update_chk_nodes(this->up_rule, this->contributions, var_nodes, messages, 0, n_chk_nodes);
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
+::_update_chk_nodes(Update_rule &up_rule, std::vector<R> &contributions, std::vector<R> &var_nodes,
+                    std::vector<R> &messages, const int c_first, const int c_last)
+{
+	auto kr = (int)this->Hc.get_col_offset(c_first);
+	auto kw = (int)this->Hc.get_col_offset(c_first);
 
 	// horizontal layered scheduling
-	const auto n_chk_nodes = (int)this->H.get_n_cols();
-	for (auto c = 0; c < n_chk_nodes; c++)
+	for (auto c = c_first; c < c_last; c++)
 	{
-		const auto chk_degree = (int)this->H[c].size();
-		this->up_rule.begin_chk_node_in(c, chk_degree);
+		const auto chk_node   = this->Hc[c];
+		const auto chk_degree = (int)chk_node.size();
+		up_rule.begin_chk_node_in(c, chk_degree);
 		for (auto v = 0; v < chk_degree; v++)
 		{
-			this->contributions[v] = var_nodes[this->H[c][v]] - messages[kr++];
-			this->up_rule.compute_chk_node_in(v, this->contributions[v]);
+			contributions[v] = var_nodes[chk_node[v]] - messages[kr++];
+			up_rule.compute_chk_node_in(v, contributions[v]);
 		}
-		this->up_rule.end_chk_node_in();
+		up_rule.end_chk_node_in();
 
-		this->up_rule.begin_chk_node_out(c, chk_degree);
+		up_rule.begin_chk_node_out(c, chk_degree);
 		for (auto v = 0; v < chk_degree; v++)
 		{
-			messages[kw] = this->up_rule.compute_chk_node_out(v, this->contributions[v]);
-			var_nodes[this->H[c][v]] = this->contributions[v] + messages[kw++];
+			messages[kw] = up_rule.compute_chk_node_out(v, contributions[v]);
+			var_nodes[chk_node[v]] = contributions[v] + messages[kw++];
 		}
-		this->up_rule.end_chk_node_out();
+		up_rule.end_chk_node_out();
 	}
 }
 }
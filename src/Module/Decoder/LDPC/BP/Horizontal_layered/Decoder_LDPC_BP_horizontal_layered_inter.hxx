@@ -31,6 +31,40 @@ inline mipp::Reg<int8_t> saturate(const mipp::Reg<int8_t> v, const int8_t s)
 	return mipp::sat(v, (int8_t)-s, (int8_t)+s);
 }
 
+// in fixed-point, the a posteriori LLRs and the variable to check messages are computed with saturated arithmetic and
+// kept in the symmetric range [-max;+max] (the absolute value of -max-1 can't be represented)
+template <typename R>
+inline mipp::Reg<R> add_sat(const mipp::Reg<R> a, const mipp::Reg<R> b)
+{
+	return a + b;
+}
+template <>
+inline mipp::Reg<int16_t> add_sat(const mipp::Reg<int16_t> a, const mipp::Reg<int16_t> b)
+{
+	return mipp::max(mipp::adds(a, b), mipp::Reg<int16_t>(-std::numeric_limits<int16_t>::max()));
+}
+template <>
+inline mipp::Reg<int8_t> add_sat(const mipp::Reg<int8_t> a, const mipp::Reg<int8_t> b)
+{
+	return mipp::max(mipp::adds(a, b), mipp::Reg<int8_t>(-std::numeric_limits<int8_t>::max()));
+}
+
+template <typename R>
+inline mipp::Reg<R> sub_sat(const mipp::Reg<R> a, const mipp::Reg<R> b)
+{
+	return a - b;
+}
+template <>
+inline mipp::Reg<int16_t> sub_sat(const mipp::Reg<int16_t> a, const mipp::Reg<int16_t> b)
+{
+	return mipp::max(mipp::subs(a, b), mipp::Reg<int16_t>(-std::numeric_limits<int16_t>::max()));
+}
+template <>
+inline mipp::Reg<int8_t> sub_sat(const mipp::Reg<int8_t> a, const mipp::Reg<int8_t> b)
+{
+	return mipp::max(mipp::subs(a, b), mipp::Reg<int8_t>(-std::numeric_limits<int8_t>::max()));
+}
+
 template <typename B, typename R, class Update_rule>
 Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
 ::Decoder_LDPC_BP_horizontal_layered_inter(const int K, const int N, const int n_ite,
@@ -92,7 +126,8 @@ void Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
 	tools::Reorderer_static<R,mipp::N<R>()>::apply(frames, (R*)this->Y_N_reorderered.data(), this->N);
 
 	for (auto i = 0; i < (int)var_nodes[cur_wave].size(); i++)
-		this->var_nodes[cur_wave][i] += this->Y_N_reorderered[i]; // var_nodes contain previous extrinsic information
+		this->var_nodes[cur_wave][i] = add_sat<R>(this->var_nodes[cur_wave][i], // var_nodes contain previous extrinsic
+		                                          this->Y_N_reorderered[i]);    // information
 }
 
 template <typename B, typename R, class Update_rule>
@@ -107,7 +142,7 @@ void Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
 	// prepare for next round by processing extrinsic information
 	const auto cur_wave = frame_id / this->simd_inter_frame_level;
 	for (auto v = 0; v < this->N; v++)
-		this->var_nodes[cur_wave][v] -= Y_N_reorderered[v];
+		this->var_nodes[cur_wave][v] = sub_sat<R>(this->var_nodes[cur_wave][v], Y_N_reorderered[v]);
 
 	std::vector<R*> frames(mipp::N<R>());
 	for (auto f = 0; f < mipp::N<R>(); f++) frames[f] = Y_N2 + f * this->N;
@@ -179,37 +214,63 @@ void Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
 {
 	const auto cur_wave = frame_id / this->simd_inter_frame_level;
 
+	// each frame (SIMD lane) stops when its syndrome has been verified 'syndrome_depth' times in a row: its a posteriori
+	// LLRs and its messages are frozen while the other frames continue the decoding
+	const auto zero      = mipp::Reg<R>((R)0);
+	const auto one       = mipp::Reg<R>((R)1);
+	const auto max_depth = mipp::Reg<R>((R)this->syndrome_depth);
+	auto depth     = zero;
+	auto converged = mipp::Msk<mipp::N<R>()>(false);
+
 	this->up_rule.begin_decoding(this->n_ite);
 
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
+		if (this->is_cancelled()) // the frames will be thrown away
+			break;
+
 		this->up_rule.begin_ite(ite);
-		this->_decode_single_ite(this->var_nodes[cur_wave], this->messages[cur_wave]);
+		auto &var_nodes = this->var_nodes[cur_wave];
+		auto &messages  = this->messages [cur_wave];
+		if (mipp::testz(converged))
+			this->template _decode_single_ite<false>(var_nodes, messages, converged);
+		else
+			this->template _decode_single_ite<true >(var_nodes, messages, converged);
 		this->up_rule.end_ite();
 
-		if (this->_check_syndrome_soft(this->var_nodes[cur_wave]))
-			break;
+		if (this->enable_syndrome)
+		{
+			const auto unsat = this->_check_syndrome_soft(var_nodes, converged);
+			depth     = mipp::blend(zero, mipp::min(depth + one, max_depth), unsat);
+			converged = depth >= max_depth;
+
+			if (mipp::testz(~converged)) // all the frames have converged
+				break;
+		}
 	}
 
 	this->up_rule.end_decoding();
 }
 
 template <typename B, typename R, class Update_rule>
+template <bool FREEZE>
 void Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
-::_decode_single_ite(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &messages)
+::_decode_single_ite(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &messages,
+                     const mipp::Msk<mipp::N<R>()> converged)
 {
 	auto kr = 0;
 	auto kw = 0;
 
 	// horizontal layered scheduling
-	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
 	for (auto c = 0; c < n_chk_nodes; c++)
 	{
-		const auto chk_degree = (int)this->H[c].size();
+		const auto chk_node   = this->Hc[c];
+		const auto chk_degree = (int)chk_node.size();
 		this->up_rule.begin_chk_node_in(c, chk_degree);
 		for (auto v = 0; v < chk_degree; v++)
 		{
-			this->contributions[v] = var_nodes[this->H[c][v]] - messages[kr++];
+			this->contributions[v] = sub_sat<R>(var_nodes[chk_node[v]], messages[kr++]);
 			this->up_rule.compute_chk_node_in(v, this->contributions[v]);
 		}
 		this->up_rule.end_chk_node_in();
@@ -217,44 +278,41 @@ void Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
 		this->up_rule.begin_chk_node_out(c, chk_degree);
 		for (auto v = 0; v < chk_degree; v++)
 		{
-			messages[kw] = saturate<R>(this->up_rule.compute_chk_node_out(v, this->contributions[v]), this->sat_val);
-			var_nodes[this->H[c][v]] = this->contributions[v] + messages[kw++];
+			auto msg = saturate<R>(this->up_rule.compute_chk_node_out(v, this->contributions[v]), this->sat_val);
+			auto app = add_sat<R>(this->contributions[v], msg);
+
+			if (FREEZE) // the converged frames keep their values
+			{
+				msg = mipp::blend(messages[kw],           msg, converged);
+				app = mipp::blend(var_nodes[chk_node[v]], app, converged);
+			}
+
+			messages[kw++]         = msg;
+			var_nodes[chk_node[v]] = app;
 		}
 		this->up_rule.end_chk_node_out();
 	}
 }
 
+// returns the lanes where a parity check is not satisfied, the converged lanes are not checked (they are frozen)
 template <typename B, typename R, class Update_rule>
-bool Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
-::_check_syndrome_soft(const mipp::vector<mipp::Reg<R>> &var_nodes)
+mipp::Msk<mipp::N<R>()> Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
+::_check_syndrome_soft(const mipp::vector<mipp::Reg<R>> &var_nodes, const mipp::Msk<mipp::N<R>()> converged)
 {
-	if (this->enable_syndrome)
-	{
-		const auto zero = mipp::Msk<mipp::N<B>()>(false);
-		auto syndrome = zero;
+	auto unsat = mipp::Msk<mipp::N<R>()>(false);
 
-		auto n_chk_nodes = (int)H.get_n_cols();
-		auto c = 0;
-		auto syndrome_scalar = true;
-		while (c < n_chk_nodes && (syndrome_scalar = mipp::testz(syndrome)))
-		{
-			auto sign = zero;
-			const auto chk_degree = (int)this->H[c].size();
-			for (auto v = 0; v < chk_degree; v++)
-			{
-				const auto value = var_nodes[this->H[c][v]];
-				sign ^= mipp::sign(value);
-			}
-
-			syndrome |= sign;
-			c++;
-		}
+	// stop as soon as all the lanes still decoding have an unsatisfied parity check
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes && !mipp::testz(~(unsat | converged)); c++)
+	{
+		auto parity = mipp::Msk<mipp::N<R>()>(false);
+		for (auto v : this->Hc[c])
+			parity ^= mipp::sign(var_nodes[v]);
 
-		this->cur_syndrome_depth = syndrome_scalar ? (this->cur_syndrome_depth +1) % this->syndrome_depth : 0;
-		return syndrome_scalar && (this->cur_syndrome_depth == 0);
+		unsat |= parity;
 	}
-	else
-		return false;
+
+	return unsat;
 }
 
 }
@@ -242,10 +242,10 @@ void Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
 
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
-		this->_decode_single_ite<F>(this->var_nodes[cur_wave], this->branches[cur_wave]);
+		const auto syndrome = this->_decode_single_ite<F>(this->var_nodes[cur_wave], this->branches[cur_wave]);
 
 		// stop criterion
-		if (this->enable_syndrome && this->_check_syndrome(frame_id))
+		if (this->enable_syndrome && syndrome)
 		{
 			cur_syndrome_depth++;
 			if (cur_syndrome_depth == this->syndrome_depth)
@@ -290,10 +290,11 @@ template <> inline mipp::Reg<double> simd_normalize<double,8>(const mipp::Reg<do
 // --------------------------------------------------------------------------------------------------------- SIMD TOOLS
 // --------------------------------------------------------------------------------------------------------------------
 
-// BP algorithm
+// BP algorithm, returns true if the syndrome of all the frames is verified: the parity of a check node is taken on the a
+// posteriori LLRs read at the beginning of its update and no hard decision has to change during the iteration
 template <typename B, typename R>
 template <int F>
-void Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
+bool Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
 ::_decode_single_ite(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches)
 {
 	auto kr = 0;
@@ -301,17 +302,23 @@ void Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
 
 	const auto zero_msk    = mipp::Msk<mipp::N<B>()>(false);
 	const auto zero        = mipp::Reg<R>((R)0);
-	const auto n_chk_nodes = (int)H.get_n_cols();
+	const auto n_chk_nodes = (int)this->Hc.get_n_cols();
+	auto unsat = zero_msk;
 	for (auto c = 0; c < n_chk_nodes; c++)
 	{
-		auto sign = zero_msk;
-		auto min1 = mipp::Reg<R>(std::numeric_limits<R>::max());
-		auto min2 = mipp::Reg<R>(std::numeric_limits<R>::max());
+		auto sign   = zero_msk;
+		auto parity = zero_msk;
+		auto min1   = mipp::Reg<R>(std::numeric_limits<R>::max());
+		auto min2   = mipp::Reg<R>(std::numeric_limits<R>::max());
 
-		const auto chk_degree = (int)this->H[c].size();
+		const auto chk_node   = this->Hc[c];
+		const auto chk_degree = (int)chk_node.size();
 		for (auto v = 0; v < chk_degree; v++)
 		{
-			contributions[v]    = var_nodes[this->H[c][v]] - branches[kr++];
+			const auto app = var_nodes[chk_node[v]];
+			parity ^= mipp::sign(app);
+
+			contributions[v]    = app - branches[kr++];
 			const auto var_abs  = mipp::abs (contributions[v]);
 			const auto var_sign = mipp::sign(contributions[v]);
 			const auto tmp      = min1;
@@ -335,38 +342,16 @@ void Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
 			const auto res_sng = sign ^ mipp::sign(var_val);
 			const auto res     = mipp::copysign(res_abs, res_sng);
 
-			branches[kw++] = res;
-			var_nodes[this->H[c][v]] = contributions[v] + res;
-		}
-	}
-}
+			const auto app = contributions[v] + res;
+			unsat |= mipp::sign(app) ^ mipp::sign(var_nodes[chk_node[v]]);
 
-template <typename B, typename R>
-bool Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
-::_check_syndrome(const int frame_id)
-{
-	const auto cur_wave = frame_id / this->simd_inter_frame_level;
-	const auto zero = mipp::Msk<mipp::N<B>()>(false);
-	auto syndrome = zero;
-
-	auto n_chk_nodes = (int)H.get_n_cols();
-	auto c = 0;
-	auto syndrome_scalar = true;
-	while (c < n_chk_nodes && (syndrome_scalar = mipp::testz(syndrome)))
-	{
-		auto sign = zero;
-		const auto chk_degree = (int)this->H[c].size();
-		for (auto v = 0; v < chk_degree; v++)
-		{
-			const auto value = this->var_nodes[cur_wave][this->H[c][v]];
-			sign ^= mipp::sign(value);
+			branches[kw++] = res;
+			var_nodes[chk_node[v]] = app;
 		}
-
-		syndrome |= sign;
-		c++;
+		unsat |= parity;
 	}
 
-	return syndrome_scalar;
+	return mipp::testz(unsat);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -55,8 +55,7 @@ protected:
 	template <int F = 1>
 	void _decode(const int frame_id);
 	template <int F = 1>
-	void _decode_single_ite(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches);
-	bool _check_syndrome(const int frame_id);
+	bool _decode_single_ite(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches);
 };
 }
 }
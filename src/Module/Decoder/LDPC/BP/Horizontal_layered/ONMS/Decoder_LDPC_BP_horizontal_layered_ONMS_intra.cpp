@@ -0,0 +1,406 @@
+#include <limits>
+#include <cmath>
+#include <sstream>
+#include <typeinfo>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/LDPC/QC/QC.hpp"
+
+#include "Decoder_LDPC_BP_horizontal_layered_ONMS_intra.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+namespace
+{
+// the degree of a variable node is the number of circulants in its block column
+size_t var_nodes_max_degree(const std::vector<std::vector<int>> &base)
+{
+	size_t max_degree = 0;
+	for (size_t j = 0; !base.empty() && j < base[0].size(); j++)
+	{
+		size_t degree = 0;
+		for (auto &row : base)
+			degree += row[j] != -1;
+		max_degree = std::max(max_degree, degree);
+	}
+	return max_degree;
+}
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::Decoder_LDPC_BP_horizontal_layered_ONMS_intra(const int K, const int N, const int n_ite,
+                                                const tools::Sparse_matrix &_H,
+                                                const int Z,
+                                                const std::vector<unsigned> &info_bits_pos,
+                                                const float normalize_factor,
+                                                const R offset,
+                                                const bool enable_syndrome,
+                                                const int syndrome_depth,
+                                                const int n_frames)
+: Decoder               (K, N, n_frames, 1                                    ),
+  Decoder_SISO_SIHO<B,R>(K, N, n_frames, 1                                    ),
+  Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth     ),
+  Z                     (Z                                                    ),
+  Z_simd                (((Z + mipp::N<R>() -1) / mipp::N<R>()) * mipp::N<R>()),
+  normalize_factor      (normalize_factor                                     ),
+  offset                (offset                                               ),
+  saturation            (compute_saturation(this->H.get_rows_max_degree())    ),
+  info_bits_pos         (info_bits_pos                                        ),
+  init_flag             (true                                                 )
+{
+	// compact representation of the base matrix (throws if 'H' is not made of Z x Z circulants)
+	this->init(tools::QC::get_base_matrix(this->H, Z));
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::Decoder_LDPC_BP_horizontal_layered_ONMS_intra(const int K, const int N, const int n_ite,
+                                                const std::vector<std::vector<int>> &base,
+                                                const int Z,
+                                                const std::vector<unsigned> &info_bits_pos,
+                                                const float normalize_factor,
+                                                const R offset,
+                                                const bool enable_syndrome,
+                                                const int syndrome_depth,
+                                                const int n_frames)
+: Decoder               (K, N, n_frames, 1                                    ),
+  Decoder_SISO_SIHO<B,R>(K, N, n_frames, 1                                    ),
+  Decoder_LDPC_BP       (K, N, n_ite, enable_syndrome, syndrome_depth         ),
+  Z                     (Z                                                    ),
+  Z_simd                (((Z + mipp::N<R>() -1) / mipp::N<R>()) * mipp::N<R>()),
+  normalize_factor      (normalize_factor                                     ),
+  offset                (offset                                               ),
+  saturation            (compute_saturation(var_nodes_max_degree(base))       ),
+  info_bits_pos         (info_bits_pos                                        ),
+  init_flag             (true                                                 )
+{
+	if (Z <= 0 || base.empty() || N != (int)base[0].size() * Z)
+	{
+		std::stringstream message;
+		message << "'N' has to be equal to the number of columns of 'base' times 'Z' ('N' = " << N
+		        << ", 'base[0].size()' = " << (base.empty() ? 0 : base[0].size()) << ", 'Z' = " << Z << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->init(base);
+}
+
+template <typename B, typename R>
+R Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::compute_saturation(const size_t max_degree)
+{
+	return (R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(max_degree))) -1);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::init(const std::vector<std::vector<int>> &base)
+{
+	const std::string name = "Decoder_LDPC_BP_horizontal_layered_ONMS_intra";
+	this->set_name(name);
+
+	if (sizeof(R) == 1)
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "This decoder does not work in 8-bit fixed-point.");
+
+	if (saturation <= 0)
+	{
+		std::stringstream message;
+		message << "'saturation' has to be greater than 0 ('saturation' = " << saturation << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	size_t n_circulants = 0, max_degree = 0;
+	for (auto &row : base)
+	{
+		std::vector<Circulant> layer;
+		for (size_t j = 0; j < row.size(); j++)
+			if (row[j] != -1)
+				layer.push_back({(int)j, row[j]});
+
+		n_circulants += layer.size();
+		max_degree = std::max(max_degree, layer.size());
+		this->layers.push_back(layer);
+	}
+
+	const auto n_frames = Decoder_SIHO<B,R>::n_frames;
+	this->var_nodes    .resize(n_frames, mipp::vector<R>(this->N));
+	this->branches     .resize(n_frames, mipp::vector<R>(n_circulants * this->Z_simd));
+	this->contributions.resize(max_degree * this->Z_simd);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::reset()
+{
+	this->init_flag = true;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::_load(const R *Y_N, const int frame_id)
+{
+	// memory zones initialization
+	if (this->init_flag)
+	{
+		std::fill(this->branches [frame_id].begin(), this->branches [frame_id].end(), (R)0);
+		std::fill(this->var_nodes[frame_id].begin(), this->var_nodes[frame_id].end(), (R)0);
+
+		if (frame_id == Decoder_SIHO<B,R>::n_frames -1)
+			this->init_flag = false;
+	}
+
+	for (auto v = 0; v < this->N; v++)
+		this->var_nodes[frame_id][v] += Y_N[v]; // var_nodes contain previous extrinsic information
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	// memory zones initialization
+	this->_load(Y_N1, frame_id);
+
+	// actual decoding
+	this->_decode(frame_id);
+
+	// prepare for next round by processing extrinsic information
+	for (auto v = 0; v < this->N; v++)
+		Y_N2[v] = this->var_nodes[frame_id][v] - Y_N1[v];
+
+	// copy extrinsic information into var_nodes for next TURBO iteration
+	std::copy(Y_N2, Y_N2 + this->N, this->var_nodes[frame_id].begin());
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N, frame_id);
+	this->_decode(frame_id);
+
+	// take the hard decision
+	for (auto i = 0; i < this->K; i++)
+	{
+		const auto k = this->info_bits_pos[i];
+		V_K[i] = !(this->var_nodes[frame_id][k] >= 0);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N, frame_id);
+	this->_decode(frame_id);
+
+	// take the hard decision
+	for (auto v = 0; v < this->N; v++)
+		V_N[v] = !(this->var_nodes[frame_id][v] >= 0);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::_decode(const int frame_id)
+{
+	if (typeid(R) == typeid(short))
+	{
+		     if (normalize_factor == 0.125f) this->_decode_ite<1>(frame_id);
+		else if (normalize_factor == 0.250f) this->_decode_ite<2>(frame_id);
+		else if (normalize_factor == 0.375f) this->_decode_ite<3>(frame_id);
+		else if (normalize_factor == 0.500f) this->_decode_ite<4>(frame_id);
+		else if (normalize_factor == 0.625f) this->_decode_ite<5>(frame_id);
+		else if (normalize_factor == 0.750f) this->_decode_ite<6>(frame_id);
+		else if (normalize_factor == 0.875f) this->_decode_ite<7>(frame_id);
+		else if (normalize_factor == 1.000f) this->_decode_ite<8>(frame_id);
+		else
+		{
+			std::stringstream message;
+			message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
+			        << " ('normalize_factor' = " << normalize_factor << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+	else // float or double
+	{
+		if (normalize_factor == 1.000f) this->_decode_ite<8>(frame_id);
+		else                            this->_decode_ite<0>(frame_id);
+	}
+}
+
+template <typename B, typename R>
+template <int F>
+void Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::_decode_ite(const int frame_id)
+{
+	auto cur_syndrome_depth = 0;
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		if (this->is_cancelled()) // the frame will be thrown away
+			break;
+
+		const auto syndrome = this->_decode_single_ite<F>(this->var_nodes[frame_id], this->branches[frame_id]);
+
+		// stop criterion
+		if (this->enable_syndrome && syndrome)
+		{
+			cur_syndrome_depth++;
+			if (cur_syndrome_depth == this->syndrome_depth)
+				break;
+		}
+		else
+			cur_syndrome_depth = 0;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::load_circulant(const R *var_nodes, const Circulant &c, R *out)
+{
+	// out[k] = var_nodes[c.col * Z + (k + c.shift) % Z], the padding is set to 0 (it does not change the signs)
+	const auto blk = var_nodes + c.col * this->Z;
+	std::copy(blk + c.shift, blk + this->Z,       out                     );
+	std::copy(blk,           blk + c.shift,       out + this->Z - c.shift );
+	std::fill(out + this->Z, out + this->Z_simd, (R)0);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::store_circulant(const R *in, const Circulant &c, R *var_nodes)
+{
+	const auto blk = var_nodes + c.col * this->Z;
+	std::copy(in,                     in + this->Z - c.shift, blk + c.shift);
+	std::copy(in + this->Z - c.shift, in + this->Z,           blk          );
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+
+namespace
+{
+// --------------------------------------------------------------------------------------------------------- saturation
+template <typename R>
+inline mipp::Reg<R> simd_sat(const mipp::Reg<R> val, const R saturation)
+{
+	return val;
+}
+template <>
+inline mipp::Reg<short> simd_sat(const mipp::Reg<short> v, const short s)
+{
+	return mipp::sat(v, (short)-s, (short)+s);
+}
+
+// ------------------------------------------------------------------------------------------------------ normalization
+template <typename R, int F = 0> inline mipp::Reg<R> simd_normalize(const mipp::Reg<R> val, const float factor)
+{
+	return val * mipp::Reg<R>((R)factor);
+}
+template <> inline mipp::Reg<short > simd_normalize<short, 1>(const mipp::Reg<short > v, const float f) { return (v >> 3);                       } // v * 0.125
+template <> inline mipp::Reg<short > simd_normalize<short, 2>(const mipp::Reg<short > v, const float f) { return            (v >> 2);            } // v * 0.250
+template <> inline mipp::Reg<short > simd_normalize<short, 3>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2);            } // v * 0.375
+template <> inline mipp::Reg<short > simd_normalize<short, 4>(const mipp::Reg<short > v, const float f) { return                       (v >> 1); } // v * 0.500
+template <> inline mipp::Reg<short > simd_normalize<short, 5>(const mipp::Reg<short > v, const float f) { return (v >> 3) +            (v >> 1); } // v * 0.625
+template <> inline mipp::Reg<short > simd_normalize<short, 6>(const mipp::Reg<short > v, const float f) { return            (v >> 2) + (v >> 1); } // v * 0.750
+template <> inline mipp::Reg<short > simd_normalize<short, 7>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2) + (v >> 1); } // v * 0.825
+template <> inline mipp::Reg<short > simd_normalize<short, 8>(const mipp::Reg<short > v, const float f) { return v;                              } // v * 1.000
+template <> inline mipp::Reg<float > simd_normalize<float, 8>(const mipp::Reg<float > v, const float f) { return v;                              } // v * 1.000
+template <> inline mipp::Reg<double> simd_normalize<double,8>(const mipp::Reg<double> v, const float f) { return v;                              } // v * 1.000
+}
+
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+// --------------------------------------------------------------------------------------------------------------------
+
+// BP algorithm, returns true if the syndrome is verified: the parity of a check node is taken on the a posteriori LLRs
+// read at the beginning of its update and no hard decision has to change during the iteration
+template <typename B, typename R>
+template <int F>
+bool Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,R>
+::_decode_single_ite(mipp::vector<R> &var_nodes, mipp::vector<R> &branches)
+{
+	const auto zero = mipp::Reg<R>((R)0);
+	const auto vmax = mipp::Reg<R>(std::numeric_limits<R>::max());
+
+	auto unsat = mipp::Msk<mipp::N<R>()>(false);
+
+	auto bra = branches.data();
+	auto ctr = this->contributions.data();
+	for (auto &layer : this->layers)
+	{
+		const auto n_circ = (int)layer.size();
+
+		for (auto b = 0; b < n_circ; b++)
+			this->load_circulant(var_nodes.data(), layer[b], ctr + b * this->Z_simd);
+
+		// the Z check nodes of the layer are independent: they are processed in the SIMD lanes
+		for (auto k = 0; k < this->Z_simd; k += mipp::N<R>())
+		{
+			auto sign   = mipp::Msk<mipp::N<R>()>(false);
+			auto parity = mipp::Msk<mipp::N<R>()>(false);
+			auto min1   = vmax;
+			auto min2   = vmax;
+
+			for (auto b = 0; b < n_circ; b++)
+			{
+				const auto off      = b * this->Z_simd + k;
+				const auto app      = mipp::Reg<R>(ctr + off);
+				const auto contrib  = app - mipp::Reg<R>(bra + off);
+
+				parity ^= mipp::sign(app);
+				const auto var_abs  = mipp::abs (contrib);
+				const auto var_sign = mipp::sign(contrib);
+				const auto tmp      = min1;
+
+				contrib.store(ctr + off);
+
+				sign ^= var_sign;
+				min1  = mipp::min(min1,           var_abs      );
+				min2  = mipp::min(min2, mipp::max(var_abs, tmp));
+			}
+
+			auto cste1 = simd_sat<R>(simd_normalize<R,F>(min2 - offset, normalize_factor), saturation);
+			auto cste2 = simd_sat<R>(simd_normalize<R,F>(min1 - offset, normalize_factor), saturation);
+
+			cste1 = mipp::blend(zero, cste1, zero > cste1);
+			cste2 = mipp::blend(zero, cste2, zero > cste2);
+
+			for (auto b = 0; b < n_circ; b++)
+			{
+				const auto off     = b * this->Z_simd + k;
+				const auto contrib = mipp::Reg<R>(ctr + off);
+				const auto old_app = contrib + mipp::Reg<R>(bra + off);
+				const auto res_abs = mipp::blend(cste1, cste2, mipp::abs(contrib) == min1);
+				const auto res_sng = sign ^ mipp::sign(contrib);
+				const auto res     = mipp::copysign(res_abs, res_sng);
+				const auto app     = contrib + res;
+
+				unsat |= mipp::sign(app) ^ mipp::sign(old_app);
+
+				res.store(bra + off);
+				app.store(ctr + off);
+			}
+			unsat |= parity;
+		}
+
+		for (auto b = 0; b < n_circ; b++)
+			this->store_circulant(ctr + b * this->Z_simd, layer[b], var_nodes.data());
+
+		bra += n_circ * this->Z_simd;
+	}
+
+	return mipp::testz(unsat);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_horizontal_layered_ONMS_intra<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
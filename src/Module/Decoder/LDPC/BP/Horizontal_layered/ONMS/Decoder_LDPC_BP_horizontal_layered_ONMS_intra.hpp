@@ -0,0 +1,101 @@
+#ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_ONMS_INTRA_HPP_
+#define DECODER_LDPC_BP_HORIZONTAL_LAYERED_ONMS_INTRA_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "../../../../Decoder_SISO_SIHO.hpp"
+#include "../../Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_BP_horizontal_layered_ONMS_intra
+ *
+ * \brief Horizontal layered Offset/Normalized Min-Sum decoder for the QC-LDPC codes. The SIMD instructions process
+ *        the Z check nodes of a layer at once (intra-frame strategy), Z is the lifting size of the code.
+ *
+ * A layer is a row of Z x Z circulant permutation matrices in the base matrix: its Z check nodes do not share any
+ * variable node. Only the block column and the shift of each circulant are stored, the variable nodes of a circulant
+ * are read and written with a cyclic shift.
+ *
+ * The decoder can be built from the base matrix and Z directly (ex: a 5G NR base graph), then H is never expanded.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_horizontal_layered_ONMS_intra : public Decoder_SISO_SIHO<B,R>, public Decoder_LDPC_BP
+{
+private:
+	struct Circulant
+	{
+		int col;   // the block column in the base matrix
+		int shift; // the check node 'k' of the layer is connected to the variable node 'col * Z + (k + shift) % Z'
+	};
+
+	const int   Z;      // lifting size
+	const int   Z_simd; // lifting size rounded up to a multiple of the SIMD width
+	const float normalize_factor;
+	const R     offset;
+	const R     saturation;
+
+	std::vector<std::vector<Circulant>> layers; // the circulants of each row of the base matrix
+
+protected:
+	const std::vector<unsigned> &info_bits_pos;
+
+	bool init_flag; // reset the branches at the beginning of the iterative decoding
+
+	// data structures for iterative decoding
+	std::vector<mipp::vector<R>> var_nodes;
+	std::vector<mipp::vector<R>> branches;      // the check to variable messages, circulant after circulant
+	mipp::vector<R>              contributions; // the variable to check messages of the current layer
+
+public:
+	Decoder_LDPC_BP_horizontal_layered_ONMS_intra(const int K, const int N, const int n_ite,
+	                                              const tools::Sparse_matrix &H,
+	                                              const int Z,
+	                                              const std::vector<unsigned> &info_bits_pos,
+	                                              const float normalize_factor = 1.f,
+	                                              const R offset = (R)0,
+	                                              const bool enable_syndrome = true,
+	                                              const int syndrome_depth = 1,
+	                                              const int n_frames = 1);
+	Decoder_LDPC_BP_horizontal_layered_ONMS_intra(const int K, const int N, const int n_ite,
+	                                              const std::vector<std::vector<int>> &base,
+	                                              const int Z,
+	                                              const std::vector<unsigned> &info_bits_pos,
+	                                              const float normalize_factor = 1.f,
+	                                              const R offset = (R)0,
+	                                              const bool enable_syndrome = true,
+	                                              const int syndrome_depth = 1,
+	                                              const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_horizontal_layered_ONMS_intra() = default;
+
+	void reset();
+
+protected:
+	void _decode_siso   (const R *Y_N1, R *Y_N2, const int frame_id);
+	void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
+
+	void _load  (const R *Y_N, const int frame_id);
+	void _decode(const int frame_id);
+	template <int F = 1>
+	void _decode_ite(const int frame_id);
+	template <int F = 1>
+	bool _decode_single_ite(mipp::vector<R> &var_nodes, mipp::vector<R> &branches);
+
+private:
+	void init(const std::vector<std::vector<int>> &base);
+
+	// the greatest value of the messages such that the sum of the messages of a variable node does not overflow
+	static R compute_saturation(const size_t max_degree);
+
+	inline void load_circulant (const R *var_nodes, const Circulant &c, R *out      );
+	inline void store_circulant(const R *in,        const Circulant &c, R *var_nodes);
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_HORIZONTAL_LAYERED_ONMS_INTRA_HPP_ */
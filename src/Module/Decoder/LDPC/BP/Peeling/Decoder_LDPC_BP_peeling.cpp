@@ -19,78 +19,94 @@ Decoder_LDPC_BP_peeling<B,R>::Decoder_LDPC_BP_peeling(const int K, const int N,
 
   info_bits_pos  (info_bits_pos       ),
   var_nodes      (N                   ),
-  check_nodes    (this->H.get_n_cols())
+  check_nodes    (this->H.get_n_cols()),
+  chk_degree     (this->H.get_n_cols()),
+  chk_unknown    (this->H.get_n_cols())
 {
 	const std::string name = "Decoder_LDPC_BP_peeling";
 	this->set_name(name);
+
+	// a check node becomes degree-one at most once per frame
+	this->cur_queue.reserve(this->H.get_n_cols());
 }
 
 template <typename B, typename R>
 bool Decoder_LDPC_BP_peeling<B,R>
 ::_decode(const int frame_id)
 {
-	this->cur_syndrome_depth = 0;
-	auto links = this->H;
-
 	auto& CN = this->check_nodes;
 	auto& VN = this->var_nodes;
 
-	std::fill(CN.begin(), CN.end(), (B)0);
-
-	// first forward known values
-	for (unsigned i = 0; i < links.get_n_rows(); i++)
+	// first forward known values and count the unknown ones
+	const auto n_chk_nodes = (uint32_t)this->Hc.get_n_cols();
+	for (uint32_t c = 0; c < n_chk_nodes; c++)
 	{
-		auto cur_state = VN[i];
-		if (!tools::is_unknown_symbol<B>(cur_state))
-		{
-			auto& cn_list = links.get_cols_from_row(i);
-			while (cn_list.size())
+		B        parity  = 0;
+		uint32_t degree  = 0;
+		uint32_t unknown = 0;
+		for (auto v : this->Hc.get_rows_from_col(c))
+			if (tools::is_unknown_symbol<B>(VN[v]))
 			{
-				auto& cn_pos = cn_list.front();
-
-				CN[cn_pos] ^= cur_state;
-				links.rm_connection(i, cn_pos);
+				degree++;
+				unknown ^= (uint32_t)v;
 			}
-		}
+			else
+				parity ^= VN[v];
+
+		CN                [c] = parity;
+		this->chk_degree  [c] = degree;
+		this->chk_unknown [c] = unknown;
 	}
 
-	bool all_check_nodes_done = false;
+	this->cur_queue.clear();
+	auto n_pending = (uint32_t)0; // number of check nodes with unknown variable nodes
+	for (uint32_t c = 0; c < n_chk_nodes; c++)
+	{
+		if (this->chk_degree[c] == 1)
+			this->cur_queue.push_back(c);
+		if (this->chk_degree[c] != 0)
+			n_pending++;
+	}
 
+	this->cur_syndrome_depth = 0;
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
-		bool no_modification = true;
-		all_check_nodes_done = true;
+		if (this->is_cancelled()) // the frame will be thrown away
+			break;
 
-		// find degree-1 check nodes
-		for (unsigned i = 0; i < links.get_n_cols(); i++)
+		// the check nodes which become degree-one are appended to the work list and processed during the same
+		// iteration, as the sweep over all the check nodes did
+		auto no_modification = true;
+		for (size_t i = 0; i < this->cur_queue.size(); i++)
 		{
-			auto& vn_list = links.get_rows_from_col(i);
-			if (vn_list.size() == 1)
+			const auto c = this->cur_queue[i];
+
+			// the last unknown variable node may have been recovered by another check node in the meantime
+			if (this->chk_degree[c] != 1)
+				continue;
+
+			no_modification = false;
+
+			// forward the belief: the only unknown variable node left is given by the xor of the indexes
+			const auto vn_pos    = this->chk_unknown[c];
+			const auto cur_state = CN[c];
+			VN[vn_pos] = cur_state;
+
+			// and propagate it
+			for (auto cn_pos : this->Hc.get_cols_from_row(vn_pos))
 			{
-				no_modification = false;
-
-				// then forward the belief
-				auto& vn_pos = vn_list.front();
-				auto cur_state = CN[i];
-				VN[vn_pos] = cur_state;
-				CN[     i] = 0;
-				links.rm_connection(vn_pos, i);
-
-				// and propagate it
-				auto& cn_list = links.get_cols_from_row(vn_pos);
-				while (cn_list.size())
-				{
-					auto& cn_pos = cn_list.front();
-
-					CN[cn_pos] ^= cur_state;
-					links.rm_connection(vn_pos, cn_pos);
-				}
+				CN               [cn_pos] ^= cur_state;
+				this->chk_unknown[cn_pos] ^= vn_pos;
+				const auto degree = --this->chk_degree[cn_pos];
+				if (degree == 1)
+					this->cur_queue.push_back((uint32_t)cn_pos);
+				else if (degree == 0)
+					n_pending--;
 			}
-			else
-				all_check_nodes_done &= vn_list.size() == 0;
 		}
+		this->cur_queue.clear();
 
-		if (this->enable_syndrome && (all_check_nodes_done || no_modification))
+		if (this->enable_syndrome && (n_pending == 0 || no_modification))
 		{
 			this->cur_syndrome_depth++;
 			if (this->cur_syndrome_depth >= this->syndrome_depth)
@@ -100,7 +116,7 @@ bool Decoder_LDPC_BP_peeling<B,R>
 			this->cur_syndrome_depth = 0;
 	}
 
-	return all_check_nodes_done;
+	return n_pending == 0;
 };
 
 template <typename B, typename R>
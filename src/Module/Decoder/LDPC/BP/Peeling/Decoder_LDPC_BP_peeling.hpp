@@ -1,6 +1,9 @@
 #ifndef DECODER_LDPC_BP_PEELING_HPP
 #define DECODER_LDPC_BP_PEELING_HPP
 
+#include <vector>
+#include <cstdint>
+
 #include "../../../Decoder_SIHO_HIHO.hpp"
 #include "../Decoder_LDPC_BP.hpp"
 
@@ -9,6 +12,13 @@ namespace aff3ct
 namespace module
 {
 
+/*
+ * Peeling decoder for the binary erasure channel: the check nodes with one unknown variable node left (degree-one
+ * check nodes) are kept in a work list. Each recovered variable node decrements the residual degree of its check nodes
+ * and pushes the ones which become degree-one, so each connection is visited a constant number of times per frame.
+ * The check nodes pushed during an iteration are processed in the same iteration (the work list is peeled until it is
+ * empty), so an iteration recovers at least the erasures of an iteration of a sweep over all the check nodes.
+ */
 template<typename B = int, typename R = float>
 class Decoder_LDPC_BP_peeling : public Decoder_SIHO_HIHO<B,R>, public Decoder_LDPC_BP
 {
@@ -16,8 +26,11 @@ protected:
 	const std::vector<unsigned> &info_bits_pos;
 
 	// data structures for iterative decoding
-	std::vector<B> var_nodes;
-	std::vector<B> check_nodes;
+	std::vector<B       > var_nodes;
+	std::vector<B       > check_nodes;  // parity of the known variable nodes of each check node
+	std::vector<uint32_t> chk_degree;   // number of unknown variable nodes of each check node
+	std::vector<uint32_t> chk_unknown;  // xor of the indexes of the unknown variable nodes of each check node
+	std::vector<uint32_t> cur_queue;    // degree-one check nodes of the current iteration
 
 public:
 	Decoder_LDPC_BP_peeling(const int K, const int N, const int n_ite,
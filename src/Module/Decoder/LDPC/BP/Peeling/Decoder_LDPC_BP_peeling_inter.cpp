@@ -0,0 +1,245 @@
+#include <algorithm>
+
+#include "Tools/Perf/common/hard_decide.h"
+#include "Tools/Noise/noise_utils.h"
+
+#include "Decoder_LDPC_BP_peeling_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+constexpr size_t Decoder_LDPC_BP_peeling_inter<B,R>::n_words;
+
+template <typename B, typename R>
+constexpr size_t Decoder_LDPC_BP_peeling_inter<B,R>::n_lanes;
+
+template<typename B, typename R>
+Decoder_LDPC_BP_peeling_inter<B,R>
+::Decoder_LDPC_BP_peeling_inter(const int K, const int N, const int n_ite,
+                                const tools::Sparse_matrix &_H,
+                                const std::vector<unsigned> &info_bits_pos,
+                                const bool enable_syndrome, const int syndrome_depth,
+                                const int n_frames)
+: Decoder               (K, N, n_frames, (int)n_lanes                    ),
+  Decoder_SIHO_HIHO<B,R>(K, N, n_frames, (int)n_lanes                    ),
+  Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth),
+  info_bits_pos         (info_bits_pos                                   ),
+  HY_N                  (N                                               ),
+  known                 (N * n_words                                     ),
+  value                 (N * n_words                                     ),
+  queued                (this->H.get_n_cols(), 0                         )
+{
+	const std::string name = "Decoder_LDPC_BP_peeling_inter";
+	this->set_name(name);
+
+	// a check node is at most once in the work list
+	this->cur_queue.reserve(this->H.get_n_cols());
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_load(const B *Y_N, const size_t f)
+{
+	for (auto v = 0; v < this->N; v++)
+		if (!tools::is_unknown_symbol<B>(Y_N[v]))
+		{
+			this->known[v * n_words + f / 64] |= (W)1             << (f % 64);
+			this->value[v * n_words + f / 64] |= (W)(Y_N[v] != 0) << (f % 64);
+		}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_store(B *V_K)
+{
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto i = 0; i < this->K; i++)
+		{
+			const auto v = this->info_bits_pos[i];
+			V_K[f * this->K + i] = ((this->known[v * n_words + f / 64] >> (f % 64)) & 1) ?
+			                       (B)((this->value[v * n_words + f / 64] >> (f % 64)) & 1) :
+			                       tools::unknown_symbol_val<B>();
+		}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_store_cw(B *V_N)
+{
+	for (size_t f = 0; f < n_lanes; f++)
+		for (auto v = 0; v < this->N; v++)
+			V_N[f * this->N + v] = ((this->known[v * n_words + f / 64] >> (f % 64)) & 1) ?
+			                       (B)((this->value[v * n_words + f / 64] >> (f % 64)) & 1) :
+			                       tools::unknown_symbol_val<B>();
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+	std::fill(this->known.begin(), this->known.end(), (W)0);
+	std::fill(this->value.begin(), this->value.end(), (W)0);
+	for (size_t f = 0; f < n_lanes; f++)
+		this->_load(Y_N + f * this->N, f);
+
+	this->_decode();
+	this->_store(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+	std::fill(this->known.begin(), this->known.end(), (W)0);
+	std::fill(this->value.begin(), this->value.end(), (W)0);
+	for (size_t f = 0; f < n_lanes; f++)
+		this->_load(Y_N + f * this->N, f);
+
+	this->_decode();
+	this->_store_cw(V_N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	std::fill(this->known.begin(), this->known.end(), (W)0);
+	std::fill(this->value.begin(), this->value.end(), (W)0);
+	for (size_t f = 0; f < n_lanes; f++)
+	{
+		tools::hard_decide_unk(Y_N + f * this->N, this->HY_N.data(), this->N);
+		this->_load(this->HY_N.data(), f);
+	}
+
+	this->_decode();
+	this->_store(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	std::fill(this->known.begin(), this->known.end(), (W)0);
+	std::fill(this->value.begin(), this->value.end(), (W)0);
+	for (size_t f = 0; f < n_lanes; f++)
+	{
+		tools::hard_decide_unk(Y_N + f * this->N, this->HY_N.data(), this->N);
+		this->_load(this->HY_N.data(), f);
+	}
+
+	this->_decode();
+	this->_store_cw(V_N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_decode()
+{
+	// all the check nodes are processed during the first iteration
+	const auto n_chk_nodes = (uint32_t)this->Hc.get_n_cols();
+	this->cur_queue.resize(n_chk_nodes);
+	for (uint32_t c = 0; c < n_chk_nodes; c++)
+		this->cur_queue[c] = c;
+	std::fill(this->queued.begin(), this->queued.end(), (uint8_t)1);
+
+	this->cur_syndrome_depth = 0;
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		if (this->is_cancelled()) // the frames will be thrown away
+			break;
+
+		// as in the scalar decoder, the check nodes put in the work list during an iteration are processed in the
+		// same iteration
+		auto no_modification = true;
+		for (size_t i = 0; i < this->cur_queue.size(); i++)
+		{
+			const auto c = this->cur_queue[i];
+			this->queued[c] = 0;
+
+			W one[n_words], parity[n_words];
+			if (this->_find(c, one, parity))
+			{
+				no_modification = false;
+				this->_peel(c, one, parity);
+			}
+		}
+		this->cur_queue.clear();
+
+		// the work list is empty at the end of an iteration: the next one can not recover anything
+		if (this->enable_syndrome && no_modification)
+		{
+			this->cur_syndrome_depth++;
+			if (this->cur_syndrome_depth >= this->syndrome_depth)
+				break;
+		}
+		else
+			this->cur_syndrome_depth = 0;
+	}
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_BP_peeling_inter<B,R>
+::_find(const uint32_t c, W *one, W *parity) const
+{
+	// find the frames where only one variable node is unknown ('one' and not 'two') and compute the parity of the
+	// known variable nodes
+	W two[n_words] = {};
+	std::fill(one,    one    + n_words, (W)0);
+	std::fill(parity, parity + n_words, (W)0);
+	for (auto v : this->Hc.get_rows_from_col(c))
+		for (size_t w = 0; w < n_words; w++)
+		{
+			const auto unk = ~this->known[v * n_words + w];
+			two   [w] |= one[w] & unk;
+			one   [w] |= unk;
+			parity[w] ^= this->value[v * n_words + w];
+		}
+
+	W any = 0;
+	for (size_t w = 0; w < n_words; w++)
+	{
+		one[w] &= ~two[w];
+		any    |= one[w];
+	}
+
+	return any != 0;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_peeling_inter<B,R>
+::_peel(const uint32_t c, const W *one, const W *parity)
+{
+	for (auto v : this->Hc.get_rows_from_col(c))
+	{
+		// the variable node is only recovered in the frames where it is still unknown
+		W rec_any = 0;
+		for (size_t w = 0; w < n_words; w++)
+		{
+			const auto rec = one[w] & ~this->known[v * n_words + w];
+			this->known[v * n_words + w] |= rec;
+			this->value[v * n_words + w] |= parity[w] & rec;
+			rec_any |= rec;
+		}
+
+		if (rec_any)
+			for (auto cn_pos : this->Hc.get_cols_from_row(v))
+				if (cn_pos != c && !this->queued[cn_pos])
+				{
+					this->queued[cn_pos] = 1;
+					this->cur_queue.push_back((uint32_t)cn_pos);
+				}
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_peeling_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_peeling_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_peeling_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_peeling_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_peeling_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,74 @@
+#ifndef DECODER_LDPC_BP_PEELING_INTER_HPP
+#define DECODER_LDPC_BP_PEELING_INTER_HPP
+
+#include <vector>
+#include <cstdint>
+#include <mipp.h>
+
+#include "../../../Decoder_SIHO_HIHO.hpp"
+#include "../Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Bit-packed version of the Decoder_LDPC_BP_peeling decoder: the state of a variable node is stored in 'n_words'
+ * 64-bit words for the 'n_lanes' = 64 * 'n_words' frames (one bit per frame for the knowledge and one bit per frame
+ * for the value), so a check node recovers its last unknown variable node in all the frames at once with bitwise
+ * operations. A check node is put back in the work list only when one of its variable nodes has just been recovered in
+ * at least one frame. As in the scalar decoder, the check nodes put in the work list during an iteration are processed
+ * in the same iteration.
+ */
+template<typename B = int, typename R = float>
+class Decoder_LDPC_BP_peeling_inter : public Decoder_SIHO_HIHO<B,R>, public Decoder_LDPC_BP
+{
+public:
+	using W = uint64_t;
+	static constexpr size_t n_words = (size_t)mipp::N<int64_t>();
+	static constexpr size_t n_lanes = 64 * n_words;
+
+protected:
+	const std::vector<unsigned> &info_bits_pos;
+
+	std::vector<B       > HY_N;       // hard decisions of one frame
+	std::vector<W       > known;      // mask of the known variable nodes (N words groups)
+	std::vector<W       > value;      // values of the known variable nodes (N words groups)
+	std::vector<uint8_t > queued;     // true if the check node is in the work list
+	std::vector<uint32_t> cur_queue;  // check nodes to process during the current iteration
+
+public:
+	Decoder_LDPC_BP_peeling_inter(const int K, const int N, const int n_ite,
+	                              const tools::Sparse_matrix &H,
+	                              const std::vector<unsigned> &info_bits_pos,
+	                              const bool enable_syndrome = true,
+	                              const int syndrome_depth = 1,
+	                              const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_peeling_inter() = default;
+
+protected:
+	// set the bits of the frame 'f' in 'known' and 'value'
+	void _load          (const B *Y_N, const size_t f          );
+	void _store         (B *V_K                                );
+	void _store_cw      (B *V_N                                );
+
+	void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
+	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+
+	void _decode();
+
+	// find the frames where the check node has only one unknown variable node left and the parity of the known ones,
+	// return false if there is no such frame
+	bool _find(const uint32_t c, W *one, W *parity) const;
+
+	// recover the last unknown variable node of the check node in the 'one' frames, and put the other check nodes of
+	// the recovered variable nodes in the work list
+	void _peel(const uint32_t c, const W *one, const W *parity);
+};
+
+}
+}
+
+#endif //DECODER_LDPC_BP_PEELING_INTER_HPP
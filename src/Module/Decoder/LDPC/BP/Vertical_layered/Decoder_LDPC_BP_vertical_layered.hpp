@@ -22,7 +22,6 @@ protected:
 	std::vector<std::vector<R>> var_nodes;
 	std::vector<std::vector<R>> messages;
 	std::vector<R             > contributions;
-	std::vector<uint32_t      > messages_offsets;
 
 	bool init_flag; // reset the chk_to_var vector at the begining of the iterative decoding
 
@@ -29,19 +29,10 @@ Decoder_LDPC_BP_vertical_layered<B,R,Update_rule>
   var_nodes             (n_frames, std::vector<R>(N                          )),
   messages              (n_frames, std::vector<R>(this->H.get_n_connections())),
   contributions         (this->H.get_cols_max_degree()                        ),
-  messages_offsets      (this->H.get_n_cols()                                 ),
   init_flag             (true                                                 )
 {
 	const std::string name = "Decoder_LDPC_BP_vertical_layered<" + this->up_rule.get_name() + ">";
 	this->set_name(name);
-
-	size_t cur_off_msg = 0;
-	const auto n_chk_nodes = (int)this->H.get_n_cols();
-	for (auto c = 0; c < n_chk_nodes; c++)
-	{
-		messages_offsets[c] = (uint32_t)cur_off_msg;
-		cur_off_msg += this->H[c].size();
-	}
 }
 
 template <typename B, typename R, class Update_rule>
@@ -144,6 +135,9 @@ void Decoder_LDPC_BP_vertical_layered<B,R,Update_rule>
 
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
+		if (this->is_cancelled()) // the frame will be thrown away
+			break;
+
 		this->up_rule.begin_ite(ite);
 		this->_decode_single_ite(this->var_nodes[frame_id], this->messages[frame_id]);
 		this->up_rule.end_ite();
@@ -160,21 +154,23 @@ void Decoder_LDPC_BP_vertical_layered<B,R,Update_rule>
 ::_decode_single_ite(std::vector<R> &var_nodes, std::vector<R> &messages)
 {
 	// vertical layered scheduling
-	const auto n_var_nodes = (int)this->H.get_n_rows();
+	const auto n_var_nodes = (int)this->Hc.get_n_rows();
 	for (auto vv = 0; vv < n_var_nodes; vv++)
 	{
 		auto msg_acc = (R)0;
-		const auto var_degree = (int)this->H.get_cols_from_row(vv).size();
+		const auto var_node   = this->Hc.get_cols_from_row(vv);
+		const auto var_degree = (int)var_node.size();
 		for (auto c = 0; c < var_degree; c++)
 		{
 			auto v_out = -1;
-			const auto cc = (int)this->H.get_cols_from_row(vv)[c];
-			const auto off_msg = (int)this->messages_offsets[cc];
-			const auto chk_degree = (int)this->H[cc].size();
+			const auto cc = (int)var_node[c];
+			const auto off_msg = (int)this->Hc.get_col_offset(cc);
+			const auto chk_node   = this->Hc[cc];
+			const auto chk_degree = (int)chk_node.size();
 			this->up_rule.begin_chk_node_in(cc, chk_degree);
 			for (auto v = 0; v < chk_degree; v++)
 			{
-				const auto var_id = this->H[cc][v];
+				const auto var_id = chk_node[v];
 				v_out = (var_id == (unsigned)vv) ? v : v_out;
 				this->contributions[v] = var_nodes[var_id] - messages[off_msg +v];
 				this->up_rule.compute_chk_node_in(v, this->contributions[v]);
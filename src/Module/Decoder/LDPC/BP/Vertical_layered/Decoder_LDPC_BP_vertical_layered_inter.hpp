@@ -27,7 +27,6 @@ protected:
 	std::vector<mipp::vector<mipp::Reg<R>>> messages;
 
 	mipp::vector<mipp::Reg<R>> contributions;
-	std::vector<uint32_t     > messages_offsets;
 	mipp::vector<mipp::Reg<R>> Y_N_reorderered;
 	mipp::vector<mipp::Reg<B>> V_reorderered;
 
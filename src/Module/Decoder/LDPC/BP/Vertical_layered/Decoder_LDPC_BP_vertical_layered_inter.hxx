@@ -35,7 +35,6 @@ Decoder_LDPC_BP_vertical_layered_inter<B,R,Update_rule>
   var_nodes             (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(N)                                   ),
   messages              (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(this->H.get_n_connections())         ),
   contributions         (this->H.get_cols_max_degree()                                                      ),
-  messages_offsets      (this->H.get_n_cols()                                                               ),
   Y_N_reorderered       (N                                                                                  ),
   V_reorderered         (N                                                                                  ),
   init_flag             (true                                                                               )
@@ -49,14 +48,6 @@ Decoder_LDPC_BP_vertical_layered_inter<B,R,Update_rule>
 		message << "'sat_val' has to be greater than 0 ('sat_val' = " << this->sat_val << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
-
-	size_t cur_off_msg = 0;
-	const auto n_chk_nodes = (int)this->H.get_n_cols();
-	for (auto c = 0; c < n_chk_nodes; c++)
-	{
-		messages_offsets[c] = (uint32_t)cur_off_msg;
-		cur_off_msg += this->H[c].size();
-	}
 }
 
 template <typename B, typename R, class Update_rule>
@@ -178,6 +169,9 @@ void Decoder_LDPC_BP_vertical_layered_inter<B,R,Update_rule>
 
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
+		if (this->is_cancelled()) // the frame will be thrown away
+			break;
+
 		this->up_rule.begin_ite(ite);
 		this->_decode_single_ite(this->var_nodes[cur_wave], this->messages[cur_wave]);
 		this->up_rule.end_ite();
@@ -194,21 +188,23 @@ void Decoder_LDPC_BP_vertical_layered_inter<B,R,Update_rule>
 ::_decode_single_ite(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &messages)
 {
 	// vertical layered scheduling
-	const auto n_var_nodes = (int)this->H.get_n_rows();
+	const auto n_var_nodes = (int)this->Hc.get_n_rows();
 	for (auto vv = 0; vv < n_var_nodes; vv++)
 	{
 		auto msg_acc = mipp::Reg<R>((R)0);
-		const auto var_degree = (int)this->H.get_cols_from_row(vv).size();
+		const auto var_node   = this->Hc.get_cols_from_row(vv);
+		const auto var_degree = (int)var_node.size();
 		for (auto c = 0; c < var_degree; c++)
 		{
 			auto v_out = -1;
-			const auto cc = (int)this->H.get_cols_from_row(vv)[c];
-			const auto off_msg = (int)this->messages_offsets[cc];
-			const auto chk_degree = (int)this->H[cc].size();
+			const auto cc = (int)var_node[c];
+			const auto off_msg = (int)this->Hc.get_col_offset(cc);
+			const auto chk_node   = this->Hc[cc];
+			const auto chk_degree = (int)chk_node.size();
 			this->up_rule.begin_chk_node_in(cc, chk_degree);
 			for (auto v = 0; v < chk_degree; v++)
 			{
-				const auto var_id = this->H[cc][v];
+				const auto var_id = chk_node[v];
 				v_out = (var_id == (unsigned)vv) ? v : v_out;
 				this->contributions[v] = var_nodes[var_id] - messages[off_msg +v];
 				this->up_rule.compute_chk_node_in(v, this->contributions[v]);
@@ -234,16 +230,17 @@ bool Decoder_LDPC_BP_vertical_layered_inter<B,R,Update_rule>
 		const auto zero = mipp::Msk<mipp::N<B>()>(false);
 		auto syndrome = zero;
 
-		auto n_chk_nodes = (int)H.get_n_cols();
+		auto n_chk_nodes = (int)this->Hc.get_n_cols();
 		auto c = 0;
 		auto syndrome_scalar = true;
 		while (c < n_chk_nodes && (syndrome_scalar = mipp::testz(syndrome)))
 		{
 			auto sign = zero;
-			const auto chk_degree = (int)this->H[c].size();
+			const auto chk_node   = this->Hc[c];
+			const auto chk_degree = (int)chk_node.size();
 			for (auto v = 0; v < chk_degree; v++)
 			{
-				const auto value = var_nodes[this->H[c][v]];
+				const auto value = var_nodes[chk_node[v]];
 				sign ^= mipp::sign(value);
 			}
 
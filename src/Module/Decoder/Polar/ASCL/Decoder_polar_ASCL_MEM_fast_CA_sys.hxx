@@ -67,7 +67,7 @@ void Decoder_polar_ASCL_MEM_fast_CA_sys<B,R,API_polar>
 				this->init_buffers();
 				this->recursive_decode(Y_N, off_l, off_s, this->m, first_node_id);
 			}
-			while (!this->select_best_path() && this->L < L_max);
+			while (!this->select_best_path() && this->L < L_max && !this->is_cancelled());
 		}
 		else // partial adaptive mode
 		{
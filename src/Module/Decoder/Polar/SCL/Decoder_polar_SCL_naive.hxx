@@ -128,6 +128,9 @@ void Decoder_polar_SCL_naive<B,R,F,G>
 	// run through each leaf
 	for (auto leaf_index = 0 ; leaf_index < this->N; leaf_index++)
 	{
+		if (this->is_cancelled()) // the frame will be thrown away
+			break;
+
 		// compute LLR for current leaf
 		for (auto path : active_paths)
 			this->recursive_compute_llr(leaves_array[path][leaf_index], tools::compute_depth(leaf_index, this->m));
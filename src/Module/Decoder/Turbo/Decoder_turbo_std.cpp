@@ -97,7 +97,7 @@ void Decoder_turbo_std<B,R>
 
 		ite++; // increment the number of iteration
 	}
-	while ((ite <= this->n_ite) && !stop);
+	while ((ite <= this->n_ite) && !stop && !this->is_cancelled()); // a cancelled frame will be thrown away
 
 	for (auto cb : this->callbacks_end)
 		cb(ite -1);
@@ -188,6 +188,9 @@ void Decoder_turbo_product<B,R>
 
 	for (int i = 0; i < n_ite; i++)
 	{
+		if (this->is_cancelled()) // the frame will be thrown away
+			break;
+
 		pi.interleave(Y_N_i.data(), Y_N_pi.data(), 0, 1); // columns becomes rows
 
 		if (beta.size())
@@ -1,7 +1,9 @@
 #include <numeric>
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
+#include "Tools/Algo/Bit_packer.hpp"
 #include "Tools/Code/LDPC/Syndrome/LDPC_syndrome.hpp"
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Math/matrix.h"
@@ -14,7 +16,7 @@ using namespace aff3ct::module;
 template <typename B>
 Encoder_LDPC<B>
 ::Encoder_LDPC(const int K, const int N, const int n_frames)
-: Encoder<B>(K, N, n_frames)
+: Encoder<B>(K, N, n_frames), n_G_words(0)
 {
 	const std::string name = "Encoder_LDPC";
 	this->set_name(name);
@@ -23,7 +25,7 @@ Encoder_LDPC<B>
 template <typename B>
 Encoder_LDPC<B>
 ::Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const int n_frames)
-: Encoder<B>(K, N, n_frames), G(G)
+: Encoder<B>(K, N, n_frames), G(G), n_G_words(0)
 {
 	const std::string name = "Encoder_LDPC";
 	this->set_name(name);
@@ -34,7 +36,7 @@ Encoder_LDPC<B>
 template <typename B>
 Encoder_LDPC<B>
 ::Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const tools::Sparse_matrix &H, const int n_frames)
-: Encoder<B>(K, N, n_frames), G(G), H(H)
+: Encoder<B>(K, N, n_frames), G(G), H(H), n_G_words(0)
 {
 	const std::string name = "Encoder_LDPC";
 	this->set_name(name);
@@ -49,6 +51,33 @@ void Encoder_LDPC<B>
 {
 	G.self_turn(tools::Sparse_matrix::Way::VERTICAL);
 	this->_check_G_dimensions();
+	this->pack_G();
+}
+
+template <typename B>
+void Encoder_LDPC<B>
+::pack_G()
+{
+	this->G_packed.clear();
+	this->n_G_words = 0;
+
+	// the word-parallel encoding costs about K/2 * N/64 word xors per frame (half of the information bits are set)
+	// against one byte addition per connection for the sparse encoding
+	const auto n_connections = (size_t)this->G.get_n_connections();
+	if (n_connections * 128 < (size_t)this->K * (size_t)this->N)
+		return;
+
+	this->n_G_words = ((size_t)this->N + 63) / 64;
+	this->G_packed.assign((size_t)this->K * this->n_G_words, 0);
+	for (auto k = 0; k < this->K; k++)
+	{
+		auto row = this->G_packed.data() + k * this->n_G_words;
+		for (auto i : this->G.get_rows_from_col(k))
+			row[i / 64] ^= (uint64_t)1 << (i % 64);
+	}
+
+	this->U_packed.resize(((size_t)this->K + 63) / 64);
+	this->X_packed.resize(this->n_G_words);
 }
 
 template <typename B>
@@ -97,6 +126,27 @@ template <typename B>
 void Encoder_LDPC<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
+	if (!this->G_packed.empty())
+	{
+		tools::Bit_packer::pack(U_K, this->U_packed.data(), this->K, 1, false, 64);
+
+		std::fill(this->X_packed.begin(), this->X_packed.end(), (uint64_t)0);
+		for (size_t w = 0; w < this->U_packed.size(); w++)
+		{
+			auto u = this->U_packed[w];
+			for (size_t k = w * 64; u; k++, u >>= 1)
+				if (u & 1)
+				{
+					const auto row = this->G_packed.data() + k * this->n_G_words;
+					for (size_t x = 0; x < this->n_G_words; x++)
+						this->X_packed[x] ^= row[x];
+				}
+		}
+
+		tools::Bit_packer::unpack(this->X_packed.data(), X_N, this->N, 1, false, 64);
+		return;
+	}
+
 	for (auto i = 0; i < this->N; i++)
 	{
 		X_N[i] = 0;
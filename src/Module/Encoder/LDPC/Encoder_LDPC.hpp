@@ -2,6 +2,7 @@
 #define ENCODER_LDPC_HPP_
 
 #include <vector>
+#include <cstdint>
 
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 
@@ -25,6 +26,14 @@ protected:
 	                        // H cols are the M dimension (often M = N - K)
 	                        // H rows are the N dimension
 
+	// G transposed and packed in 64-bit words: the row 'k' (n_G_words words) holds the N bits of the column 'k' of G.
+	// It is built only when G is dense enough for the word-parallel encoding (X_N is the sum of the rows selected by
+	// the information bits) to be faster than the sum of the bytes of U_K along the connections of G.
+	std::vector<uint64_t> G_packed;
+	size_t                n_G_words;
+	std::vector<uint64_t> U_packed;
+	std::vector<uint64_t> X_packed;
+
 protected:
 	Encoder_LDPC(const int K, const int N, const int n_frames = 1);
 
@@ -39,6 +48,7 @@ protected:
 	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
 
 	void check_G_dimensions();
+	void pack_G();
 	void check_H_dimensions();
 	virtual void _check_G_dimensions();
 	virtual void _check_H_dimensions();
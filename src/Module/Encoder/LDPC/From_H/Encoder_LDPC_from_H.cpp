@@ -7,6 +7,7 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Code/LDPC/AList/AList.hpp"
+#include "Tools/Code/LDPC/G_cache/G_cache.hpp"
 
 #include "Encoder_LDPC_from_H.hpp"
 
@@ -16,7 +17,7 @@ using namespace aff3ct::module;
 template <typename B>
 Encoder_LDPC_from_H<B>
 ::Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &_H, const std::string& G_method,
-                      const std::string& G_save_path, const int n_frames)
+                      const std::string& G_save_path, const std::string& G_cache_path, const int n_frames)
 : Encoder_LDPC<B>(K, N, n_frames)
 {
 	const std::string name = "Encoder_LDPC_from_H";
@@ -24,17 +25,34 @@ Encoder_LDPC_from_H<B>
 
 	this->H = _H.turn(tools::Matrix::Way::HORIZONTAL);
 
-	if (G_method == "IDENTITY")
-		this->G = tools::LDPC_matrix_handler::transform_H_to_G_identity(this->H, this->info_bits_pos);
-	else if (G_method == "LU_DEC")
-		this->G = tools::LDPC_matrix_handler::transform_H_to_G_decomp_LU(this->H, this->info_bits_pos);
-	else
+	if (G_method != "IDENTITY" && G_method != "LU_DEC")
 	{
 		std::stringstream message;
 		message << "Generation method of G 'G_method' is unknown ('G_method' = \"" << G_method << "\").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	uint64_t    cache_key = 0;
+	std::string cache_filename;
+	bool        cached = false;
+	if (G_cache_path != "")
+	{
+		cache_key      = tools::G_cache::get_key(this->H, G_method);
+		cache_filename = tools::G_cache::get_path(G_cache_path, cache_key);
+		cached         = tools::G_cache::read(cache_filename, cache_key, this->G, this->info_bits_pos);
+	}
+
+	if (!cached)
+	{
+		if (G_method == "IDENTITY")
+			this->G = tools::LDPC_matrix_handler::transform_H_to_G_identity(this->H, this->info_bits_pos);
+		else
+			this->G = tools::LDPC_matrix_handler::transform_H_to_G_decomp_LU(this->H, this->info_bits_pos);
+
+		if (G_cache_path != "")
+			tools::G_cache::write(cache_filename, cache_key, this->G, this->info_bits_pos);
+	}
+
 	if (G_save_path != "")
 	{
 		std::ofstream file(G_save_path);
@@ -12,12 +12,17 @@ namespace aff3ct
 namespace module
 {
 
+/*
+ * Encoder with a G matrix built from H, when 'G_cache_path' is a folder the G matrix is read from (or written in) its
+ * cache file (see tools::G_cache)
+ */
 template <typename B = int>
 class Encoder_LDPC_from_H : public Encoder_LDPC<B>
 {
 public:
 	Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const std::string& G_method = "FAST",
-	                    const std::string& G_save_path = "", const int n_frames = 1);
+	                    const std::string& G_save_path = "", const std::string& G_cache_path = "",
+	                    const int n_frames = 1);
 	virtual ~Encoder_LDPC_from_H() = default;
 };
 
@@ -3,6 +3,9 @@
 #include <numeric>
 #include <functional>
 #include <sstream>
+#include <map>
+#include <utility>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Math/matrix.h"
@@ -16,7 +19,10 @@ template <typename B>
 Encoder_LDPC_from_QC<B>
 ::Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix &_H, const int n_frames)
 : Encoder_LDPC<B>(K, N, n_frames),
-  invH2(tools::LDPC_matrix_handler::LU_decomposition(_H))
+  invH2(tools::LDPC_matrix_handler::LU_decomposition(_H)),
+  Z(0),
+  n_sum_rows(0),
+  first{0, -1, 0}
 {
 	const std::string name = "Encoder_LDPC_from_QC";
 	this->set_name(name);
@@ -26,10 +32,150 @@ Encoder_LDPC_from_QC<B>
 	this->check_H_dimensions();
 }
 
+template <typename B>
+Encoder_LDPC_from_QC<B>
+::Encoder_LDPC_from_QC(const int K, const int N, const std::vector<std::vector<int>> &base, const int Z,
+                       const int n_frames)
+: Encoder_LDPC<B>(K, N, n_frames),
+  Z(Z),
+  n_sum_rows(0),
+  first{0, -1, 0},
+  syndrome(Z > 0 ? Z : 0)
+{
+	const std::string name = "Encoder_LDPC_from_QC";
+	this->set_name(name);
+
+	if (Z <= 0 || base.empty() || base[0].size() <= base.size())
+	{
+		std::stringstream message;
+		message << "'Z' has to be greater than 0 and 'base' has to have more columns than rows ('Z' = " << Z
+		        << ", 'base.size()' = " << base.size() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto M_red = (int)base.size();
+	const auto N_red = (int)base[0].size();
+	const auto K_red = N_red - M_red;
+
+	if (N != N_red * Z || K != K_red * Z)
+	{
+		std::stringstream message;
+		message << "'N' and 'K' have to be the numbers of columns and of information columns of 'base' times 'Z' "
+		        << "('N' = " << N << ", 'K' = " << K << ", 'N_red' = " << N_red << ", 'K_red' = " << K_red
+		        << ", 'Z' = " << Z << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto &row : base)
+	{
+		if ((int)row.size() != N_red)
+		{
+			std::stringstream message;
+			message << "All the rows of 'base' have to be of the same size ('row.size()' = " << row.size()
+			        << ", 'N_red' = " << N_red << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		std::vector<Circulant> layer;
+		for (auto j = 0; j < N_red; j++)
+			if (row[j] != -1)
+			{
+				if (row[j] < 0 || row[j] >= Z)
+				{
+					std::stringstream message;
+					message << "The shifts have to be in [0, Z[ ('shift' = " << row[j] << ", 'Z' = " << Z << ").";
+					throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+				}
+				layer.push_back({j, row[j]});
+			}
+		this->layers.push_back(layer);
+	}
+
+	// the first parity block: the smallest number of first block rows such that, in their sum, the circulants of the
+	// parity blocks cancel each other two by two (same block column and same shift) but one
+	for (auto g = 1; g <= M_red && this->first.col == -1; g++)
+	{
+		std::map<std::pair<int,int>,bool> odd;
+		for (auto i = 0; i < g; i++)
+			for (auto &c : this->layers[i])
+				if (c.col >= K_red)
+					odd[std::make_pair(c.col, c.shift)] ^= true;
+
+		std::vector<std::pair<int,int>> left;
+		for (auto &o : odd)
+			if (o.second)
+				left.push_back(o.first);
+
+		if (left.size() == 1)
+		{
+			this->n_sum_rows = g;
+			this->first      = {0, left[0].first, left[0].second};
+		}
+	}
+
+	// then the other parity blocks: a block row with a single unknown block gives it
+	std::vector<bool> known(N_red, false), used(M_red, false);
+	std::fill(known.begin(), known.begin() + K_red, true);
+	if (this->first.col != -1)
+		known[this->first.col] = true;
+
+	for (auto progress = true; progress; )
+	{
+		progress = false;
+		for (auto i = 0; i < M_red; i++)
+		{
+			if (used[i])
+				continue;
+
+			auto n_unknown = 0;
+			Step step = {i, -1, 0};
+			for (auto &c : this->layers[i])
+				if (!known[c.col])
+				{
+					n_unknown++;
+					step.col   = c.col;
+					step.shift = c.shift;
+				}
+
+			if (n_unknown == 1)
+			{
+				this->schedule.push_back(step);
+				known[step.col] = true;
+				used [i       ] = true;
+				progress        = true;
+			}
+		}
+	}
+
+	// the block row which is not used is verified by the sum of the first block rows
+	auto n_unused = 0, unused = -1;
+	for (auto i = 0; i < M_red; i++)
+		if (!used[i])
+		{
+			n_unused++;
+			unused = i;
+		}
+
+	if (this->first.col == -1 || n_unused != 1 || unused >= this->n_sum_rows ||
+	    std::find(known.begin(), known.end(), false) != known.end())
+	{
+		std::stringstream message;
+		message << "The parity blocks of 'base' can't be solved one after the other on the circulants (the parity "
+		        << "part has to be made of a dual-diagonal core followed by lower triangular block rows).";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
 template <typename B>
 void Encoder_LDPC_from_QC<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
+	if (this->Z)
+	{
+		this->_encode_circulants(U_K, X_N);
+		return;
+	}
+
 	int M = this->N - this->K;
 
 	//Systematic part
@@ -52,6 +198,74 @@ void Encoder_LDPC_from_QC<B>
 	}
 }
 
+template <typename B>
+void Encoder_LDPC_from_QC<B>
+::add_circulant(const B *X_N, const Circulant &c, B *r) const
+{
+	const auto blk = X_N + c.col * this->Z;
+	for (auto k = 0; k < this->Z - c.shift; k++)
+		r[k] ^= blk[k + c.shift];
+	for (auto k = this->Z - c.shift; k < this->Z; k++)
+		r[k] ^= blk[k + c.shift - this->Z];
+}
+
+template <typename B>
+void Encoder_LDPC_from_QC<B>
+::_encode_circulants(const B *U_K, B *X_N)
+{
+	const auto Z   = this->Z;
+	const auto r   = this->syndrome.data();
+	const auto K_b = this->K / Z;
+
+	// systematic part
+	std::copy_n(U_K, this->K, X_N);
+
+	// first parity block: the other parity blocks cancel each other in the sum of the first block rows
+	std::fill(this->syndrome.begin(), this->syndrome.end(), (B)0);
+	for (auto i = 0; i < this->n_sum_rows; i++)
+		for (auto &c : this->layers[i])
+			if (c.col < K_b)
+				this->add_circulant(X_N, c, r);
+
+	// r[k] = p[(k + shift) % Z]
+	auto p = X_N + this->first.col * Z;
+	std::copy(r,                         r + Z - this->first.shift, p + this->first.shift);
+	std::copy(r + Z - this->first.shift, r + Z,                     p                    );
+
+	// other parity blocks
+	for (auto &s : this->schedule)
+	{
+		std::fill(this->syndrome.begin(), this->syndrome.end(), (B)0);
+		for (auto &c : this->layers[s.row])
+			if (c.col != s.col)
+				this->add_circulant(X_N, c, r);
+
+		p = X_N + s.col * Z;
+		std::copy(r,               r + Z - s.shift, p + s.shift);
+		std::copy(r + Z - s.shift, r + Z,           p          );
+	}
+}
+
+template <typename B>
+bool Encoder_LDPC_from_QC<B>
+::is_codeword(const B *X_N)
+{
+	if (!this->Z)
+		return Encoder_LDPC<B>::is_codeword(X_N);
+
+	for (auto &layer : this->layers)
+	{
+		std::fill(this->syndrome.begin(), this->syndrome.end(), (B)0);
+		for (auto &c : layer)
+			this->add_circulant(X_N, c, this->syndrome.data());
+
+		if (std::any_of(this->syndrome.begin(), this->syndrome.end(), [](const B b) { return b != (B)0; }))
+			return false;
+	}
+
+	return true;
+}
+
 template <typename B>
 void Encoder_LDPC_from_QC<B>
 ::_check_H_dimensions()
@@ -12,19 +12,61 @@ namespace aff3ct
 namespace module
 {
 
+/*
+ * Systematic encoder of the QC-LDPC codes: the information bits are the first K bits of the codeword.
+ *
+ * When it is built from H, the parity bits are the product of the inverse of the parity part of H (LU decomposition)
+ * with the syndrome of the information bits.
+ *
+ * When it is built from the base matrix and the lifting size Z (ex: a 5G NR base graph), H is never expanded: the
+ * parity blocks are solved one after the other on the Z x Z circulants. The first block is given by the sum of the
+ * first block rows (the other parity blocks of these rows cancel each other, ex: the dual-diagonal core of the 5G NR
+ * base graphs), then each parity block is given by a block row where it is the only unknown one.
+ */
 template <typename B = int>
 class Encoder_LDPC_from_QC : public Encoder_LDPC<B>
 {
+private:
+	struct Circulant
+	{
+		int col;   // the block column in the base matrix
+		int shift; // the check node 'k' of the block row is connected to the variable node 'col * Z + (k + shift) % Z'
+	};
+
+	struct Step
+	{
+		int row;   // the block row which gives the parity block
+		int col;   // the block column of the parity block
+		int shift; // the shift of the circulant of the parity block in the block row
+	};
+
 protected:
 	tools::LDPC_matrix_handler::LDPC_matrix invH2;
 
+	const int Z; // lifting size (0 when the encoder is built from H)
+	std::vector<std::vector<Circulant>> layers;   // the circulants of each row of the base matrix
+	int                                 n_sum_rows; // number of first block rows summed to get the first parity block
+	Step                                first;      // the first parity block (the 'row' field is not used)
+	std::vector<Step>                   schedule;   // the other parity blocks, in the order of their computation
+	std::vector<B>                      syndrome;   // Z bits
+
 public:
 	Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1);
+	Encoder_LDPC_from_QC(const int K, const int N, const std::vector<std::vector<int>> &base, const int Z,
+	                     const int n_frames = 1);
 	virtual ~Encoder_LDPC_from_QC() = default;
 
+	bool is_codeword(const B *X_N);
+
 protected:
 	void _encode(const B *U_K, B *X_N, const int frame_id);
 	void _check_H_dimensions();
+
+private:
+	void _encode_circulants(const B *U_K, B *X_N);
+
+	// r[k] ^= X_N[c.col * Z + (k + c.shift) % Z], for the Z check nodes of a block row
+	inline void add_circulant(const B *X_N, const Circulant &c, B *r) const;
 };
 
 }
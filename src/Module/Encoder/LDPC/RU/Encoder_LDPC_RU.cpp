@@ -0,0 +1,381 @@
+#include <sstream>
+#include <algorithm>
+#include <utility>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Encoder_LDPC_RU.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+namespace
+{
+struct Triangulation
+{
+	std::vector<uint32_t> tri_vn;     // the bits solved by the triangle (in order)
+	std::vector<uint32_t> tri_chk;    // the checks of the triangle (in order)
+	std::vector<uint32_t> gap_chk;    // the checks that are left (the gap)
+	std::vector<uint32_t> candidates; // the known bits, the first ones are the preferred bits of the gap
+};
+
+// greedy triangulation of H (in vertical way): a check with a single unknown bit solves this bit, when there is no
+// such check some bits are declared known:
+// - 'max_degree' = false: all the unknown bits but one of the check with the fewest unknown bits,
+// - 'max_degree' = true:  the unknown bit that is in the largest number of remaining checks (gives a gap of 0 on the
+//                         IRA matrices).
+// The candidates are found with bucket queues in which the outdated entries are skipped, the cost is linear in the
+// number of edges.
+Triangulation triangulate(const tools::Sparse_matrix &H, const bool max_degree)
+{
+	enum vn_state_t : int8_t { UNKNOWN = 0, KNOWN, PIVOT };
+
+	const auto N = H.get_n_rows();
+	const auto M = H.get_n_cols();
+
+	Triangulation tri;
+	std::vector<int8_t  > vn_state(N, UNKNOWN);
+	std::vector<uint32_t> vn_deg  (N, 0); // number of remaining checks of each bit
+	std::vector<int8_t  > chk_done(M, 0);
+	std::vector<uint32_t> chk_deg (M, 0); // number of unknown bits of each check
+	std::vector<uint32_t> stack;          // the checks with a single unknown bit
+
+	std::vector<std::vector<uint32_t>> vn_buckets (H.get_rows_max_degree() +1);
+	std::vector<std::vector<uint32_t>> chk_buckets(H.get_cols_max_degree() +1);
+	size_t vn_hi = vn_buckets.size() -1, chk_lo = 0, n_done = 0;
+
+	for (size_t v = 0; v < N; v++)
+	{
+		vn_deg[v] = (uint32_t)H.get_cols_from_row(v).size();
+		vn_buckets[vn_deg[v]].push_back((uint32_t)v);
+	}
+
+	auto done = [&](const size_t c)
+	{
+		chk_done[c] = 1;
+		n_done++;
+		for (auto v : H.get_rows_from_col(c))
+			if (vn_state[v] == UNKNOWN)
+				vn_buckets[--vn_deg[v]].push_back((uint32_t)v);
+	};
+
+	auto update_chk = [&](const size_t c)
+	{
+		if (chk_deg[c] == 0)
+		{
+			done(c);
+			tri.gap_chk.push_back((uint32_t)c);
+		}
+		else if (chk_deg[c] == 1)
+			stack.push_back((uint32_t)c);
+		else
+		{
+			chk_buckets[chk_deg[c]].push_back((uint32_t)c);
+			chk_lo = std::min(chk_lo, (size_t)chk_deg[c]);
+		}
+	};
+
+	// a bit becomes known or solved
+	auto remove_vn = [&](const uint32_t v, const vn_state_t state)
+	{
+		vn_state[v] = state;
+		for (auto c : H.get_cols_from_row(v))
+			if (!chk_done[c])
+			{
+				chk_deg[c]--;
+				update_chk(c);
+			}
+	};
+
+	for (size_t c = 0; c < M; c++)
+	{
+		chk_deg[c] = (uint32_t)H.get_rows_from_col(c).size();
+		update_chk(c);
+	}
+
+	while (n_done < M)
+	{
+		if (stack.empty() && max_degree)
+		{
+			uint32_t v = 0;
+			for (auto found = false; !found; )
+			{
+				while (vn_buckets[vn_hi].empty()) vn_hi--;
+				v = vn_buckets[vn_hi].back();
+				vn_buckets[vn_hi].pop_back();
+				found = vn_state[v] == UNKNOWN && vn_deg[v] == vn_hi;
+			}
+
+			tri.candidates.push_back(v);
+			remove_vn(v, KNOWN);
+		}
+		else if (stack.empty())
+		{
+			uint32_t c = 0;
+			for (auto found = false; !found; )
+			{
+				while (chk_buckets[chk_lo].empty()) chk_lo++;
+				c = chk_buckets[chk_lo].back();
+				chk_buckets[chk_lo].pop_back();
+				found = !chk_done[c] && chk_deg[c] == chk_lo;
+			}
+
+			auto kept = false;
+			for (auto v : H.get_rows_from_col(c))
+				if (vn_state[v] == UNKNOWN)
+				{
+					if (!kept) { kept = true; continue; }
+					tri.candidates.push_back((uint32_t)v);
+					remove_vn((uint32_t)v, KNOWN);
+				}
+		}
+		else
+		{
+			const auto c = stack.back();
+			stack.pop_back();
+			if (chk_done[c] || chk_deg[c] != 1)
+				continue;
+
+			const auto &vns = H.get_rows_from_col(c);
+			const auto v = (uint32_t)*std::find_if(vns.begin(), vns.end(),
+			                                       [&](const size_t v) { return vn_state[v] == UNKNOWN; });
+
+			tri.tri_vn .push_back(v);
+			tri.tri_chk.push_back(c);
+			done(c);
+			remove_vn(v, PIVOT);
+		}
+	}
+
+	// the bits that are not in the triangle are known (the last ones are the first information bits)
+	for (auto v = N; v > 0; v--)
+		if (vn_state[v -1] == UNKNOWN)
+			tri.candidates.push_back((uint32_t)(v -1));
+
+	return tri;
+}
+}
+
+template <typename B>
+Encoder_LDPC_RU<B>
+::Encoder_LDPC_RU(const int K, const int N, const tools::Sparse_matrix &_H, const int n_frames)
+: Encoder_LDPC<B>(K, N, n_frames), n_par_words(0)
+{
+	const std::string name = "Encoder_LDPC_RU";
+	this->set_name(name);
+
+	this->H = _H;
+
+	this->check_H_dimensions();
+
+	// keep the triangulation with the smallest gap
+	auto tri = triangulate(this->H, false);
+	if (!tri.gap_chk.empty())
+	{
+		auto tri_max = triangulate(this->H, true);
+		if (tri_max.gap_chk.size() < tri.gap_chk.size())
+			tri = std::move(tri_max);
+	}
+
+	this->tri_vn = std::move(tri.tri_vn);
+	this->tri_off.push_back(0);
+	for (size_t t = 0; t < this->tri_vn.size(); t++)
+	{
+		for (auto v : this->H.get_rows_from_col(tri.tri_chk[t]))
+			if (v != this->tri_vn[t])
+				this->tri_idx.push_back((uint32_t)v);
+		this->tri_off.push_back((uint32_t)this->tri_idx.size());
+	}
+
+	const auto &candidates = tri.candidates;
+	const auto g = tri.gap_chk.size();
+	const auto n_gap_words = (g + 63) / 64;
+
+	this->gap_off.push_back(0);
+	for (auto c : tri.gap_chk)
+	{
+		for (auto v : this->H.get_rows_from_col(c))
+			this->gap_idx.push_back((uint32_t)v);
+		this->gap_off.push_back((uint32_t)this->gap_idx.size());
+	}
+
+	// express the checks of the gap as functions of the known bits only (F = E.T^-1.[A B] + [C D]): the bits of the
+	// triangle are replaced by their own checks, from the last one to the first one
+	std::vector<uint64_t> F(this->N * n_gap_words, 0);
+	for (size_t i = 0; i < g; i++)
+		for (auto k = this->gap_off[i]; k < this->gap_off[i +1]; k++)
+			F[this->gap_idx[k] * n_gap_words + i / 64] ^= (uint64_t)1 << (i % 64);
+
+	for (auto t = this->tri_vn.size(); t > 0; t--)
+	{
+		const auto *f_v = F.data() + this->tri_vn[t -1] * n_gap_words;
+		if (std::all_of(f_v, f_v + n_gap_words, [](const uint64_t w) { return w == 0; }))
+			continue;
+
+		for (auto k = this->tri_off[t -1]; k < this->tri_off[t]; k++)
+		{
+			auto *f_u = F.data() + this->tri_idx[k] * n_gap_words;
+			for (size_t w = 0; w < n_gap_words; w++)
+				f_u[w] ^= f_v[w];
+		}
+	}
+
+	// select the bits of the gap: the first known bits whose columns in F are linearly independent
+	std::vector<uint64_t> basis;
+	std::vector<size_t  > lead;
+	std::vector<uint64_t> vec(n_gap_words);
+	for (auto u : candidates)
+	{
+		if (this->gap_vn.size() == g)
+			break;
+
+		std::copy(F.begin() + u * n_gap_words, F.begin() + (u +1) * n_gap_words, vec.begin());
+		for (size_t b = 0; b < lead.size(); b++)
+			if ((vec[lead[b] / 64] >> (lead[b] % 64)) & 1)
+				for (size_t w = 0; w < n_gap_words; w++)
+					vec[w] ^= basis[b * n_gap_words + w];
+
+		auto w = std::find_if(vec.begin(), vec.end(), [](const uint64_t w) { return w != 0; });
+		if (w == vec.end())
+			continue;
+
+		auto bit = (size_t)0;
+		while (!((*w >> bit) & 1)) bit++;
+
+		lead.push_back((size_t)std::distance(vec.begin(), w) * 64 + bit);
+		basis.insert(basis.end(), vec.begin(), vec.end());
+		this->gap_vn.push_back(u);
+	}
+
+	// invert phi = F restricted to the bits of the gap (Gauss-Jordan on [phi | I]), when H is rank deficient the
+	// redundant checks of the gap are left out
+	const auto r = this->gap_vn.size();
+	this->n_par_words = (r + 63) / 64;
+
+	std::vector<uint64_t> phi(g * this->n_par_words, 0), inv(g * n_gap_words, 0);
+	for (size_t i = 0; i < g; i++)
+	{
+		for (size_t j = 0; j < r; j++)
+			if ((F[this->gap_vn[j] * n_gap_words + i / 64] >> (i % 64)) & 1)
+				phi[i * this->n_par_words + j / 64] |= (uint64_t)1 << (j % 64);
+		inv[i * n_gap_words + i / 64] |= (uint64_t)1 << (i % 64);
+	}
+
+	auto has_bit = [](const uint64_t *row, const size_t j) { return (row[j / 64] >> (j % 64)) & 1; };
+	for (size_t j = 0; j < r; j++)
+	{
+		auto p = j;
+		while (!has_bit(phi.data() + p * this->n_par_words, j)) p++;
+
+		std::swap_ranges(phi.begin() + p * this->n_par_words, phi.begin() + (p +1) * this->n_par_words,
+		                 phi.begin() + j * this->n_par_words);
+		std::swap_ranges(inv.begin() + p * n_gap_words, inv.begin() + (p +1) * n_gap_words,
+		                 inv.begin() + j * n_gap_words);
+
+		for (size_t i = 0; i < g; i++)
+			if (i != j && has_bit(phi.data() + i * this->n_par_words, j))
+			{
+				for (size_t w = 0; w < this->n_par_words; w++)
+					phi[i * this->n_par_words + w] ^= phi[j * this->n_par_words + w];
+				for (size_t w = 0; w < n_gap_words; w++)
+					inv[i * n_gap_words + w] ^= inv[j * n_gap_words + w];
+			}
+	}
+
+	this->phi_inv.resize(g * this->n_par_words, 0);
+	for (size_t j = 0; j < r; j++)
+		for (size_t i = 0; i < g; i++)
+			if (has_bit(inv.data() + j * n_gap_words, i))
+				this->phi_inv[i * this->n_par_words + j / 64] |= (uint64_t)1 << (j % 64);
+
+	this->gap_bits.resize(this->n_par_words);
+
+	// the information bits are the remaining known bits, the extra ones (if H is rank deficient) are always 0
+	std::vector<bool> is_gap(this->N, false);
+	for (auto v : this->gap_vn)
+		is_gap[v] = true;
+
+	std::vector<uint32_t> info;
+	for (auto u : candidates)
+		if (!is_gap[u])
+			info.push_back(u);
+	std::sort(info.begin(), info.end());
+
+	if (info.size() < (size_t)this->K)
+	{
+		std::stringstream message;
+		message << "The rank of 'H' is too high for 'K' ('K' = " << this->K << ", 'N' = " << this->N
+		        << ", 'H' rank = " << (this->tri_vn.size() + r) << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::copy(info.begin(), info.begin() + this->K, this->info_bits_pos.begin());
+}
+
+template <typename B>
+size_t Encoder_LDPC_RU<B>
+::get_gap() const
+{
+	return this->gap_off.size() -1;
+}
+
+template <typename B>
+void Encoder_LDPC_RU<B>
+::back_substitute(B *X_N) const
+{
+	const auto n_tri = this->tri_vn.size();
+	for (size_t t = 0; t < n_tri; t++)
+	{
+		B bit = 0;
+		for (auto k = this->tri_off[t]; k < this->tri_off[t +1]; k++)
+			bit ^= X_N[this->tri_idx[k]];
+		X_N[this->tri_vn[t]] = bit;
+	}
+}
+
+template <typename B>
+void Encoder_LDPC_RU<B>
+::_encode(const B *U_K, B *X_N, const int frame_id)
+{
+	std::fill(X_N, X_N + this->N, (B)0);
+	for (auto i = 0; i < this->K; i++)
+		X_N[this->info_bits_pos[i]] = U_K[i];
+
+	// the bits of the gap are 0: the unsatisfied checks of the gap give the bits of the gap through phi^-1
+	this->back_substitute(X_N);
+
+	std::fill(this->gap_bits.begin(), this->gap_bits.end(), 0);
+	const auto g = this->get_gap();
+	for (size_t i = 0; i < g; i++)
+	{
+		B synd = 0;
+		for (auto k = this->gap_off[i]; k < this->gap_off[i +1]; k++)
+			synd ^= X_N[this->gap_idx[k]];
+
+		if (synd)
+			for (size_t w = 0; w < this->n_par_words; w++)
+				this->gap_bits[w] ^= this->phi_inv[i * this->n_par_words + w];
+	}
+
+	auto is_zero = true;
+	for (size_t j = 0; j < this->gap_vn.size(); j++)
+	{
+		X_N[this->gap_vn[j]] = (B)((this->gap_bits[j / 64] >> (j % 64)) & 1);
+		is_zero &= X_N[this->gap_vn[j]] == 0;
+	}
+
+	if (!is_zero)
+		this->back_substitute(X_N);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Encoder_LDPC_RU<B_8>;
+template class aff3ct::module::Encoder_LDPC_RU<B_16>;
+template class aff3ct::module::Encoder_LDPC_RU<B_32>;
+template class aff3ct::module::Encoder_LDPC_RU<B_64>;
+#else
+template class aff3ct::module::Encoder_LDPC_RU<B>;
+#endif
+// ==================================================================================== explicit template instantiation
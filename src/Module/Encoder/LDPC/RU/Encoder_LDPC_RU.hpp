@@ -0,0 +1,58 @@
+#ifndef ENCODER_LDPC_RU_HPP_
+#define ENCODER_LDPC_RU_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "../Encoder_LDPC.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+
+/*
+ * Richardson-Urbanke encoder: H is put once in approximate lower triangular form by a greedy triangulation
+ * [A B T; C D E] (T is lower triangular with ones on the diagonal), then a frame is encoded without G:
+ * the parity bits of T are solved by sparse back-substitution and the 'g' parity bits of the gap (B) are solved
+ * with the small dense inverse of phi = E.T^-1.B + D. The encoding cost is close to the number of edges in H.
+ */
+template <typename B = int>
+class Encoder_LDPC_RU : public Encoder_LDPC<B>
+{
+protected:
+	// the triangle, in the order of the back-substitution: the check 't' gives the bit 'tri_vn[t]' from the other
+	// bits of the check 'tri_idx[tri_off[t]:tri_off[t+1]]'
+	std::vector<uint32_t> tri_vn;
+	std::vector<uint32_t> tri_off;
+	std::vector<uint32_t> tri_idx;
+
+	// the 'g' checks of the gap (C D E) and the 'r' bits of the gap (B), 'r' < 'g' when H is rank deficient
+	std::vector<uint32_t> gap_off;
+	std::vector<uint32_t> gap_idx;
+	std::vector<uint32_t> gap_vn;
+
+	// inverse of phi: the column 'i' (r bits, packed) is added to the gap bits when the check 'i' of the gap is not
+	// satisfied
+	std::vector<uint64_t> phi_inv;
+	size_t                n_par_words;
+
+	std::vector<uint64_t> gap_bits;
+
+public:
+	Encoder_LDPC_RU(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1);
+	virtual ~Encoder_LDPC_RU() = default;
+
+	size_t get_gap() const;
+
+protected:
+	void _encode(const B *U_K, B *X_N, const int frame_id);
+
+private:
+	void back_substitute(B *X_N) const;
+};
+
+}
+}
+
+#endif /* ENCODER_LDPC_RU_HPP_ */
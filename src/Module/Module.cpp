@@ -9,7 +9,7 @@ using namespace aff3ct::module;
 
 Module::
 Module(const int n_frames)
-: n_frames(n_frames), name("Module"), short_name("Module")
+: n_frames(n_frames), name("Module"), short_name("Module"), cancel_token(nullptr)
 #ifdef AFF3CT_SYSTEMC_MODULE
 , sc(*this)
 #endif
@@ -58,6 +58,12 @@ operator[](const int id)
 	return *tasks_with_nullptr[id];
 }
 
+void Module::
+set_cancellation_token(Cancellation_token *token)
+{
+	this->cancel_token = token;
+}
+
 Task& Module::
 create_task(const std::string &name, const int id)
 {
@@ -9,6 +9,7 @@
 #define MODULE_HPP_
 
 #include <string>
+#include <atomic>
 
 #include <typeinfo>
 #include <typeindex>
@@ -33,6 +34,25 @@ namespace aff3ct
 {
 namespace module
 {
+/*!
+ * \struct Cancellation_token
+ *
+ * \brief Shared by the modules of a processing chain to abandon the frames that will be thrown away.
+ */
+struct Cancellation_token
+{
+	std::atomic<bool> requested; /*!< When true, the frames being processed will be thrown away. */
+	std::atomic<bool> abandoned; /*!< Set by a Module that abandoned a frame after a request (until the next reset). */
+
+	Cancellation_token() : requested(false), abandoned(false) {}
+
+	inline void reset(const bool requested = false)
+	{
+		this->abandoned = false;
+		this->requested = requested;
+	}
+};
+
 /*!
  * \class Module
  *
@@ -45,6 +65,7 @@ protected:
 	std::string name;        /*!< Name of the Module. */
 	std::string short_name;  /*!< Short name of the Module. */
 	std::vector<std::shared_ptr<Task>> tasks_with_nullptr;
+	Cancellation_token *cancel_token; /*!< Polled to abandon the frames that will be thrown away. */
 
 public:
 	std::vector<std::shared_ptr<Task>> tasks;
@@ -83,7 +104,33 @@ public:
 
 	Task& operator[](const int id);
 
+	/*!
+	 * \brief Set the cancellation token of the Module.
+	 *
+	 * The long-running tasks (the iterative decoders for instance) poll the token and abandon the frames being
+	 * processed when a cancellation is requested.
+	 *
+	 * \param token: pointer to the token (nullptr to disable the cancellation).
+	 */
+	void set_cancellation_token(Cancellation_token *token);
+
 protected:
+	// to call only when the task abandons its frames if it returns true: the frames are then marked as abandoned
+	inline bool is_cancelled() const
+	{
+		if (this->cancel_token == nullptr || !this->cancel_token->requested.load(std::memory_order_relaxed))
+			return false;
+
+		this->cancel_token->abandoned.store(true, std::memory_order_relaxed);
+		return true;
+	}
+
+	// true if a frame has been abandoned since the last reset of the token
+	inline bool is_abandoned() const
+	{
+		return this->cancel_token != nullptr && this->cancel_token->abandoned.load(std::memory_order_relaxed);
+	}
+
 	Task& create_task(const std::string &name, const int id = -1);
 
 	template <typename T>
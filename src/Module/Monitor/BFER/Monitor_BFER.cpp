@@ -108,6 +108,11 @@ template <typename B>
 int Monitor_BFER<B>
 ::check_errors(const B *U, const B *V, const int frame_id)
 {
+	// the frames abandoned by the decoder are thrown away, the frames completed before or after the cancellation
+	// request are counted (dropping them would bias the statistics toward the fast, often correct, decodings)
+	if (this->is_abandoned())
+		return 0;
+
 	const auto f_start = (frame_id < 0) ? 0 : frame_id % get_n_frames();
 	const auto f_stop  = (frame_id < 0) ? get_n_frames() : f_start +1;
 
@@ -117,6 +122,9 @@ int Monitor_BFER<B>
 		                            V + f * get_K(),
 		                            f);
 
+	// publish the counters once per call (the other threads only read the snapshot)
+	this->snapshot.store(this->vals);
+
 	for (auto& c : this->callbacks_check)
 		c();
 
@@ -176,13 +184,21 @@ bool Monitor_BFER<B>
 	return fe_limit_achieved() || frame_limit_achieved();
 }
 
+template <typename B>
+bool Monitor_BFER<B>
+::is_done(const Attributes& v) const
+{
+	return (get_max_fe      () != 0 && v.n_fe  >= get_max_fe      ()) ||
+	       (get_max_n_frames() != 0 && v.n_fra >= get_max_n_frames());
+}
+
 
 
 template <typename B>
-const typename Monitor_BFER<B>::Attributes& Monitor_BFER<B>
+typename Monitor_BFER<B>::Attributes Monitor_BFER<B>
 ::get_attributes() const
 {
-	return vals;
+	return snapshot.load();
 }
 
 template <typename B>
@@ -210,32 +226,34 @@ template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_analyzed_fra() const
 {
-	return vals.n_fra;
+	return get_attributes().n_fra;
 }
 
 template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_fe() const
 {
-	return vals.n_fe;
+	return get_attributes().n_fe;
 }
 
 template <typename B>
 unsigned long long Monitor_BFER<B>
 ::get_n_be() const
 {
-	return vals.n_be;
+	return get_attributes().n_be;
 }
 
 template <typename B>
 float Monitor_BFER<B>
 ::get_fer() const
 {
+	const auto v = this->get_attributes();
+
 	auto t_fer = 0.f;
-	if (this->get_n_fe() != 0)
-		t_fer = (float)this->get_n_fe() / (float)this->get_n_analyzed_fra();
+	if (v.n_fe != 0)
+		t_fer = (float)v.n_fe / (float)v.n_fra;
 	else
-		t_fer = (1.f) / ((float)this->get_n_analyzed_fra());
+		t_fer = (1.f) / ((float)v.n_fra);
 
 	return t_fer;
 }
@@ -244,11 +262,13 @@ template <typename B>
 float Monitor_BFER<B>
 ::get_ber() const
 {
+	const auto v = this->get_attributes();
+
 	auto t_ber = 0.f;
-	if (this->get_n_be() != 0)
-		t_ber = (float)this->get_n_be() / (float)this->get_n_analyzed_fra() / (float)this->get_K();
+	if (v.n_be != 0)
+		t_ber = (float)v.n_be / (float)v.n_fra / (float)this->get_K();
 	else
-		t_ber = (1.f) / ((float)this->get_n_analyzed_fra()) / this->get_K();
+		t_ber = (1.f) / ((float)v.n_fra) / this->get_K();
 
 	return t_ber;
 }
@@ -304,6 +324,7 @@ void Monitor_BFER<B>
 {
 	Monitor::reset();
 	vals.reset();
+	snapshot.store(vals);
 
 	this->err_hist.reset();
 }
@@ -343,6 +364,7 @@ void Monitor_BFER<B>
 ::collect(const Attributes& v)
 {
 	vals += v;
+	snapshot.store(vals);
 }
 
 template <typename B>
@@ -379,6 +401,7 @@ void Monitor_BFER<B>
 ::copy(const Attributes& v)
 {
 	vals = v;
+	snapshot.store(vals);
 }
 
 template <typename B>
@@ -3,6 +3,7 @@
 
 #include "../Monitor.hpp"
 #include "Tools/Algo/Histogram.hpp"
+#include "Tools/Threads/Seqlock.hpp"
 
 namespace aff3ct
 {
@@ -34,7 +35,8 @@ private:
 	const unsigned max_n_frames;         // max number of frames to check then frame_limit_achieved() returns true else if 0
 	const bool     count_unknown_values; // take into account or not the unknown values as wrong values in the checked frames
 
-	Attributes vals;
+	Attributes vals;                      // only modified by the thread that owns the monitor
+	tools::Seqlock<Attributes> snapshot;  // the last published "vals", read by the other threads without lock
 	tools::Histogram<int> err_hist; // the error histogram record
 	bool err_hist_activated;
 
@@ -98,7 +100,15 @@ public:
 	bool frame_limit_achieved() const;
 	virtual bool is_done() const;
 
-	const Attributes&     get_attributes          () const;
+	/*!
+	 * \brief Checks the stop criteria on a given set of counters (ex: the sum of the snapshots of several monitors).
+	 */
+	bool is_done(const Attributes& v) const;
+
+	/*!
+	 * \brief Gets a consistent snapshot of the counters, this method can be called from any thread.
+	 */
+	Attributes            get_attributes          () const;
 	int                   get_K                   () const;
 	bool                  get_count_unknown_values() const;
 	unsigned              get_max_fe              () const;
@@ -95,6 +95,9 @@ R Monitor_MI<B,R>
 	for (auto f = f_start; f < f_stop; f++)
 		loc_MI_sum += this->_get_mutual_info(X + f * get_N(), Y + f * get_N(), f);
 
+	// publish the attributes once per call (the other threads only read the snapshot)
+	this->snapshot.store(this->vals);
+
 	for (auto& c : this->callbacks_check)
 		c();
 
@@ -172,14 +175,21 @@ bool Monitor_MI<B,R>
 	return n_trials_limit_achieved();
 }
 
+template <typename B, typename R>
+bool Monitor_MI<B,R>
+::is_done(const Attributes& v) const
+{
+	return get_max_n_trials() != 0 && v.n_trials >= get_max_n_trials();
+}
+
 
 
 
 template <typename B, typename R>
-const typename Monitor_MI<B,R>::Attributes& Monitor_MI<B,R>
+typename Monitor_MI<B,R>::Attributes Monitor_MI<B,R>
 ::get_attributes() const
 {
-	return vals;
+	return snapshot.load();
 }
 
 template <typename B, typename R>
@@ -200,28 +210,28 @@ template <typename B, typename R>
 unsigned long long Monitor_MI<B,R>
 ::get_n_trials() const
 {
-	return vals.n_trials;
+	return get_attributes().n_trials;
 }
 
 template <typename B, typename R>
 R Monitor_MI<B,R>
 ::get_MI() const
 {
-	return vals.MI;
+	return get_attributes().MI;
 }
 
 template <typename B, typename R>
 R Monitor_MI<B,R>
 ::get_MI_min() const
 {
-	return vals.MI_min;
+	return get_attributes().MI_min;
 }
 
 template <typename B, typename R>
 R Monitor_MI<B,R>
 ::get_MI_max() const
 {
-	return vals.MI_max;
+	return get_attributes().MI_max;
 }
 
 template<typename B, typename R>
@@ -259,6 +269,7 @@ void Monitor_MI<B,R>
 {
 	Monitor::reset();
 	vals.reset();
+	snapshot.store(vals);
 
 	this->mutinfo_hist.reset();
 }
@@ -297,6 +308,7 @@ void Monitor_MI<B,R>
 ::collect(const Attributes& v)
 {
 	vals += v;
+	snapshot.store(vals);
 }
 
 template <typename B, typename R>
@@ -333,6 +345,7 @@ void Monitor_MI<B,R>
 ::copy(const Attributes& v)
 {
 	vals = v;
+	snapshot.store(vals);
 }
 
 
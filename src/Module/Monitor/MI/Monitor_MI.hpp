@@ -3,6 +3,7 @@
 
 #include "../Monitor.hpp"
 #include "Tools/Algo/Histogram.hpp"
+#include "Tools/Threads/Seqlock.hpp"
 
 namespace aff3ct
 {
@@ -33,7 +34,8 @@ private:
 	const int      N;            // Number of frame bits
 	const unsigned max_n_trials; // max number of trials to check then n_trials_limit_achieved() returns true
 
-	Attributes vals;
+	Attributes vals;                      // only modified by the thread that owns the monitor
+	tools::Seqlock<Attributes> snapshot;  // the last published "vals", read by the other threads without lock
 	tools::Histogram<R> mutinfo_hist; // the MI histogram record
 	bool mutinfo_hist_activated;
 
@@ -92,8 +94,13 @@ public:
 	bool n_trials_limit_achieved() const;
 	virtual bool is_done() const;
 
+	/*!
+	 * \brief Checks the stop criterion on a given set of attributes (ex: the sum of the snapshots of several monitors).
+	 */
+	bool is_done(const Attributes& v) const;
+
 
-	const Attributes&   get_attributes  () const;
+	Attributes          get_attributes  () const; // consistent snapshot, can be called from any thread
 	int                 get_N           () const;
 	unsigned            get_max_n_trials() const;
 	unsigned long long  get_n_trials    () const;
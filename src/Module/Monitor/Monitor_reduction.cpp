@@ -1,5 +1,6 @@
 #include <cmath>
 #include <sstream>
+#include <algorithm>
 
 #ifdef AFF3CT_MPI
 #include <mpi.h>
@@ -14,6 +15,7 @@ using namespace aff3ct::module;
 
 bool                                                                         aff3ct::module::Monitor_reduction::stop_loop = false;
 std::vector<aff3ct::module::Monitor_reduction*>                              aff3ct::module::Monitor_reduction::monitors;
+std::mutex                                                                   aff3ct::module::Monitor_reduction::mtx_monitors;
 std::thread::id                                                              aff3ct::module::Monitor_reduction::master_thread_id = std::this_thread::get_id();
 std::chrono::nanoseconds                                                     aff3ct::module::Monitor_reduction::d_reduce_frequency = std::chrono::milliseconds(1000);
 std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds> aff3ct::module::Monitor_reduction::t_last_reduction;
@@ -24,9 +26,19 @@ Monitor_reduction
 	Monitor_reduction::add_monitor(this);
 }
 
+Monitor_reduction
+::~Monitor_reduction()
+{
+	std::lock_guard<std::mutex> lock(Monitor_reduction::mtx_monitors);
+	auto it = std::find(Monitor_reduction::monitors.begin(), Monitor_reduction::monitors.end(), this);
+	if (it != Monitor_reduction::monitors.end())
+		Monitor_reduction::monitors.erase(it);
+}
+
 void Monitor_reduction
 ::add_monitor(Monitor_reduction* m)
 {
+	std::lock_guard<std::mutex> lock(Monitor_reduction::mtx_monitors);
 	Monitor_reduction::monitors.push_back(m);
 }
 
@@ -36,6 +48,7 @@ void Monitor_reduction
 	Monitor_reduction::t_last_reduction = std::chrono::steady_clock::now();
 	Monitor_reduction::stop_loop        = false;
 
+	std::lock_guard<std::mutex> lock(Monitor_reduction::mtx_monitors);
 	for(auto& m : Monitor_reduction::monitors)
 		m->reset_mr();
 }
@@ -50,8 +63,11 @@ bool Monitor_reduction
 
 	bool is_done = false;
 
-	for(auto& m : Monitor_reduction::monitors)
-		is_done |= m->is_done_mr();
+	{
+		std::lock_guard<std::mutex> lock(Monitor_reduction::mtx_monitors);
+		for(auto& m : Monitor_reduction::monitors)
+			is_done |= m->is_done_mr();
+	}
 
 	if (is_done)
 		set_stop_loop();
@@ -127,8 +143,11 @@ bool Monitor_reduction
 	              (std::chrono::steady_clock::now() - Monitor_reduction::t_last_reduction) >=
 	               Monitor_reduction::d_reduce_frequency))
 	{
-		for (auto& m : Monitor_reduction::monitors)
-			m->_reduce(fully);
+		{
+			std::lock_guard<std::mutex> lock(Monitor_reduction::mtx_monitors);
+			for (auto& m : Monitor_reduction::monitors)
+				m->_reduce(fully);
+		}
 
 		all_process_on_last = reduce_stop_loop();
 
@@ -1,6 +1,7 @@
 #ifndef MONITOR_REDUCTION_HPP_
 #define MONITOR_REDUCTION_HPP_
 
+#include <mutex>
 #include <thread>
 #include <string>
 #include <vector>
@@ -18,6 +19,7 @@ class Monitor_reduction
 private:
 	static bool                            stop_loop;
 	static std::vector<Monitor_reduction*> monitors;
+	static std::mutex                      mtx_monitors; // protects 'monitors' (modules are built and freed by the threads)
 	static std::thread::id                 master_thread_id;
 	static std::chrono::nanoseconds        d_reduce_frequency;
 
@@ -71,7 +73,10 @@ public:
 protected:
 	Monitor_reduction();
 
-	virtual ~Monitor_reduction() = default;
+	/*
+	 * \brief remove the monitor from the 'monitors' list
+	 */
+	virtual ~Monitor_reduction();
 
 	/*
 	 * \brief do the reduction of this monitor
@@ -141,7 +146,7 @@ protected:
 	virtual void reset_mr();
 
 	/*
-	 * \brief call is_done()
+	 * \brief call is_done() on the reduced attributes and on the sum of the snapshots of the monitors
 	 */
 	virtual bool is_done_mr();
 };
@@ -82,7 +82,13 @@ template <class M>
 bool Monitor_reduction_M<M>
 ::is_done_mr()
 {
-	return M::is_done();
+	// the snapshots of the monitors are summed without waiting for the next reduction: the stop criterion is exact
+	// and can be evaluated by any thread
+	typename M::Attributes sum;
+	for (auto& m : this->monitors)
+		sum += m->get_attributes();
+
+	return M::is_done(sum) || M::is_done();
 }
 
 template <class M>
@@ -2,8 +2,10 @@
 #define SOCKET_HPP_
 
 #include <string>
+#include <vector>
 #include <sstream>
 #include <typeindex>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -37,15 +39,27 @@ protected:
 	const std::type_index datatype;
 	const size_t          databytes;
 	      bool            fast;
+	      bool            persistent; // the data are not rewritten at each execution of the task
 	      void*           dataptr;
 
+	Socket*              bound_socket;  // the socket this socket is bound to (nullptr if bound to raw data)
+	std::vector<Socket*> bound_sockets; // the sockets bound to this socket
+
 public:
 	Socket(Task &task, const std::string &name, const std::type_index datatype, const size_t databytes,
 	       const bool fast = false, void *dataptr = nullptr)
-	: task(task), name(name), datatype(datatype), databytes(databytes), fast(fast), dataptr(dataptr)
+	: task(task), name(name), datatype(datatype), databytes(databytes), fast(fast), persistent(false),
+	  dataptr(dataptr), bound_socket(nullptr)
 	{
 	}
 
+	~Socket()
+	{
+		unbind_socket();
+		for (auto s : bound_sockets)
+			s->bound_socket = nullptr;
+	}
+
 	inline std::string     get_name           () const { return name;                                          }
 	inline std::type_index get_datatype       () const { return datatype;                                      }
 	inline std::string     get_datatype_string() const { return type_to_string[datatype];                      }
@@ -54,8 +68,14 @@ public:
 	inline size_t          get_n_elmts        () const { return get_databytes() / (size_t)get_datatype_size(); }
 	inline void*           get_dataptr        () const { return dataptr;                                       }
 	inline bool            is_fast            () const { return fast;                                          }
+	inline bool            is_persistent      () const { return persistent;                                    }
+	inline Task&           get_task           () const { return task;                                          }
+
+	inline       Socket*               get_bound_socket () const { return bound_socket;  }
+	inline const std::vector<Socket*>& get_bound_sockets() const { return bound_sockets; }
 
-	inline void set_fast(const bool fast) { this->fast = fast; }
+	inline void set_fast      (const bool fast      ) { this->fast       = fast;       }
+	inline void set_persistent(const bool persistent) { this->persistent = persistent; }
 
 	inline int bind(Socket &s)
 	{
@@ -101,6 +121,13 @@ public:
 
 		this->dataptr = s.dataptr;
 
+		if (this->bound_socket != &s)
+		{
+			unbind_socket();
+			this->bound_socket = &s;
+			s.bound_sockets.push_back(this);
+		}
+
 		if (this->task.is_autoexec() && this->task.is_last_input_socket(*this))
 			return this->task.exec();
 		else
@@ -117,6 +144,7 @@ public:
 	{
 		if (is_fast())
 		{
+			unbind_socket();
 			this->dataptr = static_cast<void*>(vector.data());
 			return 0;
 		}
@@ -147,6 +175,7 @@ public:
 	{
 		if (is_fast())
 		{
+			unbind_socket();
 			this->dataptr = static_cast<void*>(array);
 			return 0;
 		}
@@ -184,6 +213,7 @@ public:
 			}
 		}
 
+		unbind_socket();
 		this->dataptr = dataptr;
 
 		return 0;
@@ -193,6 +223,25 @@ public:
 	{
 		return bind(dataptr);
 	}
+
+private:
+	// move the data pointer of this socket and of the sockets bound to it (recursively)
+	inline void relocate(void *dataptr)
+	{
+		this->dataptr = dataptr;
+		for (auto s : bound_sockets)
+			s->relocate(dataptr);
+	}
+
+	inline void unbind_socket()
+	{
+		if (this->bound_socket != nullptr)
+		{
+			auto &v = this->bound_socket->bound_sockets;
+			v.erase(std::remove(v.begin(), v.end(), this), v.end());
+			this->bound_socket = nullptr;
+		}
+	}
 };
 }
 }
@@ -4,6 +4,8 @@
 
 #include <rang.hpp>
 
+#include "Tools/Perf/Tracer/Tracer.hpp"
+
 #include "Module.hpp"
 #include "Socket.hpp"
 #include "Task.hpp"
@@ -18,6 +20,8 @@ Task::Task(const Module &module, const std::string &name, const bool autoalloc,
   autoalloc(autoalloc),
   autoexec(autoexec),
   stats(stats),
+  hw_counters(false),
+  trace(false),
   fast(fast),
   debug(debug),
   debug_hex(false),
@@ -29,6 +33,8 @@ Task::Task(const Module &module, const std::string &name, const bool autoalloc,
   duration_total(std::chrono::nanoseconds(0)),
   duration_min(std::chrono::nanoseconds(0)),
   duration_max(std::chrono::nanoseconds(0)),
+  hw_counters_total(),
+  hw_n_calls(0),
   last_input_socket(nullptr)
 {
 }
@@ -58,6 +64,41 @@ void Task::set_autoalloc(const bool autoalloc)
 	}
 }
 
+void Task::relocate_out_buffer(Socket &s_out, void *dataptr)
+{
+	if (get_socket_type(s_out) != socket_t::SOUT)
+	{
+		std::stringstream message;
+		message << "'s_out' has to be an output socket ('s_out.name' = " << s_out.get_name()
+		        << ", 'task.name' = " << this->get_name() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (dataptr == nullptr)
+	{
+		std::stringstream message;
+		message << "'dataptr' can't be NULL.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto buffer = std::find_if(this->out_buffers.begin(), this->out_buffers.end(),
+	                           [&s_out](const mipp::vector<uint8_t> &b) { return (void*)b.data() == s_out.dataptr; });
+
+	if (buffer == this->out_buffers.end())
+	{
+		std::stringstream message;
+		message << "The data of 's_out' are not allocated by the task ('s_out.name' = " << s_out.get_name()
+		        << ", 'task.name' = " << this->get_name() << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the current content is kept (the persistent sockets are initialized only once)
+	std::copy(buffer->begin(), buffer->end(), (uint8_t*)dataptr);
+	this->out_buffers.erase(buffer);
+
+	s_out.relocate(dataptr);
+}
+
 void Task::set_autoexec(const bool autoexec)
 {
 	this->autoexec = autoexec;
@@ -71,6 +112,22 @@ void Task::set_stats(const bool stats)
 		this->set_fast(false);
 }
 
+void Task::set_hw_counters(const bool hw)
+{
+	this->hw_counters = hw;
+
+	if (this->hw_counters)
+		this->set_stats(true);
+}
+
+void Task::set_trace(const bool trace)
+{
+	this->trace = trace;
+
+	if (this->trace)
+		this->set_fast(false);
+}
+
 void Task::set_fast(const bool fast)
 {
 	this->fast = fast;
@@ -78,6 +135,8 @@ void Task::set_fast(const bool fast)
 	{
 		this->set_debug(false);
 		this->set_stats(false);
+		this->set_hw_counters(false);
+		this->set_trace(false);
 	}
 
 	for (size_t i = 0; i < sockets.size(); i++)
@@ -263,23 +322,40 @@ int Task::exec()
 		}
 
 		int exec_status;
-		if (stats)
+		if (stats || trace)
 		{
+			// the hardware counters are read outside of the time measurement
+			tools::Perf_counters::Sample hw_start;
+			const auto hw = stats && hw_counters && tools::Perf_counters::read(hw_start);
+
 			auto t_start = std::chrono::steady_clock::now();
 			exec_status = this->codelet();
-			auto duration = std::chrono::steady_clock::now() - t_start;
+			auto t_stop = std::chrono::steady_clock::now();
+			auto duration = t_stop - t_start;
 
-			this->duration_total += duration;
-			if (n_calls)
-			{
-				this->duration_min = std::min(this->duration_min, duration);
-				this->duration_max = std::max(this->duration_max, duration);
-			}
-			else
+			// only the calls really measured by the counters are counted in 'hw_n_calls'
+			tools::Perf_counters::Sample hw_stop;
+			if (hw && tools::Perf_counters::read(hw_stop) &&
+			    tools::Perf_counters::accumulate(hw_start, hw_stop, this->hw_counters_total))
+				this->hw_n_calls++;
+
+			if (stats)
 			{
-				this->duration_min = duration;
-				this->duration_max = duration;
+				this->duration_total += duration;
+				if (n_calls)
+				{
+					this->duration_min = std::min(this->duration_min, duration);
+					this->duration_max = std::max(this->duration_max, duration);
+				}
+				else
+				{
+					this->duration_min = duration;
+					this->duration_max = duration;
+				}
 			}
+
+			if (trace)
+				tools::Tracer::record(*this, this->n_calls, t_start, t_stop);
 		}
 		else
 			exec_status = this->codelet();
@@ -426,6 +502,16 @@ std::chrono::nanoseconds Task::get_duration_max() const
 	return this->duration_max;
 }
 
+const tools::Perf_counters::Values& Task::get_hw_counters() const
+{
+	return this->hw_counters_total;
+}
+
+uint32_t Task::get_hw_n_calls() const
+{
+	return this->hw_n_calls;
+}
+
 const std::vector<std::string>& Task::get_timers_name() const
 {
 	return this->timers_name;
@@ -478,6 +564,8 @@ void Task::reset_stats()
 	this->duration_total = std::chrono::nanoseconds(0);
 	this->duration_min   = std::chrono::nanoseconds(0);
 	this->duration_max   = std::chrono::nanoseconds(0);
+	this->hw_counters_total.fill(0);
+	this->hw_n_calls     =                          0;
 
 	for (auto &x : this->timers_n_calls) x =                          0;
 	for (auto &x : this->timers_total  ) x = std::chrono::nanoseconds(0);
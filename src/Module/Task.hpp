@@ -17,6 +17,7 @@
 #include <mipp.h>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Counters/Perf_counters.hpp"
 
 namespace aff3ct
 {
@@ -38,6 +39,8 @@ protected:
 	bool autoalloc;
 	bool autoexec;
 	bool stats;
+	bool hw_counters;
+	bool trace;
 	bool fast;
 	bool debug;
 	bool debug_hex;
@@ -52,6 +55,8 @@ protected:
 	std::chrono::nanoseconds duration_total;
 	std::chrono::nanoseconds duration_min;
 	std::chrono::nanoseconds duration_max;
+	tools::Perf_counters::Values hw_counters_total;
+	uint32_t                     hw_n_calls; // number of calls measured by the hardware counters
 
 	std::vector<std::string             > timers_name;
 	std::vector<uint32_t                > timers_n_calls;
@@ -80,6 +85,8 @@ public:
 	void set_autoalloc      (const bool     autoalloc);
 	void set_autoexec       (const bool     autoexec );
 	void set_stats          (const bool     stats    );
+	void set_hw_counters    (const bool     hw       );
+	void set_trace          (const bool     trace    );
 	void set_fast           (const bool     fast     );
 	void set_debug          (const bool     debug    );
 	void set_debug_hex      (const bool     debug_hex);
@@ -90,6 +97,8 @@ public:
 	inline bool is_autoalloc        (                  ) const { return this->autoalloc;            }
 	inline bool is_autoexec         (                  ) const { return this->autoexec;             }
 	inline bool is_stats            (                  ) const { return this->stats;                }
+	inline bool is_hw_counters      (                  ) const { return this->hw_counters;          }
+	inline bool is_trace            (                  ) const { return this->trace;                }
 	inline bool is_fast             (                  ) const { return this->fast;                 }
 	inline bool is_debug            (                  ) const { return this->debug;                }
 	inline bool is_debug_hex        (                  ) const { return this->debug_hex;            }
@@ -106,6 +115,8 @@ public:
 	std::chrono::nanoseconds                     get_duration_avg  () const;
 	std::chrono::nanoseconds                     get_duration_min  () const;
 	std::chrono::nanoseconds                     get_duration_max  () const;
+	const tools::Perf_counters::Values&          get_hw_counters   () const;
+	uint32_t                                     get_hw_n_calls    () const;
 	const std::vector<std::string>             & get_timers_name   () const;
 	const std::vector<uint32_t>                & get_timers_n_calls() const;
 	const std::vector<std::chrono::nanoseconds>& get_timers_total  () const;
@@ -114,6 +125,9 @@ public:
 
 	int exec();
 
+	// move the data of an output socket in an external memory space (the sockets bound to it follow the data)
+	void relocate_out_buffer(Socket &s_out, void *dataptr);
+
 	inline Socket& operator[](const int id)
 	{
 		return *this->sockets[id];
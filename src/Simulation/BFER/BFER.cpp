@@ -9,6 +9,7 @@
 #include "Tools/system_functions.h"
 #include "Tools/Display/rang_format/rang_format.h"
 #include "Tools/Display/Statistics/Statistics.hpp"
+#include "Tools/Perf/Tracer/Tracer.hpp"
 #include "Tools/Exception/exception.hpp"
 
 #include "Factory/Module/Monitor/Monitor.hpp"
@@ -26,12 +27,19 @@ BFER<B,R,Q>
   params_BFER(params_BFER),
 
   barrier(params_BFER.n_threads),
+  pin_warning(false),
+  arenas (params_BFER.n_threads),
+  cancel_tokens(params_BFER.n_threads),
 
   bit_rate((float)params_BFER.src->K / (float)params_BFER.cdc->N),
 
   monitor_mi(params_BFER.n_threads),
   monitor_er(params_BFER.n_threads),
-  dumper    (params_BFER.n_threads)
+  dumper    (params_BFER.n_threads),
+
+  calibration_time(0),
+
+  noise_point_report(0)
 {
 	if (params_BFER.n_threads < 1)
 	{
@@ -40,6 +48,47 @@ BFER<B,R,Q>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	if (params_BFER.n_conc_points > 1)
+	{
+#ifdef AFF3CT_MPI
+		std::stringstream message;
+		message << "The concurrent noise points are not compatible with MPI.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+#endif
+
+		if (params_BFER.err_track_enable || params_BFER.err_track_revert)
+		{
+			std::stringstream message;
+			message << "The concurrent noise points are not compatible with the error tracker.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (params_BFER.mnt_mutinfo)
+		{
+			std::stringstream message;
+			message << "The concurrent noise points are not compatible with the mutual information monitor.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (params_BFER.debug)
+		{
+			std::stringstream message;
+			message << "The concurrent noise points are not compatible with the debug mode.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	// the error tracker keeps pointers on the output sockets, they can't be moved in an arena
+	if (params_BFER.sck_arena && (params_BFER.err_track_enable || params_BFER.err_track_revert))
+	{
+		std::stringstream message;
+		message << "The socket buffers arena is not compatible with the error tracker.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (!params_BFER.pin_threads.empty())
+		thread_pinning.reset(new tools::Thread_pinning(params_BFER.pin_threads, params_BFER.n_threads));
+
 	if (params_BFER.err_track_enable)
 	{
 		for (auto tid = 0; tid < params_BFER.n_threads; tid++)
@@ -78,6 +127,16 @@ void BFER<B,R,Q>
 template <typename B, typename R, typename Q>
 void BFER<B,R,Q>
 ::launch()
+{
+	this->launch_noise_points();
+
+	// the main thread has been pinned as the thread 0 of the simulation
+	this->unpin_thread();
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::launch_noise_points()
 {
 	if (!params_BFER.err_track_revert)
 	{
@@ -97,6 +156,12 @@ void BFER<B,R,Q>
 		noise_step  = -1;
 	}
 
+	if (params_BFER.n_conc_points > 1)
+	{
+		this->launch_concurrent(noise_begin, noise_end, noise_step);
+		return;
+	}
+
 	// for each NOISE to be simulated
 	for (auto noise_idx = noise_begin; noise_idx != noise_end; noise_idx += noise_step)
 	{
@@ -163,6 +228,7 @@ void BFER<B,R,Q>
 			terminal->start_temp_report(params_BFER.ter->frequency);
 
 		this->t_start_noise_point = std::chrono::steady_clock::now();
+		this->cancel_frames(false);
 
 		try
 		{
@@ -214,40 +280,7 @@ void BFER<B,R,Q>
 			tools::Terminal::stop();
 
 
-		if (params_BFER.mnt_er->err_hist != -1)
-		{
-			auto err_hist = monitor_er_red->get_err_hist();
-
-			if (err_hist.get_n_values() != 0)
-			{
-				std::string noise_value;
-				switch (this->noise->get_type())
-				{
-					case tools::Noise_type::SIGMA:
-						if (params_BFER.noise->type == "EBN0")
-							noise_value = std::to_string(dynamic_cast<tools::Sigma<>*>(this->noise.get())->get_ebn0());
-						else //(params_BFER.noise_type == "ESN0")
-							noise_value = std::to_string(dynamic_cast<tools::Sigma<>*>(this->noise.get())->get_esn0());
-						break;
-					case tools::Noise_type::ROP:
-					case tools::Noise_type::EP:
-						noise_value = std::to_string(this->noise->get_noise());
-						break;
-				}
-
-				std::ofstream file_err_hist(params_BFER.mnt_er->err_hist_path + "_" + noise_value + ".txt");
-				file_err_hist << "\"Number of error bits per wrong frame\"; \"Histogram (noise: " << noise_value
-				              << this->noise->get_unity() << ", on " << err_hist.get_n_values() << " frames)\""
-				              << std::endl;
-
-				int max;
-				if (params_BFER.mnt_er->err_hist == 0)
-					max = err_hist.get_hist_max();
-				else
-					max = params_BFER.mnt_er->err_hist;
-				err_hist.dump(file_err_hist, 0, max);
-			}
-		}
+		this->dump_err_hist();
 
 		if (this->dumper_red != nullptr && !this->simu_error)
 		{
@@ -258,6 +291,14 @@ void BFER<B,R,Q>
 			this->dumper_red->clear();
 		}
 
+		if (!params_BFER.trace_path.empty())
+		{
+			std::stringstream s_noise;
+			s_noise << std::setprecision(2) << std::fixed << this->noise->get_noise();
+
+			tools::Tracer::dump(params_BFER.trace_path + "_" + s_noise.str() + ".json");
+		}
+
 		if (tools::Terminal::is_over())
 			break;
 
@@ -272,6 +313,336 @@ void BFER<B,R,Q>
 	}
 }
 
+template <typename B, typename R, typename Q>
+double BFER<B,R,Q>
+::calibrate(const std::chrono::milliseconds duration)
+{
+	if (duration <= std::chrono::milliseconds(0))
+	{
+		std::stringstream message;
+		message << "'duration' has to be greater than 0 ('duration' = " << duration.count() << " ms).";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the chain runs during 'duration' whatever the monitor criteria, the build errors are not displayed
+	this->calibration_time = duration;
+	this->calib_exception  = nullptr;
+
+	double thr;
+	try
+	{
+		thr = this->_calibrate();
+	}
+	catch (...)
+	{
+		this->calibration_time = std::chrono::milliseconds(0);
+		this->unpin_thread();
+		throw;
+	}
+
+	this->calibration_time = std::chrono::milliseconds(0);
+	this->unpin_thread();
+
+	return thr;
+}
+
+template <typename B, typename R, typename Q>
+double BFER<B,R,Q>
+::_calibrate()
+{
+	using namespace std::chrono;
+
+	this->build_communication_chain();
+
+	// the caller decides if the exception means that the inter frame level is not supported
+	if (this->calib_exception != nullptr)
+		std::rethrow_exception(this->calib_exception);
+
+	if (tools::Terminal::is_over() || this->simu_error)
+		return 0.;
+
+	const auto noise_idx = params_BFER.noise->type == "EP" ? params_BFER.noise->range.size() -1 : 0;
+	this->noise.reset(params_BFER.noise->template build<R>(params_BFER.noise->range[noise_idx], bit_rate,
+	                                                       params_BFER.mdm->bps, params_BFER.mdm->cpm_upf));
+
+	if (this->distributions != nullptr)
+		this->distributions->read_distribution(this->noise->get_noise());
+
+	this->t_start_noise_point = steady_clock::now();
+	this->cancel_frames(false);
+
+	this->_launch();
+	module::Monitor_reduction::is_done_all(true, true); // final reduction
+
+	const auto elapsed = (double)duration_cast<microseconds>(steady_clock::now() - this->t_start_noise_point).count();
+
+	const auto n_bits = (double)this->monitor_er_red->get_n_analyzed_fra() * (double)this->monitor_er_red->get_K();
+	const auto thr    = elapsed != 0. ? n_bits / elapsed / (double)params_BFER.n_threads : 0.; // Mb/s per thread
+
+	// the calibration does not count in the statistics of the simulation
+	for (auto &m : modules)
+		for (auto& mm : m.second)
+			if (mm != nullptr)
+				for (auto &t : mm->tasks)
+					t->reset_stats();
+
+	if (!params_BFER.trace_path.empty())
+		tools::Tracer::clear();
+
+	module::Monitor_reduction::reset_all();
+	tools::Terminal::reset();
+
+	return thr;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::launch_concurrent(const int noise_begin, const int noise_end, const int noise_step)
+{
+	this->noise_points.clear();
+	for (auto noise_idx = noise_begin; noise_idx != noise_end; noise_idx += noise_step)
+	{
+		std::unique_ptr<Noise_point> point(new Noise_point());
+		point->noise.reset(params_BFER.noise->template build<R>(params_BFER.noise->range[noise_idx], bit_rate,
+		                                                        params_BFER.mdm->bps, params_BFER.mdm->cpm_upf));
+		point->monitor.reset(new Monitor_BFER_type(*this->monitor_er[0]));
+		point->monitor->activate_err_histogram(params_BFER.mnt_er->err_hist != -1);
+
+		// manage noise distributions to be sure it exists
+		if (this->distributions != nullptr)
+			this->distributions->read_distribution(point->noise->get_noise());
+
+		this->noise_points.push_back(std::move(point));
+	}
+
+	if (this->noise_points.empty())
+		return;
+
+	this->noise_point_of = std::vector<std::atomic<int>>(params_BFER.n_threads);
+	for (auto &p : this->noise_point_of)
+		p = -1;
+	this->noise_point_report = 0;
+
+	// the chain is initialized with the first point, then each thread sets the noise of the point it simulates
+	this->noise.reset(this->noise_points[0]->noise->clone());
+
+	if (params_BFER.display_legend && !params_BFER.ter->disabled)
+		terminal->legend(std::cout);
+
+	this->t_start_noise_point = std::chrono::steady_clock::now();
+	this->cancel_frames(false);
+
+	try
+	{
+		this->_launch();
+	}
+	catch (std::exception const& e)
+	{
+		rang::format_on_each_line(std::cerr, std::string(e.what()) + "\n", rang::tag::error);
+		this->simu_error = true;
+
+		tools::Terminal::stop();
+	}
+
+	if (!params_BFER.ter->disabled && params_BFER.statistics && !this->simu_error)
+	{
+		std::vector<std::vector<const module::Module*>> mod_vec;
+		for (auto &vm : modules)
+		{
+			std::vector<const module::Module*> sub_mod_vec;
+			for (auto& m : vm.second)
+				sub_mod_vec.push_back(m);
+			mod_vec.push_back(std::move(sub_mod_vec));
+		}
+
+		std::cout << "#" << std::endl;
+		tools::Stats::show(mod_vec, true, std::cout);
+		std::cout << "#" << std::endl;
+	}
+
+	if (!params_BFER.trace_path.empty())
+		tools::Tracer::dump(params_BFER.trace_path + ".json");
+
+	this->noise_points.clear();
+	this->noise_point_of.clear();
+}
+
+template <typename B, typename R, typename Q>
+bool BFER<B,R,Q>
+::keep_looping_noise_points(const int tid)
+{
+	const auto cur = this->noise_point_of[tid].load();
+
+	// merge the frames simulated since the last call into the monitor of the current point, only the threads of
+	// this point are synchronized
+	if (cur != -1)
+	{
+		auto &point = *this->noise_points[cur];
+
+		{
+			std::lock_guard<std::mutex> lock_point(point.mutex);
+
+			point.monitor->collect(*this->monitor_er[tid], true);
+			this->monitor_er[tid]->reset();
+
+			using namespace std::chrono;
+			point.time_over = params_BFER.stop_time != seconds(0) &&
+			                  (steady_clock::now() - point.t_start) >= params_BFER.stop_time;
+
+			if (point.monitor->is_done() || point.time_over)
+				point.done = true;
+		}
+
+		if (!point.done && !tools::Terminal::is_interrupt())
+			return true;
+	}
+
+	// the thread leaves or joins a point
+	std::lock_guard<std::mutex> lock(this->mutex_noise_points);
+
+	// a first interrupt stops the running points, a second one stops the simulation
+	if (tools::Terminal::is_interrupt())
+	{
+		const auto over = tools::Terminal::is_over();
+		for (auto p = this->noise_point_report; p < this->noise_points.size(); p++)
+		{
+			auto &point = *this->noise_points[p];
+			if (point.started || over)
+				point.done = true;
+			if (!point.started && over)
+				point.cancelled = true;
+		}
+
+		if (!over)
+			tools::Terminal::reset();
+	}
+
+	// the other threads of a finished point abandon their current frames
+	for (size_t t = 0; t < this->noise_point_of.size(); t++)
+	{
+		const auto p = this->noise_point_of[t].load();
+		if (p != -1 && this->noise_points[p]->done)
+			this->cancel_tokens[t].requested = true;
+	}
+
+	if (cur != -1)
+	{
+		if (!this->noise_points[cur]->done)
+			return true;
+
+		this->noise_points[cur]->n_workers--;
+		this->noise_point_of[tid] = -1;
+
+		this->report_noise_points();
+	}
+
+	// the thread joins the unfinished point with the fewest threads (among the 'n_conc_points' first ones)
+	auto best = -1, n_active = 0;
+	for (auto p = this->noise_point_report; p < this->noise_points.size() && n_active < params_BFER.n_conc_points;
+	     p++)
+	{
+		const auto &point = *this->noise_points[p];
+		if (point.done)
+			continue;
+
+		if (best == -1 || point.n_workers < this->noise_points[best]->n_workers)
+			best = (int)p;
+		n_active++;
+	}
+
+	if (best == -1)
+		return false;
+
+	auto &point = *this->noise_points[best];
+	if (!point.started)
+	{
+		point.started = true;
+		point.t_start = std::chrono::steady_clock::now();
+	}
+	point.n_workers++;
+	this->noise_point_of[tid] = best;
+	this->cancel_tokens[tid].reset();
+
+	this->set_thread_noise(*point.noise, tid);
+
+	return true;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::report_noise_points()
+{
+	// the points are reported in the simulation order, when all their threads have left them
+	while (this->noise_point_report < this->noise_points.size())
+	{
+		auto &point = *this->noise_points[this->noise_point_report];
+		if (!point.done || point.n_workers)
+			break;
+
+		if (!point.cancelled && !this->simu_error)
+		{
+			this->noise.reset(point.noise->clone());
+			this->monitor_er_red->copy(*point.monitor, true);
+
+			if (!params_BFER.ter->disabled)
+				terminal->final_report(std::cout);
+
+			this->dump_err_hist();
+
+			// same stop criterion as the sequential simulation: the next points are not reported
+			if (!params_BFER.crit_nostop && !point.monitor->fe_limit_achieved() &&
+			    (point.monitor->frame_limit_achieved() || point.time_over))
+				for (auto p = this->noise_point_report +1; p < this->noise_points.size(); p++)
+				{
+					this->noise_points[p]->done      = true;
+					this->noise_points[p]->cancelled = true;
+				}
+		}
+
+		this->noise_point_report++;
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::dump_err_hist()
+{
+	if (params_BFER.mnt_er->err_hist == -1)
+		return;
+
+	auto err_hist = monitor_er_red->get_err_hist();
+
+	if (err_hist.get_n_values() != 0)
+	{
+		std::string noise_value;
+		switch (this->noise->get_type())
+		{
+			case tools::Noise_type::SIGMA:
+				if (params_BFER.noise->type == "EBN0")
+					noise_value = std::to_string(dynamic_cast<tools::Sigma<>*>(this->noise.get())->get_ebn0());
+				else //(params_BFER.noise_type == "ESN0")
+					noise_value = std::to_string(dynamic_cast<tools::Sigma<>*>(this->noise.get())->get_esn0());
+				break;
+			case tools::Noise_type::ROP:
+			case tools::Noise_type::EP:
+				noise_value = std::to_string(this->noise->get_noise());
+				break;
+		}
+
+		std::ofstream file_err_hist(params_BFER.mnt_er->err_hist_path + "_" + noise_value + ".txt");
+		file_err_hist << "\"Number of error bits per wrong frame\"; \"Histogram (noise: " << noise_value
+		              << this->noise->get_unity() << ", on " << err_hist.get_n_values() << " frames)\""
+		              << std::endl;
+
+		int max;
+		if (params_BFER.mnt_er->err_hist == 0)
+			max = err_hist.get_hist_max();
+		else
+			max = params_BFER.mnt_er->err_hist;
+		err_hist.dump(file_err_hist, 0, max);
+	}
+}
+
 template <typename B, typename R, typename Q>
 std::unique_ptr<typename BFER<B,R,Q>::Monitor_MI_type> BFER<B,R,Q>
 ::build_monitor_mi(const int tid)
@@ -329,6 +700,7 @@ void BFER<B,R,Q>
 	for (auto tid = 0; tid < params_BFER.n_threads; tid++)
 	{
 		this->monitor_er[tid] = this->build_monitor_er(tid);
+		this->monitor_er[tid]->set_cancellation_token(&this->cancel_tokens[tid]);
 		this->set_module("monitor_er", tid, this->monitor_er[tid]);
 	}
 
@@ -374,8 +746,17 @@ void BFER<B,R,Q>
 {
 	try
 	{
+		// the modules are built on the pinned thread, their memory is allocated on the local NUMA node
+		simu->pin_thread(tid);
+
 		simu->__build_communication_chain(tid);
 
+		// allocate the output sockets buffers on the thread that will use them (first touch policy)
+		for (auto &m : simu->modules)
+			if ((size_t)tid < m.second.size() && m.second[tid] != nullptr)
+				for (auto &t : m.second[tid]->tasks)
+					t->set_autoalloc(true);
+
 		if (simu->params_BFER.err_track_enable)
 			simu->monitor_er[tid]->add_handler_fe(std::bind(&tools::Dumper::add,
 			                                                simu->dumper[tid].get(),
@@ -394,8 +775,14 @@ void BFER<B,R,Q>
 		std::string msg = e.what(); // get only the function signature
 		tools::exception::no_backtrace = save;
 
-		if (std::find(simu->prev_err_messages.begin(), simu->prev_err_messages.end(), msg) ==
-		                                               simu->prev_err_messages.end())
+		// the calibration does not display the errors, the first exception is rethrown by 'calibrate'
+		if (simu->calibration_time != std::chrono::milliseconds(0))
+		{
+			if (simu->calib_exception == nullptr)
+				simu->calib_exception = std::current_exception();
+		}
+		else if (std::find(simu->prev_err_messages.begin(), simu->prev_err_messages.end(), msg) ==
+		                                                    simu->prev_err_messages.end())
 		{
 			// with backtrace if debug mode
 			rang::format_on_each_line(std::cerr, std::string(e.what()) + "\n", rang::tag::error);
@@ -408,12 +795,54 @@ void BFER<B,R,Q>
 
 template <typename B, typename R, typename Q>
 bool BFER<B,R,Q>
-::keep_looping_noise_point()
+::keep_looping_noise_point(const int tid)
 {
+	if (!this->noise_points.empty())
+		return this->keep_looping_noise_points(tid);
+
+	// the calibration ignores the monitor criteria to run during the whole calibration time
+	const auto calibrating = this->calibration_time != std::chrono::milliseconds(0);
+
 	// communication chain execution
-	return !(tools::Terminal::is_interrupt() // if user stopped the simulation
-	         || module::Monitor_reduction::is_done_all() // while any monitor criteria is not reached -> do reduction
-	         || this->stop_time_reached());
+	const auto stop = tools::Terminal::is_interrupt() // if user stopped the simulation
+	               || (!calibrating && module::Monitor_reduction::is_done_all()) // monitor criteria -> do reduction
+	               || this->stop_time_reached();
+
+	// the frames being simulated by the other threads will not be counted, they can be abandoned
+	if (stop)
+		this->cancel_frames();
+
+	return !stop;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::pin_thread(const int tid)
+{
+	if (this->thread_pinning != nullptr && !this->thread_pinning->pin(tid) && !this->pin_warning.exchange(true))
+		std::clog << rang::tag::warning << "The threads can't be pinned on the cores ('pin_threads' = "
+		          << this->thread_pinning->get_policy() << "), the simulation continues without pinning."
+		          << std::endl;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::unpin_thread()
+{
+	if (this->thread_pinning != nullptr && !this->thread_pinning->unpin() && !this->pin_warning.exchange(true))
+		std::clog << rang::tag::warning << "The initial affinity of the main thread can't be restored."
+		          << std::endl;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::cancel_frames(const bool val)
+{
+	for (auto &token : this->cancel_tokens)
+		if (val)
+			token.requested = true;
+		else
+			token.reset();
 }
 
 template <typename B, typename R, typename Q>
@@ -421,8 +850,9 @@ bool BFER<B,R,Q>
 ::stop_time_reached()
 {
 	using namespace std::chrono;
-	return params_BFER.stop_time != seconds(0) && (steady_clock::now() - this->t_start_noise_point) >=
-	                                                                     params_BFER.stop_time;
+	const auto elapsed = steady_clock::now() - this->t_start_noise_point;
+	return (params_BFER.stop_time  != seconds     (0) && elapsed >= params_BFER.stop_time ) ||
+	       (this->calibration_time != milliseconds(0) && elapsed >= this->calibration_time);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -2,11 +2,16 @@
 #define SIMULATION_BFER_HPP_
 
 #include <map>
+#include <mutex>
+#include <atomic>
 #include <chrono>
+#include <exception>
 #include <vector>
 #include <memory>
 
 #include "Tools/Threads/Barrier.hpp"
+#include "Tools/Threads/Thread_pinning.hpp"
+#include "Tools/Sequence/Socket_arena.hpp"
 
 #include "Tools/Display/Reporter/BFER/Reporter_BFER.hpp"
 #include "Tools/Display/Reporter/MI/Reporter_MI.hpp"
@@ -47,10 +52,22 @@ protected:
 	std::mutex               mutex_exception;
 	std::vector<std::string> prev_err_messages;
 	std::vector<std::string> prev_err_messages_to_display;
+	std::exception_ptr       calib_exception; // the first exception raised while building the chain to calibrate
 
 	// a barrier to synchronize the threads
 	tools::Barrier barrier;
 
+	// the mapping of the threads on the cores (nullptr if the threads are not pinned)
+	std::unique_ptr<tools::Thread_pinning> thread_pinning;
+	std::atomic<bool>                      pin_warning; // true when a failed pinning has already been reported
+
+	// the output sockets of each thread in a contiguous memory space (built at the first noise point)
+	std::vector<std::unique_ptr<tools::Socket_arena>> arenas;
+
+	// requested when the frames being simulated by a thread will be thrown away (polled by the decoders), the
+	// monitors do not count the frames abandoned by the decoders
+	std::vector<module::Cancellation_token> cancel_tokens;
+
 	// code specifications
 	const float bit_rate;
 
@@ -89,15 +106,42 @@ protected:
 
 	std::chrono::steady_clock::time_point t_start_noise_point;
 
+	// the duration of the calibration (0 if the simulation is not calibrating)
+	std::chrono::milliseconds calibration_time;
+
+private:
+	// concurrent noise points: each point has its own monitor, the threads move from a point to another
+	struct Noise_point
+	{
+		std::unique_ptr<tools::Noise<R>>      noise;
+		std::unique_ptr<Monitor_BFER_type>    monitor;
+		std::mutex                            mutex;             // protects the monitor and 'time_over'
+		std::chrono::steady_clock::time_point t_start;
+		int                                   n_workers = 0;     // number of threads simulating this point
+		bool                                  started   = false;
+		std::atomic<bool>                     done;              // no more frames have to be simulated
+		bool                                  time_over = false; // the point has been stopped by the stop time
+		bool                                  cancelled = false; // the point will not be reported
+
+		Noise_point() : done(false) {}
+	};
+
+	std::vector<std::unique_ptr<Noise_point>> noise_points;       // in the simulation order
+	std::vector<std::atomic<int>>             noise_point_of;     // the point simulated by each thread (-1 if none)
+	size_t                                    noise_point_report; // the next point to report
+	std::mutex                                mutex_noise_points; // taken when a thread leaves or joins a point
+
 public:
 	explicit BFER(const factory::BFER::parameters& params_BFER);
 	virtual ~BFER() = default;
 	void launch();
+	double calibrate(const std::chrono::milliseconds duration);
 
 protected:
 	        void  _build_communication_chain();
 	virtual void __build_communication_chain(const int tid = 0) = 0;
 	virtual void _launch() = 0;
+	virtual void set_thread_noise(const tools::Noise<R> &noise, const int tid = 0) = 0;
 
 	std::unique_ptr<Monitor_MI_type>   build_monitor_mi(const int tid = 0);
 	std::unique_ptr<Monitor_BFER_type> build_monitor_er(const int tid = 0);
@@ -105,10 +149,20 @@ protected:
 	void build_reporters();
 	void build_monitors ();
 
-	virtual bool keep_looping_noise_point();
+	virtual bool keep_looping_noise_point(const int tid = 0);
 	bool stop_time_reached();
+	void pin_thread(const int tid = 0);
+	void unpin_thread();
+	void cancel_frames(const bool val = true);
 
 private:
+	void launch_noise_points();
+	double _calibrate();
+	void launch_concurrent(const int noise_begin, const int noise_end, const int noise_step);
+	bool keep_looping_noise_points(const int tid);
+	void report_noise_points();
+	void dump_err_hist();
+
 	static void start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid);
 };
 }
@@ -79,6 +79,10 @@ void BFER_ite<B,R,Q>
 	    std::static_pointer_cast<module::Decoder>(codec[tid]->get_decoder_siho()))
 		this->set_module("decoder_siho", tid, codec[tid]->get_decoder_siho());
 
+	// the decoders abandon the frames that will be thrown away (when the noise point is over)
+	codec[tid]->get_decoder_siso()->set_cancellation_token(&this->cancel_tokens[tid]);
+	codec[tid]->get_decoder_siho()->set_cancellation_token(&this->cancel_tokens[tid]);
+
 	this->monitor_er[tid]->add_handler_check(std::bind(&module::Codec_SISO_SIHO<B,Q>::reset, codec[tid].get()));
 
 	interleaver_core[tid]->init();
@@ -142,11 +146,16 @@ void BFER_ite<B,R,Q>
 {
 	// set current sigma
 	for (auto tid = 0; tid < this->params_BFER_ite.n_threads; tid++)
-	{
-		this->channel[tid]->set_noise(*this->noise);
-		this->modem  [tid]->set_noise(*this->noise);
-		this->codec  [tid]->set_noise(*this->noise);
-	}
+		this->set_thread_noise(*this->noise, tid);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_ite<B,R,Q>
+::set_thread_noise(const tools::Noise<R> &noise, const int tid)
+{
+	this->channel[tid]->set_noise(noise);
+	this->modem  [tid]->set_noise(noise);
+	this->codec  [tid]->set_noise(noise);
 }
 
 template <typename B, typename R, typename Q>
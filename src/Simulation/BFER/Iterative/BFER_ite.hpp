@@ -53,6 +53,7 @@ public:
 protected:
 	virtual void __build_communication_chain(const int tid = 0);
 	virtual void _launch();
+	virtual void set_thread_noise(const tools::Noise<R> &noise, const int tid = 0);
 
 	virtual std::unique_ptr<module::Source          <B    >> build_source     (const int tid = 0);
 	virtual std::unique_ptr<module::CRC             <B    >> build_crc        (const int tid = 0);
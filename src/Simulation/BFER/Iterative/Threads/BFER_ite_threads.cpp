@@ -5,6 +5,8 @@
 #include <thread>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Sequence/Sequence.hpp"
+#include "Tools/Perf/Tracer/Tracer.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
 
 #include "BFER_ite_threads.hpp"
@@ -54,6 +56,8 @@ void BFER_ite_threads<B,R,Q>
 {
 	try
 	{
+		simu->pin_thread(tid);
+		tools::Tracer::set_thread_id(tid);
 		simu->sockets_binding(tid);
 		simu->simulation_loop(tid);
 	}
@@ -158,6 +162,8 @@ void BFER_ite_threads<B,R,Q>
 			auto chn_data = (uint8_t*)(chn[chn::sck::add_noise_wg::H_N].get_dataptr());
 			auto chn_bytes = chn[chn::sck::add_noise_wg::H_N].get_databytes();
 			std::fill(chn_data, chn_data + chn_bytes, 0);
+			// initialized once, the buffer can't be shared in the socket buffers arena
+			chn[chn::sck::add_noise_wg::H_N].set_persistent(true);
 		}
 		if (!mdm.is_filter())
 			mdm[mdm::sck::filter::Y_N2](chn[chn::sck::add_noise_wg::Y_N]);
@@ -307,25 +313,49 @@ template <typename B, typename R, typename Q>
 void BFER_ite_threads<B,R,Q>
 ::simulation_loop(const int tid)
 {
-	auto &source          = *this->source         [tid];
 	auto &crc             = *this->crc            [tid];
 	auto &codec           = *this->codec          [tid];
-	auto &interleaver_bit = *this->interleaver_bit[tid];
 	auto &modem           = *this->modem          [tid];
-	auto &channel         = *this->channel        [tid];
-	auto &quantizer       = *this->quantizer      [tid];
 	auto &interleaver_llr = *this->interleaver_llr[tid];
 	auto &coset_real      = *this->coset_real     [tid];
 	auto &coset_bit       = *this->coset_bit      [tid];
 	auto &monitor         = *this->monitor_er     [tid];
 
-	auto &encoder      = *codec.get_encoder();
 	auto &decoder_siso = *codec.get_decoder_siso();
 	auto &decoder_siho = *codec.get_decoder_siho();
 
 	using namespace module;
 
-	while (this->keep_looping_noise_point())
+	// the configuration is resolved once, before the loop
+	const auto is_crc    = this->params_BFER_ite.crc->type != "NO";
+	const auto crc_start = this->params_BFER_ite.crc_start;
+	const auto is_demod  = modem.is_demodulator();
+
+	auto &tdemodulate = this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos ?
+	                    modem[mdm::tsk::tdemodulate_wg] : modem[mdm::tsk::tdemodulate];
+	auto &decode_siho = this->params_BFER_ite.coded_monitoring ?
+	                    decoder_siho[dec::tsk::decode_siho_cw] : decoder_siho[dec::tsk::decode_siho];
+
+	// the chain before the turbo demodulation loop (up to the first demodulation)
+	tools::Sequence sequence_pre(this->sequence_firsts(tid), {&tdemodulate,
+	                                                          &coset_real[cst::tsk::apply],
+	                                                          &coset_bit [cst::tsk::apply],
+	                                                          &monitor   [mnt::tsk::check_errors]});
+
+	// the chain after the turbo demodulation loop (from the last coset or the hard decoder to the monitor)
+	auto &first_post = this->params_BFER_ite.coset ? coset_real[cst::tsk::apply] : decode_siho;
+	tools::Sequence sequence_post({&first_post}, {&decoder_siso   [dec::tsk::decode_siso],
+	                                              &interleaver_llr[itl::tsk::interleave ]});
+
+	// the tasks of the turbo demodulation loop are not in the arena, the buffers they read are never shared
+	if (this->params_BFER_ite.sck_arena && this->arenas[tid] == nullptr)
+	{
+		auto tasks = sequence_pre.get_tasks();
+		tasks.insert(tasks.end(), sequence_post.get_tasks().begin(), sequence_post.get_tasks().end());
+		this->arenas[tid].reset(new tools::Socket_arena(tasks));
+	}
+
+	while (this->keep_looping_noise_point(tid))
 	{
 		if (this->params_BFER_ite.debug)
 		{
@@ -339,40 +369,7 @@ void BFER_ite_threads<B,R,Q>
 			std::cout << "#"                                     << std::endl;
 		}
 
-		if (this->params_BFER_ite.src->type != "AZCW")
-		{
-			source[src::tsk::generate].exec();
-			if (this->params_BFER_ite.crc->type != "NO")
-				crc[crc::tsk::build].exec();
-			if (this->params_BFER_ite.cdc->enc->type != "NO")
-				encoder[enc::tsk::encode].exec();
-
-			interleaver_bit[itl::tsk::interleave].exec();
-			modem          [mdm::tsk::modulate  ].exec();
-		}
-
-		if (this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos)
-		{
-			if (this->params_BFER_ite.chn->type != "NO")
-				channel[chn::tsk::add_noise_wg].exec();
-			if (modem.is_filter())
-				modem [mdm::tsk::filter].exec();
-			if (this->params_BFER_ite.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate_wg].exec();
-		}
-		else
-		{
-			if (this->params_BFER_ite.chn->type != "NO")
-				channel[chn::tsk::add_noise].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (this->params_BFER_ite.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate].exec();
-		}
+		sequence_pre.exec();
 
 		interleaver_llr[itl::tsk::deinterleave].exec();
 
@@ -382,7 +379,7 @@ void BFER_ite_threads<B,R,Q>
 		for (auto ite = 1; ite <= this->params_BFER_ite.n_ite; ite++)
 		{
 			// ------------------------------------------------------------------------------------------- CRC checking
-			if (this->params_BFER_ite.crc->type != "NO" && ite >= this->params_BFER_ite.crc_start)
+			if (is_crc && ite >= crc_start)
 			{
 				codec[cdc::tsk::extract_sys_bit].exec();
 				if (crc[crc::tsk::check].exec())
@@ -405,56 +402,39 @@ void BFER_ite_threads<B,R,Q>
 			interleaver_llr[itl::tsk::interleave].exec();
 
 			// ------------------------------------------------------------------------------------------- demodulation
-			if (this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos)
-			{
-				if (modem.is_demodulator())
-					modem[mdm::tsk::tdemodulate_wg].exec();
-			}
-			else
-			{
-				if (modem.is_demodulator())
-					modem[mdm::tsk::tdemodulate].exec();
-			}
+			if (is_demod)
+				tdemodulate.exec();
 
 			// ----------------------------------------------------------------------------------------- deinterleaving
 			interleaver_llr[itl::tsk::deinterleave].exec();
 		}
 
-		if (this->params_BFER_ite.coset)
-		{
-			coset_real[cst::tsk::apply].exec();
-
-			if (this->params_BFER_ite.coded_monitoring)
-			{
-				decoder_siho[dec::tsk::decode_siho_cw].exec();
-				coset_bit   [cst::tsk::apply         ].exec();
-			}
-			else
-			{
-				decoder_siho[dec::tsk::decode_siho].exec();
-				coset_bit   [cst::tsk::apply      ].exec();
-
-				if (this->params_BFER_ite.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
-		else
-		{
-			if (this->params_BFER_ite.coded_monitoring)
-			{
-				decoder_siho[dec::tsk::decode_siho_cw].exec();
-			}
-			else
-			{
-				decoder_siho[dec::tsk::decode_siho].exec();
+		sequence_post.exec();
+	}
+}
 
-				if (this->params_BFER_ite.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
+template <typename B, typename R, typename Q>
+std::vector<module::Task*> BFER_ite_threads<B,R,Q>
+::sequence_firsts(const int tid)
+{
+	using namespace module;
 
-		monitor[mnt::tsk::check_errors].exec();
+	std::vector<Task*> firsts;
+	if (this->params_BFER_ite.src->type == "AZCW")
+	{
+		// the modulation has been done once in the sockets binding, the chain starts with the consumers of the modem
+		auto &mdm = *this->modem[tid];
+		for (auto &s : mdm[mdm::tsk::modulate].sockets)
+			for (auto c : s->get_bound_sockets())
+				firsts.push_back(&c->get_task());
 	}
+	else
+	{
+		auto &src = *this->source[tid];
+		firsts.push_back(&src[src::tsk::generate]);
+	}
+
+	return firsts;
 }
 
 // ==================================================================================== explicit template instantiation
@@ -21,6 +21,8 @@ private:
 	void sockets_binding(const int tid = 0);
 	void simulation_loop(const int tid = 0);
 
+	std::vector<module::Task*> sequence_firsts(const int tid = 0);
+
 	static void start_thread(BFER_ite_threads<B,R,Q> *simu, const int tid = 0);
 };
 }
@@ -43,15 +43,19 @@ template <typename B, typename R, typename Q>
 void BFER_std<B,R,Q>
 ::__build_communication_chain(const int tid)
 {
-	// build the objects
-	source     [tid] = build_source    (tid);
-	crc        [tid] = build_crc       (tid);
-	codec      [tid] = build_codec     (tid);
-	modem      [tid] = build_modem     (tid);
-	channel    [tid] = build_channel   (tid);
-	quantizer  [tid] = build_quantizer (tid);
-	coset_real [tid] = build_coset_real(tid);
-	coset_bit  [tid] = build_coset_bit (tid);
+	// build the objects, only the modules of the stages executed by the thread (the seeds are drawn in the same order
+	// as for the whole chain)
+	const auto gen = this->is_gen_stage(tid);
+	const auto dec = this->is_dec_stage(tid);
+
+	if (gen) source    [tid] = build_source    (tid);
+	         crc       [tid] = build_crc       (tid);
+	         codec     [tid] = build_codec     (tid);
+	if (gen) modem     [tid] = build_modem     (tid);
+	if (gen) channel   [tid] = build_channel   (tid);
+	if (gen) quantizer [tid] = build_quantizer (tid);
+	if (gen) coset_real[tid] = build_coset_real(tid);
+	if (dec) coset_bit [tid] = build_coset_bit (tid);
 
 	this->set_module("source"    , tid, source    [tid]);
 	this->set_module("crc"       , tid, crc       [tid]);
@@ -64,6 +68,9 @@ void BFER_std<B,R,Q>
 	this->set_module("decoder"   , tid, codec     [tid]->get_decoder_siho());
 	this->set_module("coset_bit" , tid, coset_bit [tid]);
 
+	// the decoder abandons the frames that will be thrown away (when the noise point is over)
+	codec[tid]->get_decoder_siho()->set_cancellation_token(&this->cancel_tokens[tid]);
+
 	this->monitor_er[tid]->add_handler_check(std::bind(&module::Codec_SIHO<B,Q>::reset, codec[tid].get()));
 
 	try
@@ -130,11 +137,30 @@ void BFER_std<B,R,Q>
 {
 	// set current sigma
 	for (auto tid = 0; tid < this->params_BFER_std.n_threads; tid++)
-	{
-		this->channel[tid]->set_noise(*this->noise);
-		this->modem  [tid]->set_noise(*this->noise);
-		this->codec  [tid]->set_noise(*this->noise);
-	}
+		this->set_thread_noise(*this->noise, tid);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std<B,R,Q>
+::set_thread_noise(const tools::Noise<R> &noise, const int tid)
+{
+	if (this->channel[tid] != nullptr) this->channel[tid]->set_noise(noise);
+	if (this->modem  [tid] != nullptr) this->modem  [tid]->set_noise(noise);
+	this->codec[tid]->set_noise(noise);
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std<B,R,Q>
+::is_gen_stage(const int tid) const
+{
+	return true;
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std<B,R,Q>
+::is_dec_stage(const int tid) const
+{
+	return true;
 }
 
 template <typename B, typename R, typename Q>
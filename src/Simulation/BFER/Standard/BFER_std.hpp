@@ -48,6 +48,12 @@ public:
 protected:
 	virtual void __build_communication_chain(const int tid = 0);
 	virtual void _launch();
+	virtual void set_thread_noise(const tools::Noise<R> &noise, const int tid = 0);
+
+	// the stages of the chain built on the thread 'tid': the generation (from the source to the coset real) and the
+	// decoding (from the decoder to the monitor), both by default (the CRC and the codec are built on both stages)
+	virtual bool is_gen_stage(const int tid = 0) const;
+	virtual bool is_dec_stage(const int tid = 0) const;
 
 	std::unique_ptr<module::Source    <B    >> build_source    (const int tid = 0);
 	std::unique_ptr<module::CRC       <B    >> build_crc       (const int tid = 0);
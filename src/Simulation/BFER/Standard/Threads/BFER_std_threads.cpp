@@ -1,10 +1,13 @@
 #include <cstring>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <chrono>
 #include <thread>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Sequence/Sequence.hpp"
+#include "Tools/Perf/Tracer/Tracer.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
 
 #include "BFER_std_threads.hpp"
@@ -15,8 +18,44 @@ using namespace aff3ct::simulation;
 template <typename B, typename R, typename Q>
 BFER_std_threads<B,R,Q>
 ::BFER_std_threads(const factory::BFER_std::parameters &params_BFER_std)
-: BFER_std<B,R,Q>(params_BFER_std)
+: BFER_std<B,R,Q>(params_BFER_std),
+  pip_free(params_BFER_std.pip_queue_size ? params_BFER_std.pip_queue_size : 2 * params_BFER_std.n_threads),
+  pip_full(params_BFER_std.pip_queue_size ? params_BFER_std.pip_queue_size : 2 * params_BFER_std.n_threads),
+  pip_gen_running(0)
 {
+	if (this->is_pipeline())
+	{
+		if (this->params_BFER_std.n_threads <= this->params_BFER_std.pip_gen_threads)
+		{
+			std::stringstream message;
+			message << "'n_threads' has to be greater than 'pip_gen_threads' ('n_threads' = "
+			        << this->params_BFER_std.n_threads << ", 'pip_gen_threads' = "
+			        << this->params_BFER_std.pip_gen_threads << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->params_BFER_std.err_track_enable)
+		{
+			std::stringstream message;
+			message << "The pipeline mode is not compatible with the error tracker.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->params_BFER_std.n_conc_points > 1)
+		{
+			std::stringstream message;
+			message << "The pipeline mode is not compatible with the concurrent noise points.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->params_BFER_std.sck_arena)
+		{
+			std::stringstream message;
+			message << "The pipeline mode is not compatible with the socket buffers arena.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
 	if (this->params_BFER_std.err_track_revert)
 	{
 		if (this->params_BFER_std.n_threads != 1)
@@ -32,6 +71,26 @@ void BFER_std_threads<B,R,Q>
 {
 	BFER_std<B,R,Q>::_launch();
 
+	if (this->is_pipeline())
+	{
+		if (this->pip_slots.empty())
+		{
+			// the slot buffers have the size of the cut sockets (the same on all the threads)
+			const auto cut_outputs = this->pipeline_cut_outputs(0);
+			this->pip_slots.resize(this->pip_free.get_capacity());
+			for (auto &slot : this->pip_slots)
+				for (auto s : cut_outputs)
+					slot.push_back(mipp::vector<uint8_t>(s->get_databytes()));
+		}
+
+		this->pip_free.clear();
+		this->pip_full.clear();
+		for (size_t slot = 0; slot < this->pip_slots.size(); slot++)
+			this->pip_free.try_push(slot);
+
+		this->pip_gen_running = this->params_BFER_std.pip_gen_threads;
+	}
+
 	std::vector<std::thread> threads(this->params_BFER_std.n_threads -1);
 	// launch a group of slave threads (there is "n_threads -1" slave threads)
 	for (auto tid = 1; tid < this->params_BFER_std.n_threads; tid++)
@@ -54,8 +113,19 @@ void BFER_std_threads<B,R,Q>
 {
 	try
 	{
+		simu->pin_thread(tid);
+		tools::Tracer::set_thread_id(tid);
 		simu->sockets_binding(tid);
-		simu->simulation_loop(tid);
+
+		if (simu->is_pipeline())
+		{
+			if (simu->is_pip_gen_thread(tid))
+				simu->pipeline_gen_loop(tid);
+			else
+				simu->pipeline_dec_loop(tid);
+		}
+		else
+			simu->simulation_loop(tid);
 	}
 	catch (std::exception const& e)
 	{
@@ -77,11 +147,36 @@ void BFER_std_threads<B,R,Q>
 
 		simu->mutex_exception.unlock();
 	}
+
+	// the decoding threads wait for the generation threads to stop, even after an exception
+	if (simu->is_pipeline() && simu->is_pip_gen_thread(tid))
+		simu->pip_gen_running--;
 }
 
 template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
 ::sockets_binding(const int tid)
+{
+	if (this->is_gen_stage(tid))
+		this->sockets_binding_gen(tid);
+
+	if (this->is_dec_stage(tid))
+		this->sockets_binding_dec(tid);
+
+	// bind the two stages (in the pipeline mode, the decoding threads bind them on the slot buffers)
+	if (this->is_gen_stage(tid) && this->is_dec_stage(tid))
+	{
+		const auto cut_outputs = this->pipeline_cut_outputs(tid);
+		const auto cut_inputs  = this->pipeline_cut_inputs (tid);
+		for (size_t c = 0; c < cut_outputs.size(); c++)
+			for (auto s : cut_inputs[c])
+				(*s)(*cut_outputs[c]);
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::sockets_binding_gen(const int tid)
 {
 	using namespace module;
 
@@ -93,9 +188,6 @@ void BFER_std_threads<B,R,Q>
 	auto &chn = *this->channel   [tid];
 	auto &qnt = *this->quantizer [tid];
 	auto &csr = *this->coset_real[tid];
-	auto &dec = *this->codec     [tid]->get_decoder_siho();
-	auto &csb = *this->coset_bit [tid];
-	auto &mnt = *this->monitor_er[tid];
 
 	if (this->params_BFER_std.src->type == "AZCW")
 	{
@@ -141,6 +233,8 @@ void BFER_std_threads<B,R,Q>
 			auto chn_data = (uint8_t*)(chn[chn::sck::add_noise_wg::H_N].get_dataptr());
 			auto chn_bytes = chn[chn::sck::add_noise_wg::H_N].get_databytes();
 			std::fill(chn_data, chn_data + chn_bytes, 0);
+			// initialized once, the buffer can't be shared in the socket buffers arena
+			chn[chn::sck::add_noise_wg::H_N].set_persistent(true);
 		}
 		if (!mdm.is_filter())
 			mdm[mdm::sck::filter::Y_N2](chn[chn::sck::add_noise_wg::Y_N]);
@@ -191,70 +285,65 @@ void BFER_std_threads<B,R,Q>
 	{
 		csr[cst::sck::apply::ref](enc[enc::sck::encode    ::X_N ]);
 		csr[cst::sck::apply::in ](pct[pct::sck::depuncture::Y_N2]);
+	}
+
+	if (this->params_BFER_std.mnt_mutinfo) // this->monitor_mi[tid] != nullptr
+	{
+		auto &mnt = *this->monitor_mi[tid];
+
+		mnt[mnt::sck::get_mutual_info::X](mdm[mdm::sck::modulate  ::X_N1]);
+
+		if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
+			mnt[mnt::sck::get_mutual_info::Y](mdm[mdm::sck::demodulate_wg::Y_N2]);
+		else
+			mnt[mnt::sck::get_mutual_info::Y](mdm[mdm::sck::demodulate::Y_N2]);
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::sockets_binding_dec(const int tid)
+{
+	using namespace module;
+
+	auto &crc = *this->crc       [tid];
+	auto &dec = *this->codec     [tid]->get_decoder_siho();
+	auto &csb = *this->coset_bit [tid];
+	auto &mnt = *this->monitor_er[tid];
 
+	if (this->params_BFER_std.coset)
+	{
 		if (this->params_BFER_std.coded_monitoring)
 		{
-			dec[dec::sck::decode_siho_cw::Y_N](csr[cst::sck::apply         ::out]);
-			csb[cst::sck::apply         ::ref](enc[enc::sck::encode        ::X_N]);
-			csb[cst::sck::apply         ::in ](dec[dec::sck::decode_siho_cw::V_N]);
+			csb[cst::sck::apply::in](dec[dec::sck::decode_siho_cw::V_N]);
 		}
 		else
 		{
 			if (this->params_BFER_std.crc->type == "NO")
 				crc[crc::sck::extract::V_K2](csb[cst::sck::apply::out]);
 
-			dec[dec::sck::decode_siho::Y_N ](csr[cst::sck::apply      ::out ]);
-			csb[cst::sck::apply      ::ref ](crc[crc::sck::build      ::U_K2]);
-			csb[cst::sck::apply      ::in  ](dec[dec::sck::decode_siho::V_K ]);
-			crc[crc::sck::extract    ::V_K1](csb[cst::sck::apply      ::out ]);
+			csb[cst::sck::apply  ::in  ](dec[dec::sck::decode_siho::V_K]);
+			crc[crc::sck::extract::V_K1](csb[cst::sck::apply      ::out]);
 		}
 	}
-	else
+	else if (!this->params_BFER_std.coded_monitoring)
 	{
-		if (this->params_BFER_std.coded_monitoring)
-		{
-			dec[dec::sck::decode_siho_cw::Y_N](pct[pct::sck::depuncture::Y_N2]);
-		}
-		else
-		{
-			if (this->params_BFER_std.crc->type == "NO")
-				crc[crc::sck::extract::V_K2](dec[dec::sck::decode_siho::V_K]);
+		if (this->params_BFER_std.crc->type == "NO")
+			crc[crc::sck::extract::V_K2](dec[dec::sck::decode_siho::V_K]);
 
-			dec[dec::sck::decode_siho::Y_N ](pct[pct::sck::depuncture ::Y_N2]);
-			crc[crc::sck::extract    ::V_K1](dec[dec::sck::decode_siho::V_K ]);
-		}
+		crc[crc::sck::extract::V_K1](dec[dec::sck::decode_siho::V_K]);
 	}
 
 	if (this->params_BFER_std.coded_monitoring)
 	{
-		mnt[mnt::sck::check_errors::U](enc[enc::sck::encode::X_N]);
-
 		if (this->params_BFER_std.coset)
-		{
 			mnt[mnt::sck::check_errors::V](csb[cst::sck::apply::out]);
-		}
 		else
-		{
 			mnt[mnt::sck::check_errors::V](dec[dec::sck::decode_siho_cw::V_N]);
-		}
 	}
 	else
 	{
-		mnt[mnt::sck::check_errors::U](src[src::sck::generate::U_K ]);
-		mnt[mnt::sck::check_errors::V](crc[crc::sck::extract ::V_K2]);
-	}
-
-	if (this->params_BFER_std.mnt_mutinfo) // this->monitor_mi[tid] != nullptr
-	{
-		auto &mnt = *this->monitor_mi[tid];
-
-		mnt[mnt::sck::get_mutual_info::X](mdm[mdm::sck::modulate  ::X_N1]);
-
-		if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
-			mnt[mnt::sck::get_mutual_info::Y](mdm[mdm::sck::demodulate_wg::Y_N2]);
-		else
-			mnt[mnt::sck::get_mutual_info::Y](mdm[mdm::sck::demodulate::Y_N2]);
-
+		mnt[mnt::sck::check_errors::V](crc[crc::sck::extract::V_K2]);
 	}
 }
 
@@ -262,22 +351,17 @@ template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
 ::simulation_loop(const int tid)
 {
-	auto &source     = *this->source    [tid];
-	auto &crc        = *this->crc       [tid];
-	auto &encoder    = *this->codec     [tid]->get_encoder();
-	auto &puncturer  = *this->codec     [tid]->get_puncturer();
-	auto &modem      = *this->modem     [tid];
-	auto &channel    = *this->channel   [tid];
-	auto &quantizer  = *this->quantizer [tid];
-	auto &coset_real = *this->coset_real[tid];
-	auto &decoder    = *this->codec     [tid]->get_decoder_siho();
-	auto &coset_bit  = *this->coset_bit [tid];
-	auto &monitor    = *this->monitor_er[tid];
+	auto &monitor = *this->monitor_er[tid];
 
 	using namespace module;
 
+	tools::Sequence sequence(this->sequence_firsts(tid));
+
+	if (this->params_BFER_std.sck_arena && this->arenas[tid] == nullptr)
+		this->arenas[tid].reset(new tools::Socket_arena(sequence.get_tasks()));
+
 	// communication chain execution
-	while (this->keep_looping_noise_point())
+	while (this->keep_looping_noise_point(tid))
 	{
 		if (this->params_BFER_std.debug)
 		{
@@ -291,91 +375,209 @@ void BFER_std_threads<B,R,Q>
 			std::cout << "#"                                     << std::endl;
 		}
 
-		if (this->params_BFER_std.src->type != "AZCW")
-		{
-			source[src::tsk::generate].exec();
-			if (this->params_BFER_std.crc->type != "NO")
-				crc[crc::tsk::build].exec();
-			if (this->params_BFER_std.cdc->enc->type != "NO")
-				encoder[enc::tsk::encode].exec();
-			if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-				puncturer[pct::tsk::puncture].exec();
-			modem[mdm::tsk::modulate].exec();
-		}
+		sequence.exec();
+	}
+}
 
-		if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
-		{
-			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise_wg].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate_wg].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-		}
-		else if (this->params_BFER_std.chn->type == "OPTICAL" && this->params_BFER_std.mdm->rop_est_bits > 0)
-		{
-			channel[chn::tsk::add_noise].exec();
-			modem[mdm::tsk::demodulate_wg].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-		}
-		else
+template <typename B, typename R, typename Q>
+std::vector<module::Task*> BFER_std_threads<B,R,Q>
+::sequence_firsts(const int tid)
+{
+	using namespace module;
+
+	std::vector<Task*> firsts;
+	if (this->params_BFER_std.src->type == "AZCW")
+	{
+		// the modulation has been done once in the sockets binding, the chain starts with the consumers of the modem
+		auto &mdm = *this->modem[tid];
+		for (auto &s : mdm[mdm::tsk::modulate].sockets)
+			for (auto c : s->get_bound_sockets())
+				firsts.push_back(&c->get_task());
+	}
+	else
+	{
+		auto &src = *this->source[tid];
+		firsts.push_back(&src[src::tsk::generate]);
+	}
+
+	return firsts;
+}
+
+template <typename B, typename R, typename Q>
+module::Task& BFER_std_threads<B,R,Q>
+::decoder_task(const int tid)
+{
+	using namespace module;
+
+	auto &dec = *this->codec[tid]->get_decoder_siho();
+	if (this->params_BFER_std.coded_monitoring)
+		return dec[dec::tsk::decode_siho_cw];
+	else
+		return dec[dec::tsk::decode_siho];
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::pipeline_gen_loop(const int tid)
+{
+	// the generation stage stops right before the decoder (its sockets are not bound to the decoding stage)
+	tools::Sequence sequence(this->sequence_firsts(tid));
+
+	const auto cut_outputs = this->pipeline_cut_outputs(tid);
+
+	while (this->keep_looping_noise_point())
+	{
+		size_t slot;
+		if (!this->pip_free.try_pop(slot))
 		{
-			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
+			std::this_thread::yield(); // all the slots are in flight, wait for the decoding threads
+			continue;
 		}
 
-		if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-			puncturer[pct::tsk::depuncture].exec();
+		sequence.exec();
 
-		if (this->params_BFER_std.coset)
-		{
-			coset_real[cst::tsk::apply].exec();
+		auto &buffers = this->pip_slots[slot];
+		for (size_t c = 0; c < cut_outputs.size(); c++)
+			std::memcpy(buffers[c].data(), cut_outputs[c]->get_dataptr(), cut_outputs[c]->get_databytes());
 
-			if (this->params_BFER_std.coded_monitoring)
-			{
-				decoder  [dec::tsk::decode_siho_cw].exec();
-				coset_bit[cst::tsk::apply         ].exec();
-			}
-			else
-			{
-				decoder  [dec::tsk::decode_siho].exec();
-				coset_bit[cst::tsk::apply      ].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
-		else
-		{
-			if (this->params_BFER_std.coded_monitoring)
-			{
-				decoder[dec::tsk::decode_siho_cw].exec();
-			}
-			else
+		this->pip_full.try_push(slot); // cannot fail: there are as many slots as cells in the queue
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::pipeline_dec_loop(const int tid)
+{
+	tools::Sequence sequence({&this->decoder_task(tid)});
+
+	const auto cut_inputs = this->pipeline_cut_inputs(tid);
+
+	// the slot buffers are raw bytes: check the sizes once here, then bind them without the type checking
+	for (size_t c = 0; c < cut_inputs.size(); c++)
+		for (auto s : cut_inputs[c])
+			if (s->get_databytes() != this->pip_slots[0][c].size())
 			{
-				decoder[dec::tsk::decode_siho].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
+				std::stringstream message;
+				message << "'s->get_databytes()' has to be equal to 'pip_slots[0][c].size()' ('s->get_databytes()' = "
+				        << s->get_databytes() << ", 'pip_slots[0][c].size()' = " << this->pip_slots[0][c].size()
+				        << ", 'c' = " << c << ").";
+				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 			}
-		}
 
-		monitor[mnt::tsk::check_errors].exec();
+	while (true)
+	{
+		// read the state of the generation threads before trying to pop to be sure that the queue is empty at the end
+		const auto gen_over = this->pip_gen_running == 0;
 
-		if (this->params_BFER_std.mnt_mutinfo)
+		size_t slot;
+		if (this->pip_full.try_pop(slot))
 		{
-			auto &monitor = *this->monitor_mi[tid];
+			// bind the consumer sockets directly on the slot buffers (no copy)
+			auto &buffers = this->pip_slots[slot];
+			for (size_t c = 0; c < cut_inputs.size(); c++)
+				for (auto s : cut_inputs[c])
+					s->bind(static_cast<void*>(buffers[c].data()));
 
-			monitor[mnt::tsk::get_mutual_info].exec();
+			sequence.exec();
+
+			this->pip_free.try_push(slot);
 		}
+		else if (gen_over)
+			break;
+		else
+			std::this_thread::yield();
+	}
+}
+
+template <typename B, typename R, typename Q>
+std::vector<module::Socket*> BFER_std_threads<B,R,Q>
+::pipeline_cut_outputs(const int tid)
+{
+	using namespace module;
+
+	auto &src = *this->source    [tid];
+	auto &crc = *this->crc       [tid];
+	auto &enc = *this->codec     [tid]->get_encoder();
+	auto &pct = *this->codec     [tid]->get_puncturer();
+	auto &csr = *this->coset_real[tid];
+
+	std::vector<Socket*> cut_outputs;
+
+	// the input of the decoder
+	if (this->params_BFER_std.coset)
+		cut_outputs.push_back(&csr[cst::sck::apply::out]);
+	else
+		cut_outputs.push_back(&pct[pct::sck::depuncture::Y_N2]);
+
+	// the reference of the monitor
+	if (this->params_BFER_std.coded_monitoring)
+		cut_outputs.push_back(&enc[enc::sck::encode::X_N]);
+	else
+		cut_outputs.push_back(&src[src::sck::generate::U_K]);
+
+	// the reference of the coset (bit)
+	if (this->params_BFER_std.coset)
+	{
+		if (this->params_BFER_std.coded_monitoring)
+			cut_outputs.push_back(&enc[enc::sck::encode::X_N]);
+		else
+			cut_outputs.push_back(&crc[crc::sck::build::U_K2]);
 	}
+
+	return cut_outputs;
+}
+
+template <typename B, typename R, typename Q>
+std::vector<std::vector<module::Socket*>> BFER_std_threads<B,R,Q>
+::pipeline_cut_inputs(const int tid)
+{
+	using namespace module;
+
+	auto &dec = *this->codec     [tid]->get_decoder_siho();
+	auto &csb = *this->coset_bit [tid];
+	auto &mnt = *this->monitor_er[tid];
+
+	std::vector<std::vector<Socket*>> cut_inputs;
+
+	if (this->params_BFER_std.coded_monitoring)
+		cut_inputs.push_back({&dec[dec::sck::decode_siho_cw::Y_N]});
+	else
+		cut_inputs.push_back({&dec[dec::sck::decode_siho::Y_N]});
+
+	cut_inputs.push_back({&mnt[mnt::sck::check_errors::U]});
+
+	if (this->params_BFER_std.coset)
+		cut_inputs.push_back({&csb[cst::sck::apply::ref]});
+
+	return cut_inputs;
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std_threads<B,R,Q>
+::is_gen_stage(const int tid) const
+{
+	return !this->is_pipeline() || this->is_pip_gen_thread(tid);
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std_threads<B,R,Q>
+::is_dec_stage(const int tid) const
+{
+	return !this->is_pipeline() || !this->is_pip_gen_thread(tid);
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std_threads<B,R,Q>
+::is_pipeline() const
+{
+	return this->params_BFER_std.pip_gen_threads > 0;
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std_threads<B,R,Q>
+::is_pip_gen_thread(const int tid) const
+{
+	return tid < this->params_BFER_std.pip_gen_threads;
 }
 
 // ==================================================================================== explicit template instantiation
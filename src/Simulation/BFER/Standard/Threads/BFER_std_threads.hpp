@@ -1,6 +1,13 @@
 #ifndef SIMULATION_BFER_STD_THREADS_HPP_
 #define SIMULATION_BFER_STD_THREADS_HPP_
 
+#include <atomic>
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Threads/Bounded_queue.hpp"
+#include "Module/Socket.hpp"
+
 #include "../BFER_std.hpp"
 
 namespace aff3ct
@@ -10,6 +17,15 @@ namespace simulation
 template <typename B = int, typename R = float, typename Q = R>
 class BFER_std_threads : public BFER_std<B,R,Q>
 {
+private:
+	// pipeline mode: the threads "tid < pip_gen_threads" execute the chain from the source to the coset (real), the
+	// other threads execute the chain from the decoder to the monitor, the frames are exchanged through slots;
+	// each thread builds only the modules of its stage (except the CRC and the codec, built on both stages)
+	std::vector<std::vector<mipp::vector<uint8_t>>> pip_slots; // [slot][cut socket]
+	tools::Bounded_queue<size_t>                    pip_free;  // indexes of the slots ready to be filled
+	tools::Bounded_queue<size_t>                    pip_full;  // indexes of the slots ready to be decoded
+	std::atomic<int>                                pip_gen_running;
+
 public:
 	explicit BFER_std_threads(const factory::BFER_std::parameters &params_BFER_std);
 	virtual ~BFER_std_threads() = default;
@@ -17,10 +33,27 @@ public:
 protected:
 	virtual void _launch();
 
+	virtual bool is_gen_stage(const int tid = 0) const;
+	virtual bool is_dec_stage(const int tid = 0) const;
+
 private:
-	void sockets_binding(const int tid = 0);
+	void sockets_binding    (const int tid = 0);
+	void sockets_binding_gen(const int tid = 0);
+	void sockets_binding_dec(const int tid = 0);
 	void simulation_loop(const int tid = 0);
 
+	bool is_pipeline     (                 ) const;
+	bool is_pip_gen_thread(const int tid = 0) const;
+
+	std::vector<module::Task*> sequence_firsts(const int tid = 0);
+	module::Task&              decoder_task   (const int tid = 0);
+
+	void pipeline_gen_loop(const int tid = 0);
+	void pipeline_dec_loop(const int tid = 0);
+
+	std::vector<module::Socket*             > pipeline_cut_outputs(const int tid = 0);
+	std::vector<std::vector<module::Socket*>> pipeline_cut_inputs (const int tid = 0);
+
 	static void start_thread(BFER_std_threads<B,R,Q> *simu, const int tid = 0);
 };
 }
@@ -1,11 +1,14 @@
 #if !defined(AFF3CT_8BIT_PREC) && !defined(AFF3CT_16BIT_PREC)
 
 #include <cmath>
+#include <iomanip>
+#include <sstream>
 #include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
 #include "Tools/Display/Statistics/Statistics.hpp"
+#include "Tools/Perf/Tracer/Tracer.hpp"
 #include "Tools/general_utils.h"
 #include "Tools/Math/utils.h"
 
@@ -194,6 +197,14 @@ void EXIT<B,R>
 				}
 			}
 
+			if (!params_EXIT.trace_path.empty())
+			{
+				std::stringstream s_noise;
+				s_noise << std::setprecision(2) << std::fixed << ebn0 << "_" << sig_a;
+
+				tools::Tracer::dump(params_EXIT.trace_path + "_" + s_noise.str() + ".json");
+			}
+
 			this->monitor->reset();
 			for (auto &m : modules)
 				for (auto& mm : m.second)
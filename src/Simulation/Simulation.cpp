@@ -1,5 +1,9 @@
 #include <sstream>
+#include <iostream>
+
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Display/rang_format/rang_format.h"
+#include "Tools/Perf/Counters/Perf_counters.hpp"
 
 #include "Simulation.hpp"
 
@@ -18,11 +22,27 @@ bool Simulation
 	return this->simu_error;
 }
 
+double Simulation
+::calibrate(const std::chrono::milliseconds)
+{
+	// the calibration is not supported: nothing is run whatever the duration
+	return 0.;
+}
+
 void Simulation
 ::build_communication_chain()
 {
 	_build_communication_chain();
 
+	auto hw_counters = params.statistics_hw;
+	if (hw_counters && !tools::Perf_counters::is_available())
+	{
+		std::clog << rang::tag::warning << "The hardware counters are unavailable (the perf events may be restricted "
+		                                   "by '/proc/sys/kernel/perf_event_paranoid'), only the time statistics "
+		                                   "will be displayed." << std::endl;
+		hw_counters = false;
+	}
+
 	for (auto &m : modules)
 		for (auto& mm : m.second)
 			if (mm != nullptr)
@@ -33,6 +53,12 @@ void Simulation
 					if (params.statistics)
 						t->set_stats(true);
 
+					if (hw_counters)
+						t->set_hw_counters(true);
+
+					if (!params.trace_path.empty())
+						t->set_trace(true);
+
 					// enable the debug mode in the modules
 					if (params.debug)
 					{
@@ -46,7 +72,7 @@ void Simulation
 							t->set_debug_frame_max((uint32_t)params.debug_frame_max);
 					}
 
-					if (!t->is_stats() && !t->is_debug())
+					if (!t->is_stats() && !t->is_debug() && !t->is_trace())
 						t->set_fast(true);
 				}
 }
@@ -8,6 +8,7 @@
 #ifndef SIMULATION_HPP_
 #define SIMULATION_HPP_
 
+#include <chrono>
 #include <memory>
 #include "Module/Module.hpp"
 #include "Tools/Display/Terminal/Terminal.hpp"
@@ -51,6 +52,17 @@ public:
 	 */
 	virtual void launch() = 0;
 
+	/*!
+	 *  \brief Builds and runs the communication chain during a short time on the first noise point (nothing is
+	 *         displayed).
+	 *
+	 *  \param duration: the time spent in the communication chain (unused if the simulation does not support the
+	 *                   calibration).
+	 *
+	 *  \return the measured throughput per thread (in Mb/s), 0 if the simulation does not support the calibration.
+	 */
+	virtual double calibrate(const std::chrono::milliseconds duration);
+
 protected:
 	void build_communication_chain();
 	virtual void _build_communication_chain() = 0;
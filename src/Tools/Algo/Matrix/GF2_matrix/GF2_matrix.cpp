@@ -0,0 +1,375 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Threads/Thread_team.hpp"
+
+#include "GF2_matrix.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+using Word_t = GF2_matrix::Word_t;
+
+/*
+ * Call 'f(first, last)' on the rows [first_row;last_row[, split between the threads of the team
+ */
+template <class F>
+void split_rows(Thread_team *team, const size_t first_row, const size_t last_row, F f)
+{
+	const auto n_rows = last_row - first_row;
+	if (team == nullptr || team->get_n_threads() == 1 || n_rows < 2 * team->get_n_threads())
+	{
+		f(first_row, last_row);
+		return;
+	}
+
+	const auto ranges = Thread_team::split(n_rows, team->get_n_threads(), [](const size_t i) { return i; });
+	team->run([&](const size_t tid)
+	{
+		f(first_row + ranges[tid], first_row + ranges[tid +1]);
+	});
+}
+
+/*
+ * Tables of the method of the four Russians: the entry 'e' of the table 't' is the sum of the rows 8t+b of 'src' for
+ * which the bit 'b' of 'e' is set (on the words [first_word;n_words[ of the rows)
+ */
+class M4R_tables
+{
+private:
+	static constexpr size_t k = 8;
+
+	const size_t        width;
+	std::vector<Word_t> tables;
+
+public:
+	M4R_tables(const Word_t *src, const size_t n_src, const size_t n_words, const size_t first_word)
+	: width(n_words - first_word), tables(((n_src + k -1) / k) * ((size_t)1 << k) * width, 0)
+	{
+		for (size_t t = 0; t * k < n_src; t++)
+		{
+			const auto n_entries = (size_t)1 << std::min(k, n_src - t * k);
+			auto table = this->tables.data() + (t << k) * width;
+			for (size_t e = 1; e < n_entries; e++)
+			{
+				// entry 'e' = entry 'e' without its lowest bit + the row of its lowest bit
+				size_t b = 0;
+				while (!((e >> b) & 1)) b++;
+
+				const auto prev = table + (e & (e -1)) * width;
+				const auto row  = src + (t * k + b) * n_words + first_word;
+				      auto cur  = table + e * width;
+				for (size_t w = 0; w < width; w++)
+					cur[w] = prev[w] ^ row[w];
+			}
+		}
+	}
+
+	/*
+	 * Add the combination 'key' of the rows of 'src' to 'dst' ('dst' points to the word 'first_word' of the row)
+	 */
+	inline void add(Word_t key, Word_t *dst) const
+	{
+		for (size_t t = 0; key; t++, key >>= k)
+		{
+			const auto e = (size_t)(key & (((Word_t)1 << k) -1));
+			if (e)
+			{
+				const auto entry = this->tables.data() + ((t << k) + e) * width;
+				for (size_t w = 0; w < width; w++)
+					dst[w] ^= entry[w];
+			}
+		}
+	}
+};
+
+/*
+ * In-place transposition of a 64x64 block of bits (the bit 'c' of 'a[r]' becomes the bit 'r' of 'a[c]')
+ */
+void transpose_block(Word_t a[64])
+{
+	Word_t m = 0x00000000FFFFFFFFull;
+	for (size_t j = 32; j != 0; j >>= 1, m ^= m << j)
+		for (size_t k = 0; k < 64; k = ((k | j) +1) & ~j)
+		{
+			const auto t = ((a[k] >> j) ^ a[k | j]) & m;
+			a[k    ] ^= t << j;
+			a[k | j] ^= t;
+		}
+}
+
+inline Word_t low_mask(const size_t n_bits)
+{
+	return n_bits >= GF2_matrix::word_size ? ~(Word_t)0 : (((Word_t)1 << n_bits) -1);
+}
+}
+
+GF2_matrix
+::GF2_matrix(const size_t n_rows, const size_t n_cols)
+: n_rows(n_rows),
+  n_cols(n_cols),
+  n_words((n_cols + word_size -1) / word_size),
+  data(n_rows * n_words, 0)
+{
+}
+
+GF2_matrix
+::GF2_matrix(const Sparse_matrix &S)
+: GF2_matrix(S.get_n_rows(), S.get_n_cols())
+{
+	for (size_t r = 0; r < this->n_rows; r++)
+		for (auto c : S.get_cols_from_row(r))
+			this->set(r, c);
+}
+
+template <typename T>
+GF2_matrix
+::GF2_matrix(const Full_matrix<T> &F)
+: GF2_matrix(F.get_n_rows(), F.get_n_cols())
+{
+	for (size_t r = 0; r < this->n_rows; r++)
+		for (size_t c = 0; c < this->n_cols; c++)
+			if (F[r][c])
+				this->set(r, c);
+}
+
+void GF2_matrix
+::add_row(const size_t src_row, const size_t dst_row, const size_t first_col, const size_t last_col)
+{
+	if (first_col >= last_col)
+		return;
+
+	const auto first_word = first_col / word_size;
+	const auto last_word  = (last_col -1) / word_size;
+	const auto src = (*this)[src_row];
+	      auto dst = (*this)[dst_row];
+
+	for (auto w = first_word; w <= last_word; w++)
+	{
+		auto m = ~(Word_t)0;
+		if (w == first_word) m &= ~low_mask(first_col % word_size);
+		if (w == last_word ) m &= low_mask((last_col -1) % word_size +1);
+		dst[w] ^= src[w] & m;
+	}
+}
+
+void GF2_matrix
+::swap_rows(const size_t row_index1, const size_t row_index2)
+{
+	if (row_index1 != row_index2)
+		std::swap_ranges((*this)[row_index1], (*this)[row_index1] + this->n_words, (*this)[row_index2]);
+}
+
+void GF2_matrix
+::swap_cols(const size_t col_index1, const size_t col_index2)
+{
+	for (size_t r = 0; r < this->n_rows; r++)
+		if (this->at(r, col_index1) != this->at(r, col_index2))
+		{
+			this->flip(r, col_index1);
+			this->flip(r, col_index2);
+		}
+}
+
+void GF2_matrix
+::erase_row(const size_t row_index)
+{
+	if (row_index >= this->n_rows)
+	{
+		std::stringstream message;
+		message << "'row_index' has to be smaller than 'n_rows' ('row_index' = " << row_index
+		        << ", 'n_rows' = " << this->n_rows << ").";
+		throw out_of_range(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto first = this->data.begin() + row_index * this->n_words;
+	this->data.erase(first, first + this->n_words);
+	this->n_rows--;
+}
+
+GF2_matrix::Word_t GF2_matrix
+::get_bits(const size_t row_index, const size_t first_col) const
+{
+	const auto row = (*this)[row_index];
+	const auto w   = first_col / word_size;
+	const auto s   = first_col % word_size;
+
+	if (w >= this->n_words)
+		return 0;
+
+	auto bits = row[w] >> s;
+	if (s && w +1 < this->n_words)
+		bits |= row[w +1] << (word_size - s);
+
+	return bits;
+}
+
+GF2_matrix GF2_matrix
+::extract(const size_t first_row, const size_t n_rows, const size_t first_col, const size_t n_cols) const
+{
+	if (first_row + n_rows > this->n_rows || first_col + n_cols > this->n_cols)
+	{
+		std::stringstream message;
+		message << "The sub-matrix has to be inside the matrix ('first_row' = " << first_row << ", 'n_rows' = "
+		        << n_rows << ", 'first_col' = " << first_col << ", 'n_cols' = " << n_cols << ", 'this->n_rows' = "
+		        << this->n_rows << ", 'this->n_cols' = " << this->n_cols << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	GF2_matrix sub(n_rows, n_cols);
+	for (size_t r = 0; r < n_rows; r++)
+		for (size_t w = 0; w < sub.n_words; w++)
+			sub[r][w] = this->get_bits(first_row + r, first_col + w * word_size)
+			          & low_mask(n_cols - w * word_size);
+
+	return sub;
+}
+
+GF2_matrix GF2_matrix
+::transpose() const
+{
+	GF2_matrix trans(this->n_cols, this->n_rows);
+
+	Word_t block[word_size];
+	for (size_t br = 0; br < trans.n_words; br++)
+		for (size_t bc = 0; bc < this->n_words; bc++)
+		{
+			for (size_t i = 0; i < word_size; i++)
+			{
+				const auto r = br * word_size + i;
+				block[i] = r < this->n_rows ? (*this)[r][bc] : 0;
+			}
+
+			transpose_block(block);
+
+			for (size_t i = 0; i < word_size; i++)
+			{
+				const auto c = bc * word_size + i;
+				if (c < this->n_cols)
+					trans[c][br] = block[i];
+			}
+		}
+
+	return trans;
+}
+
+bool GF2_matrix
+::all_zeros() const
+{
+	return std::all_of(this->data.begin(), this->data.end(), [](const Word_t w) { return w == 0; });
+}
+
+Sparse_matrix GF2_matrix
+::to_sparse() const
+{
+	std::vector<std::vector<Sparse_matrix::Idx_t>> row_to_cols(this->n_rows);
+
+	for (size_t r = 0; r < this->n_rows; r++)
+		for (size_t w = 0; w < this->n_words; w++)
+			for (auto bits = (*this)[r][w]; bits; bits &= bits -1)
+			{
+				size_t b = 0;
+				while (!((bits >> b) & 1)) b++;
+				row_to_cols[r].push_back((Sparse_matrix::Idx_t)(w * word_size + b));
+			}
+
+	return Sparse_matrix(this->n_cols, row_to_cols);
+}
+
+template <typename T>
+Full_matrix<T> GF2_matrix
+::to_full() const
+{
+	Full_matrix<T> F((unsigned)this->n_rows, (unsigned)this->n_cols);
+
+	for (size_t r = 0; r < this->n_rows; r++)
+		for (size_t c = 0; c < this->n_cols; c++)
+			F[r][c] = this->at(r, c) ? 1 : 0;
+
+	F.parse_connections();
+
+	return F;
+}
+
+GF2_matrix GF2_matrix
+::identity(const size_t n)
+{
+	GF2_matrix I(n, n);
+	for (size_t i = 0; i < n; i++)
+		I.set(i, i);
+
+	return I;
+}
+
+GF2_matrix GF2_matrix
+::mult(const GF2_matrix &A, const GF2_matrix &B, Thread_team *team)
+{
+	if (A.n_cols != B.n_rows)
+	{
+		std::stringstream message;
+		message << "'A.get_n_cols()' is different to 'B.get_n_rows()' ('A.get_n_cols()' = " << A.n_cols
+		        << ", 'B.get_n_rows()' = " << B.n_rows << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	GF2_matrix C(A.n_rows, B.n_cols);
+
+	// the rows [64w;64w+64[ of B are combined by the word 'w' of the rows of A
+	for (size_t w = 0; w < A.n_words; w++)
+	{
+		const auto n_src = std::min(word_size, B.n_rows - w * word_size);
+		const M4R_tables tables(B[w * word_size], n_src, B.n_words, 0);
+
+		split_rows(team, 0, A.n_rows, [&](const size_t first, const size_t last)
+		{
+			for (auto r = first; r < last; r++)
+				tables.add(A[r][w] & low_mask(n_src), C[r]);
+		});
+	}
+
+	return C;
+}
+
+void GF2_matrix
+::add_combinations(const GF2_matrix &pivots, const size_t w, const size_t first_row, const size_t last_row,
+                   Thread_team *team)
+{
+	if (pivots.n_words != this->n_words || pivots.n_rows > word_size)
+	{
+		std::stringstream message;
+		message << "'pivots' has to have the same number of columns than this matrix and at most " << word_size
+		        << " rows ('pivots.get_n_cols()' = " << pivots.n_cols << ", 'pivots.get_n_rows()' = "
+		        << pivots.n_rows << ", 'this->n_cols' = " << this->n_cols << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (pivots.n_rows == 0 || first_row >= last_row)
+		return;
+
+	const M4R_tables tables(pivots[0], pivots.n_rows, this->n_words, w);
+	const auto mask = low_mask(pivots.n_rows);
+
+	split_rows(team, first_row, last_row, [&](const size_t first, const size_t last)
+	{
+		for (auto r = first; r < last; r++)
+		{
+			auto row = (*this)[r];
+			tables.add(row[w] & mask, row + w);
+		}
+	});
+}
+
+// ==================================================================================== explicit template instantiation
+template aff3ct::tools::GF2_matrix::GF2_matrix(const Full_matrix<int8_t >&);
+template aff3ct::tools::GF2_matrix::GF2_matrix(const Full_matrix<int16_t>&);
+template aff3ct::tools::GF2_matrix::GF2_matrix(const Full_matrix<int32_t>&);
+template aff3ct::tools::GF2_matrix::GF2_matrix(const Full_matrix<int64_t>&);
+
+template aff3ct::tools::Full_matrix<int8_t > aff3ct::tools::GF2_matrix::to_full<int8_t >() const;
+template aff3ct::tools::Full_matrix<int16_t> aff3ct::tools::GF2_matrix::to_full<int16_t>() const;
+template aff3ct::tools::Full_matrix<int32_t> aff3ct::tools::GF2_matrix::to_full<int32_t>() const;
+template aff3ct::tools::Full_matrix<int64_t> aff3ct::tools::GF2_matrix::to_full<int64_t>() const;
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,161 @@
+#ifndef GF2_MATRIX_HPP_
+#define GF2_MATRIX_HPP_
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "../Sparse_matrix/Sparse_matrix.hpp"
+#include "../Full_matrix/Full_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+class Thread_team;
+
+/*
+ * Dense binary matrix (over GF(2)) with the columns of each row packed in 64-bit words: the column 'c' is the bit
+ * 'c % 64' of the word 'c / 64' of the row, and the rows are stored one after the other in a single array.
+ * A row addition (xor) or a row swap processes 64 columns at once.
+ *
+ * The product and the elimination use the method of the four Russians (M4RM/M4RI): all the combinations of 8 rows
+ * are tabulated once (one row addition per entry), then a row is updated with one table lookup per group of 8 pivots
+ * instead of one row addition per pivot.
+ * The methods that take a 'team' split the updated rows between its threads (the team can be nullptr).
+ */
+class GF2_matrix
+{
+public:
+	using Word_t = uint64_t;
+	static constexpr size_t word_size = 64;
+
+	explicit GF2_matrix(const size_t n_rows = 0, const size_t n_cols = 0);
+
+	explicit GF2_matrix(const Sparse_matrix &S);
+
+	template <typename T>
+	explicit GF2_matrix(const Full_matrix<T> &F);
+
+	virtual ~GF2_matrix() = default;
+
+	inline size_t get_n_rows() const
+	{
+		return this->n_rows;
+	}
+
+	inline size_t get_n_cols() const
+	{
+		return this->n_cols;
+	}
+
+	/*
+	 * Number of words of a row
+	 */
+	inline size_t get_n_words() const
+	{
+		return this->n_words;
+	}
+
+	inline bool at(const size_t row_index, const size_t col_index) const
+	{
+		return ((*this)[row_index][col_index / word_size] >> (col_index % word_size)) & (Word_t)1;
+	}
+
+	inline void set(const size_t row_index, const size_t col_index, const bool val = true)
+	{
+		const auto m = (Word_t)1 << (col_index % word_size);
+		auto &w = (*this)[row_index][col_index / word_size];
+		w = val ? (w | m) : (w & ~m);
+	}
+
+	inline void flip(const size_t row_index, const size_t col_index)
+	{
+		(*this)[row_index][col_index / word_size] ^= (Word_t)1 << (col_index % word_size);
+	}
+
+	inline Word_t* operator[](const size_t row_index)
+	{
+		return this->data.data() + row_index * this->n_words;
+	}
+
+	inline const Word_t* operator[](const size_t row_index) const
+	{
+		return this->data.data() + row_index * this->n_words;
+	}
+
+	/*
+	 * Add the row 'src_row' to the row 'dst_row', only from the word 'first_word' (the columns of the previous words
+	 * are not modified)
+	 */
+	inline void add_row(const size_t src_row, const size_t dst_row, const size_t first_word = 0)
+	{
+		const auto src = (*this)[src_row];
+		      auto dst = (*this)[dst_row];
+		for (auto w = first_word; w < this->n_words; w++)
+			dst[w] ^= src[w];
+	}
+
+	/*
+	 * Add the columns [first_col;last_col[ of the row 'src_row' to the row 'dst_row'
+	 */
+	void add_row(const size_t src_row, const size_t dst_row, const size_t first_col, const size_t last_col);
+
+	void swap_rows(const size_t row_index1, const size_t row_index2);
+
+	void swap_cols(const size_t col_index1, const size_t col_index2);
+
+	/*
+	 * Erase the row 'row_index', the next rows are moved up
+	 */
+	void erase_row(const size_t row_index);
+
+	/*
+	 * Return the sub-matrix of 'n_rows' rows and 'n_cols' columns from the position ('first_row';'first_col')
+	 */
+	GF2_matrix extract(const size_t first_row, const size_t n_rows, const size_t first_col, const size_t n_cols) const;
+
+	/*
+	 * Transposition by blocks of 64x64 bits
+	 */
+	GF2_matrix transpose() const;
+
+	bool all_zeros() const;
+
+	Sparse_matrix to_sparse() const;
+
+	template <typename T>
+	Full_matrix<T> to_full() const;
+
+	static GF2_matrix identity(const size_t n);
+
+	/*
+	 * Return the product A.B (M4RM)
+	 */
+	static GF2_matrix mult(const GF2_matrix &A, const GF2_matrix &B, Thread_team *team = nullptr);
+
+	/*
+	 * Add to each row 'r' of [first_row;last_row[ the combination of the rows of 'pivots' given by the word 'w' of
+	 * the row 'r': the row 'b' of 'pivots' is added if the bit 'b' of this word is set (M4RI). Only the words
+	 * [w;n_words[ are updated, the rows of 'pivots' have to be null before the word 'w'.
+	 * When the row 'b' of 'pivots' is the pivot of the column 64w+b and has no 1 in the columns of the other pivots,
+	 * this eliminates the columns of the word 'w' from the rows.
+	 */
+	void add_combinations(const GF2_matrix &pivots, const size_t w, const size_t first_row, const size_t last_row,
+	                      Thread_team *team = nullptr);
+
+private:
+	size_t n_rows;
+	size_t n_cols;
+	size_t n_words;
+	std::vector<Word_t> data;
+
+	/*
+	 * Read the 64 columns from the column 'first_col' of the row 'row_index' (the columns after the last one are 0)
+	 */
+	Word_t get_bits(const size_t row_index, const size_t first_col) const;
+};
+}
+}
+
+#endif /* GF2_MATRIX_HPP_ */
@@ -0,0 +1,67 @@
+#include <limits>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Compact_sparse_matrix.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+template <typename I>
+void flatten(const std::vector<std::vector<Sparse_matrix::Idx_t>> &links, std::vector<uint32_t> &off,
+             std::vector<I> &idx)
+{
+	off.resize(links.size() +1);
+	off[0] = 0;
+	for (size_t i = 0; i < links.size(); i++)
+		off[i +1] = off[i] + (uint32_t)links[i].size();
+
+	idx.resize(off.back());
+	for (size_t i = 0; i < links.size(); i++)
+		for (size_t j = 0; j < links[i].size(); j++)
+			idx[off[i] + j] = (I)links[i][j];
+}
+}
+
+template <typename I>
+Compact_sparse_matrix<I>
+::Compact_sparse_matrix(const Sparse_matrix &H)
+: rows_max_degree(H.get_rows_max_degree()),
+  cols_max_degree(H.get_cols_max_degree())
+{
+	if (!Compact_sparse_matrix<I>::is_compatible(H))
+	{
+		std::stringstream message;
+		message << "The indexes of 'H' can't be represented with " << sizeof(I) * 8 << "-bit integers ('H.get_n_rows()' = "
+		        << H.get_n_rows() << ", 'H.get_n_cols()' = " << H.get_n_cols() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (H.get_n_connections() > (size_t)std::numeric_limits<uint32_t>::max())
+	{
+		std::stringstream message;
+		message << "'H.get_n_connections()' has to be smaller or equal to 'std::numeric_limits<uint32_t>::max()' "
+		        << "('H.get_n_connections()' = " << H.get_n_connections() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	flatten(H.get_row_to_cols(), this->row_off, this->row_idx);
+	flatten(H.get_col_to_rows(), this->col_off, this->col_idx);
+}
+
+template <typename I>
+bool Compact_sparse_matrix<I>
+::is_compatible(const Sparse_matrix &H)
+{
+	const auto max_idx = (size_t)std::numeric_limits<I>::max();
+	return (H.get_n_rows() == 0 || H.get_n_rows() -1 <= max_idx) &&
+	       (H.get_n_cols() == 0 || H.get_n_cols() -1 <= max_idx);
+}
+
+// ==================================================================================== explicit template instantiation
+template class aff3ct::tools::Compact_sparse_matrix<uint16_t>;
+template class aff3ct::tools::Compact_sparse_matrix<uint32_t>;
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,136 @@
+#ifndef COMPACT_SPARSE_MATRIX_HPP_
+#define COMPACT_SPARSE_MATRIX_HPP_
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Read-only copy of a Sparse_matrix in the compressed sparse row (CSR) and compressed sparse column (CSC) formats:
+ * the connections of all the rows (resp. columns) are stored one after the other in a single index array, an offset
+ * array gives the position of the first connection of each row (resp. column).
+ * There is no indirection per row or per column, the hot loops of the decoders walk through contiguous memory.
+ *
+ * \param I is the type of the indexes, it must be uint16_t or uint32_t (uint16_t is enough when the number of rows
+ *          and the number of columns are smaller than 65536)
+ */
+template <typename I = Sparse_matrix::Idx_t>
+class Compact_sparse_matrix
+{
+public:
+	using Idx_t = I;
+
+	/*
+	 * The connections of one row or of one column
+	 */
+	class Range
+	{
+	private:
+		const I *first;
+		const I *last;
+
+	public:
+		Range(const I *first, const I *last) : first(first), last(last) {}
+
+		inline const I* begin() const { return this->first;               }
+		inline const I* end  () const { return this->last;                }
+		inline size_t   size () const { return (size_t)(last - first);    }
+		inline I operator[](const size_t i) const { return this->first[i]; }
+	};
+
+	explicit Compact_sparse_matrix(const Sparse_matrix &H);
+
+	virtual ~Compact_sparse_matrix() = default;
+
+	inline size_t get_n_rows() const
+	{
+		return this->row_off.size() -1;
+	}
+
+	inline size_t get_n_cols() const
+	{
+		return this->col_off.size() -1;
+	}
+
+	inline size_t get_n_connections() const
+	{
+		return this->row_idx.size();
+	}
+
+	inline size_t get_rows_max_degree() const
+	{
+		return this->rows_max_degree;
+	}
+
+	inline size_t get_cols_max_degree() const
+	{
+		return this->cols_max_degree;
+	}
+
+	inline size_t get_row_degree(const size_t row_index) const
+	{
+		return (size_t)(this->row_off[row_index +1] - this->row_off[row_index]);
+	}
+
+	inline size_t get_col_degree(const size_t col_index) const
+	{
+		return (size_t)(this->col_off[col_index +1] - this->col_off[col_index]);
+	}
+
+	/*
+	 * Position of the first connection of the row in the row-major order of the connections (CSR)
+	 */
+	inline size_t get_row_offset(const size_t row_index) const
+	{
+		return (size_t)this->row_off[row_index];
+	}
+
+	/*
+	 * Position of the first connection of the column in the column-major order of the connections (CSC)
+	 */
+	inline size_t get_col_offset(const size_t col_index) const
+	{
+		return (size_t)this->col_off[col_index];
+	}
+
+	inline Range get_cols_from_row(const size_t row_index) const
+	{
+		return Range(this->row_idx.data() + this->row_off[row_index],
+		             this->row_idx.data() + this->row_off[row_index +1]);
+	}
+
+	inline Range get_rows_from_col(const size_t col_index) const
+	{
+		return Range(this->col_idx.data() + this->col_off[col_index],
+		             this->col_idx.data() + this->col_off[col_index +1]);
+	}
+
+	inline Range operator[](const size_t col_index) const
+	{
+		return this->get_rows_from_col(col_index);
+	}
+
+	/*
+	 * Return true if the indexes of the matrix H can be stored in the type I
+	 */
+	static bool is_compatible(const Sparse_matrix &H);
+
+private:
+	std::vector<uint32_t> row_off; // n_rows +1 offsets in 'row_idx'
+	std::vector<I>        row_idx; // the columns connected to each row
+	std::vector<uint32_t> col_off; // n_cols +1 offsets in 'col_idx'
+	std::vector<I>        col_idx; // the rows connected to each column
+
+	size_t rows_max_degree;
+	size_t cols_max_degree;
+};
+}
+}
+
+#endif /* COMPACT_SPARSE_MATRIX_HPP_ */
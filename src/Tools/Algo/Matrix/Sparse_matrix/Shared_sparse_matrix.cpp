@@ -0,0 +1,91 @@
+#include <map>
+#include <mutex>
+
+#include "Shared_sparse_matrix.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+struct Entry
+{
+	std::weak_ptr<const Sparse_matrix>               matrix;
+	std::shared_ptr<const Compact_sparse_matrix<>>   compact; // built on the first request
+};
+
+// an entry is removed by the deleter of its matrix, so an address in the registry is always the one of a live matrix
+std::mutex& registry_mutex()
+{
+	static std::mutex mtx;
+	return mtx;
+}
+
+std::map<const Sparse_matrix*, Entry>& registry()
+{
+	static std::map<const Sparse_matrix*, Entry> entries;
+	return entries;
+}
+}
+
+std::shared_ptr<const Sparse_matrix> Shared_sparse_matrix
+::make(Sparse_matrix &&matrix)
+{
+	// construct the statics before the first matrix, so they are destroyed after the last one
+	auto &mtx     = registry_mutex();
+	auto &entries = registry();
+
+	const auto ptr = new Sparse_matrix(std::move(matrix));
+	std::shared_ptr<const Sparse_matrix> shared(ptr, [](const Sparse_matrix *m)
+	{
+		std::shared_ptr<const Compact_sparse_matrix<>> compact; // freed outside of the lock
+		{
+			std::lock_guard<std::mutex> lock(registry_mutex());
+			auto it = registry().find(m);
+			if (it != registry().end())
+			{
+				compact = std::move(it->second.compact);
+				registry().erase(it);
+			}
+		}
+		delete m;
+	});
+
+	std::lock_guard<std::mutex> lock(mtx);
+	entries[ptr].matrix = shared;
+
+	return shared;
+}
+
+std::shared_ptr<const Sparse_matrix> Shared_sparse_matrix
+::vertical(const Sparse_matrix &matrix)
+{
+	// a square matrix is not turned
+	if (matrix.get_n_rows() >= matrix.get_n_cols())
+	{
+		std::lock_guard<std::mutex> lock(registry_mutex());
+		auto it = registry().find(&matrix);
+		if (it != registry().end())
+			if (auto shared = it->second.matrix.lock())
+				return shared;
+	}
+
+	return std::make_shared<const Sparse_matrix>(matrix.turn(Sparse_matrix::Way::VERTICAL));
+}
+
+std::shared_ptr<const Compact_sparse_matrix<>> Shared_sparse_matrix
+::compact(const Sparse_matrix &matrix)
+{
+	{
+		std::lock_guard<std::mutex> lock(registry_mutex());
+		auto it = registry().find(&matrix);
+		if (it != registry().end())
+		{
+			if (it->second.compact == nullptr)
+				it->second.compact = std::make_shared<const Compact_sparse_matrix<>>(matrix);
+			return it->second.compact;
+		}
+	}
+
+	return std::make_shared<const Compact_sparse_matrix<>>(matrix);
+}
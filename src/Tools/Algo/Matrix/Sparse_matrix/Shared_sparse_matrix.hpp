@@ -0,0 +1,41 @@
+#ifndef SHARED_SPARSE_MATRIX_HPP_
+#define SHARED_SPARSE_MATRIX_HPP_
+
+#include <memory>
+
+#include "Sparse_matrix.hpp"
+#include "Compact_sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Registry of the read-only sparse matrices shared between modules (ex: the H matrix of an LDPC code, read once and
+ * used by the codecs and the decoders of all the threads).
+ * A matrix built with 'make' stays registered until its last owner frees it: a module that is only given a reference
+ * to it takes a share of it instead of a copy, and its compact version is built once for all the modules.
+ */
+struct Shared_sparse_matrix
+{
+public:
+	/*
+	 * register the matrix, it can't be modified anymore
+	 */
+	static std::shared_ptr<const Sparse_matrix> make(Sparse_matrix &&matrix);
+
+	/*
+	 * return the registered matrix if 'matrix' has been built with 'make' and is already in vertical way, else a copy
+	 * of 'matrix' turned in vertical way
+	 */
+	static std::shared_ptr<const Sparse_matrix> vertical(const Sparse_matrix &matrix);
+
+	/*
+	 * return the compact version of 'matrix', built only once if 'matrix' has been built with 'make'
+	 */
+	static std::shared_ptr<const Compact_sparse_matrix<>> compact(const Sparse_matrix &matrix);
+};
+}
+}
+
+#endif /* SHARED_SPARSE_MATRIX_HPP_ */
@@ -18,6 +18,23 @@ Sparse_matrix
 {
 }
 
+Sparse_matrix
+::Sparse_matrix(const size_t n_cols, const std::vector<std::vector<Idx_t>>& row_to_cols)
+: Matrix(row_to_cols.size(), n_cols),
+  row_to_cols(row_to_cols),
+  col_to_rows(n_cols)
+{
+	for (size_t r = 0; r < row_to_cols.size(); r++)
+		for (auto c : row_to_cols[r])
+		{
+			check_indexes(r, c);
+			this->col_to_rows[c].push_back((Idx_t)r);
+		}
+
+	if (this->get_n_rows() && this->get_n_cols())
+		this->parse_connections();
+}
+
 bool Sparse_matrix
 ::at(const size_t row_index, const size_t col_index) const
 {
@@ -19,6 +19,17 @@ public:
 
 	Sparse_matrix(const size_t n_rows = 0, const size_t n_cols = 1);
 
+	/*
+	 * Build the matrix from the columns connected to each row, without the search of the already existing connections
+	 * of 'add_connection' (a column must not appear twice in the same row)
+	 */
+	Sparse_matrix(const size_t n_cols, const std::vector<std::vector<Idx_t>>& row_to_cols);
+
+	Sparse_matrix(const Sparse_matrix&) = default;
+	Sparse_matrix(Sparse_matrix&&) = default;
+	Sparse_matrix& operator=(const Sparse_matrix&) = default;
+	Sparse_matrix& operator=(Sparse_matrix&&) = default;
+
 	virtual ~Sparse_matrix() = default;
 
 	inline const std::vector<Idx_t>& get_cols_from_row(const size_t row_index) const
@@ -0,0 +1,431 @@
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Shared_sparse_matrix.hpp"
+
+#include "BIN.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+const char     magic[8]   = {'A', 'F', 'F', '3', 'C', 'T', 'H', '\0'};
+const uint32_t byte_order = 0x01020304; // the file is read on a machine with the same endianness
+const uint32_t version    = 1;
+
+struct Header
+{
+	char     magic[8];
+	uint32_t byte_order;
+	uint32_t version;
+	uint32_t n_rows;
+	uint32_t n_cols;
+	uint64_t n_connections;
+	uint32_t Z;
+	uint32_t n_info_bits;
+	uint32_t n_pct;
+	uint32_t padding; // the arrays start on a 64-bit boundary
+};
+
+static_assert(sizeof(Header) == 48, "The header of the BIN format has to be 48 bytes long.");
+
+/*
+ * Read-only view on the content of a file: memory mapped on POSIX systems, else copied in a buffer.
+ * The data are aligned on 32-bit words.
+ */
+class Mapped_file
+{
+private:
+	size_t length;
+#if defined(__unix__) || defined(__APPLE__)
+	void *addr;
+#else
+	std::vector<uint32_t> buffer;
+#endif
+
+public:
+	explicit Mapped_file(const std::string &filename)
+	: length(0)
+#if defined(__unix__) || defined(__APPLE__)
+	, addr(nullptr)
+	{
+		const int fd = open(filename.c_str(), O_RDONLY);
+		if (fd == -1)
+		{
+			std::stringstream message;
+			message << "'filename' couldn't be opened ('filename' = " << filename << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		struct stat st;
+		if (fstat(fd, &st) == -1)
+		{
+			close(fd);
+
+			std::stringstream message;
+			message << "The size of 'filename' couldn't be read ('filename' = " << filename << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->length = (size_t)st.st_size;
+		if (this->length)
+		{
+			this->addr = mmap(nullptr, this->length, PROT_READ, MAP_SHARED, fd, 0);
+			if (this->addr == MAP_FAILED)
+			{
+				close(fd);
+
+				std::stringstream message;
+				message << "'filename' couldn't be mapped in memory ('filename' = " << filename << ").";
+				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+		}
+
+		// the mapping remains valid after closing the file descriptor
+		close(fd);
+	}
+
+	~Mapped_file()
+	{
+		if (this->addr != nullptr)
+			munmap(this->addr, this->length);
+	}
+
+	const char* data() const
+	{
+		return (const char*)this->addr;
+	}
+#else
+	{
+		std::ifstream file(filename, std::ios::binary);
+		if (!file.is_open())
+		{
+			std::stringstream message;
+			message << "'filename' couldn't be opened ('filename' = " << filename << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		this->length = content.size();
+		this->buffer.resize((this->length + sizeof(uint32_t) -1) / sizeof(uint32_t));
+		std::copy(content.begin(), content.end(), (char*)this->buffer.data());
+	}
+
+	const char* data() const
+	{
+		return (const char*)this->buffer.data();
+	}
+#endif
+
+	Mapped_file(const Mapped_file&) = delete;
+	Mapped_file& operator=(const Mapped_file&) = delete;
+
+	size_t size() const
+	{
+		return this->length;
+	}
+};
+
+void throw_invalid(const std::string &reason)
+{
+	std::stringstream message;
+	message << "The LDPC matrix file is not a valid BIN file (" << reason << ").";
+	throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+}
+
+Header read_header(const char* data, const size_t size)
+{
+	Header header;
+	if (size < sizeof(Header))
+		throw_invalid("the file is shorter than the header");
+
+	std::memcpy(&header, data, sizeof(Header));
+
+	if (std::memcmp(header.magic, magic, sizeof(magic)))
+		throw_invalid("wrong magic bytes");
+
+	if (header.byte_order != byte_order)
+		throw_invalid("the file has been written on a machine with another byte order");
+
+	if (header.version != version)
+	{
+		std::stringstream reason;
+		reason << "unsupported version " << header.version << ", expected " << version;
+		throw_invalid(reason.str());
+	}
+
+	return header;
+}
+
+/*
+ * Read the header and check that the size of the content matches it
+ */
+Header read_checked_header(const char* data, const size_t size)
+{
+	const auto header = read_header(data, size);
+
+	const uint64_t n_rows = header.n_rows;
+	const uint64_t n_cols = header.n_cols;
+	if (header.n_connections > n_rows * n_cols || header.n_connections > (uint64_t)size)
+		throw_invalid("more connections than elements in the matrix or bytes in the file");
+
+	const uint64_t expected_size = sizeof(Header)
+	                             + sizeof(uint32_t) * (n_rows + 1 + header.n_connections + header.n_info_bits)
+	                             + header.n_pct;
+	if ((uint64_t)size != expected_size)
+	{
+		std::stringstream reason;
+		reason << "the file size is " << size << " bytes instead of " << expected_size;
+		throw_invalid(reason.str());
+	}
+
+	return header;
+}
+
+/*
+ * Get the information bits positions and the puncturing pattern from the content of a file
+ */
+void read_positions(const char* data, const Header &header, std::vector<uint32_t>* info_bits_pos,
+                    std::vector<bool>* pct_pattern)
+{
+	const auto info = (const uint32_t*)(data + sizeof(Header)) + header.n_rows + 1 + header.n_connections;
+	const auto pct  = (const uint8_t*)(info + header.n_info_bits);
+
+	if (header.n_info_bits > header.n_rows)
+		throw_invalid("more information bits than variable nodes");
+
+	for (size_t i = 0; i < header.n_info_bits; i++)
+		if (info[i] >= header.n_rows)
+			throw_invalid("an information bit position is out of the codeword");
+
+	if (info_bits_pos != nullptr)
+		info_bits_pos->assign(info, info + header.n_info_bits);
+
+	if (pct_pattern != nullptr && header.n_pct)
+		pct_pattern->assign(pct, pct + header.n_pct);
+}
+
+/*
+ * Build the matrix from the content of a file, 'data' has to be aligned on 32-bit words
+ */
+Sparse_matrix parse(const char* data, const size_t size, std::vector<uint32_t>* info_bits_pos,
+                    std::vector<bool>* pct_pattern)
+{
+	const auto header = read_checked_header(data, size);
+
+	const uint64_t n_rows = header.n_rows;
+	const uint64_t n_cols = header.n_cols;
+
+	const auto offsets = (const uint32_t*)(data + sizeof(Header));
+	const auto indexes = offsets + n_rows + 1;
+
+	// validate the whole content before using it: the offsets are sorted and bounded by the number of connections,
+	// the indexes are in the matrix (the rows of the stored matrix are the variable nodes)
+	if (offsets[0] != 0 || offsets[n_rows] != header.n_connections)
+		throw_invalid("the rows offsets do not cover the connections");
+
+	for (size_t r = 0; r < n_rows; r++)
+		if (offsets[r +1] < offsets[r] || offsets[r +1] > header.n_connections)
+			throw_invalid("the rows offsets are not sorted");
+
+	for (size_t i = 0; i < header.n_connections; i++)
+		if (indexes[i] >= n_cols)
+			throw_invalid("a column index is out of the matrix");
+
+	read_positions(data, header, info_bits_pos, pct_pattern);
+
+	std::vector<std::vector<Sparse_matrix::Idx_t>> row_to_cols(n_rows);
+	for (size_t r = 0; r < n_rows; r++)
+		row_to_cols[r].assign(indexes + offsets[r], indexes + offsets[r +1]);
+
+	return Sparse_matrix(n_cols, row_to_cols);
+}
+
+template <typename T>
+void push(std::vector<char> &buffer, const T val)
+{
+	const auto bytes = (const char*)&val;
+	buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+}
+
+bool BIN
+::is_bin(std::istream &stream)
+{
+	const auto pos = stream.tellg();
+
+	char bytes[sizeof(magic)];
+	stream.read(bytes, sizeof(magic));
+	const bool found = stream.gcount() == (std::streamsize)sizeof(magic) && !std::memcmp(bytes, magic, sizeof(magic));
+
+	stream.clear();
+	stream.seekg(pos);
+
+	return found;
+}
+
+Sparse_matrix BIN
+::read(const std::string &filename, std::vector<uint32_t>* info_bits_pos, std::vector<bool>* pct_pattern)
+{
+	const Mapped_file file(filename);
+	return parse(file.data(), file.size(), info_bits_pos, pct_pattern);
+}
+
+std::shared_ptr<const Sparse_matrix> BIN
+::read_shared(const std::string &filename, std::vector<uint32_t>* info_bits_pos, std::vector<bool>* pct_pattern)
+{
+	// the matrices in memory, the lock makes the threads that ask for the same file at the same time wait for the
+	// first one to build it
+	static std::mutex mtx;
+	static std::map<std::string, std::weak_ptr<const Sparse_matrix>> matrices;
+
+	const Mapped_file file(filename);
+
+	std::lock_guard<std::mutex> lock(mtx);
+	auto &cached = matrices[filename];
+	if (auto matrix = cached.lock())
+	{
+		const auto header = read_checked_header(file.data(), file.size());
+
+		// the file has not been replaced by another matrix since it has been read
+		if (matrix->get_n_rows() == header.n_rows && matrix->get_n_cols() == header.n_cols &&
+		    matrix->get_n_connections() == header.n_connections)
+		{
+			read_positions(file.data(), header, info_bits_pos, pct_pattern);
+			return matrix;
+		}
+	}
+
+	auto matrix = Shared_sparse_matrix::make(parse(file.data(), file.size(), info_bits_pos, pct_pattern));
+	cached = matrix;
+	return matrix;
+}
+
+Sparse_matrix BIN
+::read(std::istream &stream, std::vector<uint32_t>* info_bits_pos, std::vector<bool>* pct_pattern)
+{
+	const std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+	// copy in 32-bit words to align the arrays
+	std::vector<uint32_t> buffer((content.size() + sizeof(uint32_t) -1) / sizeof(uint32_t));
+	std::copy(content.begin(), content.end(), (char*)buffer.data());
+
+	return parse((const char*)buffer.data(), content.size(), info_bits_pos, pct_pattern);
+}
+
+void BIN
+::write(const Sparse_matrix &matrix, const std::string &filename, const std::vector<uint32_t> &info_bits_pos,
+        const std::vector<bool> &pct_pattern, const int Z)
+{
+	Header header;
+	std::copy(magic, magic + sizeof(magic), header.magic);
+	header.byte_order    = byte_order;
+	header.version       = version;
+	header.n_rows        = (uint32_t)matrix.get_n_rows();
+	header.n_cols        = (uint32_t)matrix.get_n_cols();
+	header.n_connections = (uint64_t)matrix.get_n_connections();
+	header.Z             = (uint32_t)Z;
+	header.n_info_bits   = (uint32_t)info_bits_pos.size();
+	header.n_pct         = (uint32_t)pct_pattern.size();
+	header.padding       = 0;
+
+	if (header.n_connections > (uint64_t)UINT32_MAX)
+	{
+		std::stringstream message;
+		message << "'matrix.get_n_connections()' has to be smaller than 2^32 ('matrix.get_n_connections()' = "
+		        << matrix.get_n_connections() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<char> buffer((const char*)&header, (const char*)&header + sizeof(Header));
+
+	uint32_t offset = 0;
+	push(buffer, offset);
+	for (size_t r = 0; r < matrix.get_n_rows(); r++)
+	{
+		offset += (uint32_t)matrix.get_cols_from_row(r).size();
+		push(buffer, offset);
+	}
+	for (size_t r = 0; r < matrix.get_n_rows(); r++)
+		for (auto c : matrix.get_cols_from_row(r))
+			push(buffer, (uint32_t)c);
+	for (auto p : info_bits_pos)
+		push(buffer, (uint32_t)p);
+	for (auto b : pct_pattern)
+		push(buffer, (uint8_t)b);
+
+	// write a temporary file then rename it: a process that maps 'filename' never sees a partial file
+	const auto salt = std::hash<std::thread::id>()(std::this_thread::get_id())
+	                ^ (size_t)std::chrono::steady_clock::now().time_since_epoch().count();
+	const auto tmp_filename = filename + ".tmp" + std::to_string(salt);
+
+	{
+		std::ofstream file(tmp_filename, std::ios::binary);
+		if (!file.is_open())
+		{
+			std::stringstream message;
+			message << "'tmp_filename' couldn't be opened ('tmp_filename' = " << tmp_filename << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		file.write(buffer.data(), (std::streamsize)buffer.size());
+		if (!file.good())
+		{
+			file.close();
+			std::remove(tmp_filename.c_str());
+
+			std::stringstream message;
+			message << "'tmp_filename' couldn't be written ('tmp_filename' = " << tmp_filename << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	if (std::rename(tmp_filename.c_str(), filename.c_str()))
+	{
+		std::remove(tmp_filename.c_str());
+
+		std::stringstream message;
+		message << "'tmp_filename' couldn't be renamed in 'filename' ('tmp_filename' = " << tmp_filename
+		        << ", 'filename' = " << filename << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+void BIN
+::read_matrix_size(std::istream &stream, int& H, int& N)
+{
+	int Z;
+	BIN::read_matrix_size(stream, H, N, Z);
+}
+
+void BIN
+::read_matrix_size(std::istream &stream, int& H, int& N, int& Z)
+{
+	char bytes[sizeof(Header)];
+	stream.read(bytes, sizeof(Header));
+
+	const auto header = read_header(bytes, (size_t)stream.gcount());
+
+	// the rows of the stored matrix are the variable nodes, as in the AList format
+	H = (int)header.n_cols;
+	N = (int)header.n_rows;
+	Z = (int)header.Z;
+}
@@ -0,0 +1,64 @@
+#ifndef BIN_HPP_
+#define BIN_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <iostream>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Binary format of the LDPC matrices, made to be loaded without parsing:
+ * - a header: the magic bytes "AFF3CTH\0", the byte order mark, the format version, the numbers of rows and columns,
+ *   the number of connections, the lifting size (0 if the matrix is not QC), the number of information bits positions
+ *   and the length of the puncturing pattern (0 when they are not known),
+ * - the rows in CSR: the offset of each row in the columns indexes (n_rows + 1 values), then the columns indexes,
+ * - the information bits positions and the puncturing pattern (one byte per bit).
+ * The values are unsigned 32-bit integers (in the byte order of the machine that wrote the file).
+ *
+ * When read from a file name, the file is memory mapped (on POSIX systems): the processes of a node that load the
+ * same matrix share the pages of the file in the system cache instead of each reading and parsing a text file.
+ * With 'read_shared', the threads of a process that load the same file share a single read-only matrix.
+ */
+struct BIN
+{
+public:
+	/*
+	 * return true if the stream starts with the magic bytes of the format (the position of the stream is restored)
+	 */
+	static bool is_bin(std::istream &stream);
+
+	static Sparse_matrix read(const std::string &filename, std::vector<uint32_t>* info_bits_pos = nullptr,
+	                          std::vector<bool>* pct_pattern = nullptr);
+
+	/*
+	 * the matrix is built once per process and file, and shared until its last owner frees it (it is registered in
+	 * 'Shared_sparse_matrix' so the decoders do not copy it)
+	 */
+	static std::shared_ptr<const Sparse_matrix> read_shared(const std::string &filename,
+	                                                        std::vector<uint32_t>* info_bits_pos = nullptr,
+	                                                        std::vector<bool>* pct_pattern = nullptr);
+
+	static Sparse_matrix read(std::istream &stream, std::vector<uint32_t>* info_bits_pos = nullptr,
+	                          std::vector<bool>* pct_pattern = nullptr);
+
+	static void write(const Sparse_matrix &matrix, const std::string &filename,
+	                  const std::vector<uint32_t> &info_bits_pos = {}, const std::vector<bool> &pct_pattern = {},
+	                  const int Z = 0);
+
+	/*
+	 * get the matrix dimensions H and N and the lifting size Z (0 if unknown) from the header
+	 */
+	static void read_matrix_size(std::istream &stream, int& H, int& N);
+	static void read_matrix_size(std::istream &stream, int& H, int& N, int& Z);
+};
+}
+}
+
+#endif /* BIN_HPP_ */
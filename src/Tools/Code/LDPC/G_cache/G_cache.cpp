@@ -0,0 +1,260 @@
+#include <chrono>
+#include <thread>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "G_cache.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+const char     magic[8]   = {'A', 'F', 'F', '3', 'C', 'T', 'G', '\0'};
+const uint32_t byte_order = 0x01020304; // the file is read on a machine with the same endianness
+const uint32_t version    = 1;
+
+/*
+ * 64-bit FNV-1a hash
+ */
+class Hash
+{
+private:
+	uint64_t h = 0xcbf29ce484222325ull;
+
+public:
+	void add(const void *data, const size_t size)
+	{
+		const auto bytes = (const uint8_t*)data;
+		for (size_t i = 0; i < size; i++)
+		{
+			h ^= bytes[i];
+			h *= 0x100000001b3ull;
+		}
+	}
+
+	template <typename T>
+	void add(const T val)
+	{
+		this->add(&val, sizeof(T));
+	}
+
+	uint64_t get() const
+	{
+		return h;
+	}
+};
+
+template <typename T>
+void push(std::vector<char> &buffer, const T val)
+{
+	const auto bytes = (const char*)&val;
+	buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+/*
+ * Read the values one after the other, 'ok' becomes false if the end of the data is reached
+ */
+class Reader
+{
+private:
+	const std::vector<char> &buffer;
+	const size_t             end;
+	size_t                   pos;
+
+public:
+	bool ok;
+
+	Reader(const std::vector<char> &buffer, const size_t end) : buffer(buffer), end(end), pos(0), ok(true) {}
+
+	template <typename T>
+	T pop()
+	{
+		T val = 0;
+		if (this->ok && this->pos + sizeof(T) <= this->end)
+		{
+			std::memcpy(&val, this->buffer.data() + this->pos, sizeof(T));
+			this->pos += sizeof(T);
+		}
+		else
+			this->ok = false;
+
+		return val;
+	}
+
+	bool at_end() const
+	{
+		return this->ok && this->pos == this->end;
+	}
+};
+}
+
+uint64_t G_cache
+::get_key(const Sparse_matrix &H, const std::string &G_method)
+{
+	Hash hash;
+	hash.add(version);
+	hash.add(G_method.data(), G_method.size());
+	hash.add((uint64_t)H.get_n_rows());
+	hash.add((uint64_t)H.get_n_cols());
+
+	for (size_t r = 0; r < H.get_n_rows(); r++)
+	{
+		auto cols = H.get_cols_from_row(r);
+		std::sort(cols.begin(), cols.end());
+
+		hash.add((uint32_t)cols.size());
+		for (auto c : cols)
+			hash.add((uint32_t)c);
+	}
+
+	return hash.get();
+}
+
+std::string G_cache
+::get_path(const std::string &folder, const uint64_t key)
+{
+	std::stringstream path;
+	path << folder;
+	if (!folder.empty() && folder.back() != '/' && folder.back() != '\\')
+		path << "/";
+	path << "G_" << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+
+	return path.str();
+}
+
+bool G_cache
+::read(const std::string &filename, const uint64_t key, Sparse_matrix &G, std::vector<uint32_t> &info_bits_pos)
+{
+	std::ifstream file(filename, std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	const std::vector<char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if (buffer.size() < sizeof(magic) + sizeof(uint64_t) || std::memcmp(buffer.data(), magic, sizeof(magic)))
+		return false;
+
+	// the checksum is the last word of the file
+	const auto end = buffer.size() - sizeof(uint64_t);
+	Hash checksum;
+	checksum.add(buffer.data(), end);
+
+	Reader reader(buffer, buffer.size());
+	for (size_t i = 0; i < sizeof(magic); i++)
+		reader.pop<char>();
+
+	if (reader.pop<uint32_t>() != byte_order || reader.pop<uint32_t>() != version || reader.pop<uint64_t>() != key)
+		return false;
+
+	const auto n_rows        = (size_t)reader.pop<uint32_t>();
+	const auto n_cols        = (size_t)reader.pop<uint32_t>();
+	const auto n_connections = (size_t)reader.pop<uint64_t>();
+	if (!reader.ok || n_connections > n_rows * n_cols || n_connections * sizeof(uint32_t) > buffer.size())
+		return false;
+
+	std::vector<std::vector<Sparse_matrix::Idx_t>> row_to_cols(n_rows);
+	size_t n_read = 0;
+	for (size_t r = 0; r < n_rows && reader.ok; r++)
+	{
+		const auto degree = (size_t)reader.pop<uint32_t>();
+		if (degree > n_cols || n_read + degree > n_connections)
+			return false;
+
+		row_to_cols[r].resize(degree);
+		for (auto &c : row_to_cols[r])
+			if ((c = reader.pop<uint32_t>()) >= n_cols)
+				return false;
+		n_read += degree;
+	}
+
+	const auto n_info = (size_t)reader.pop<uint32_t>();
+	if (!reader.ok || n_read != n_connections || n_info > std::max(n_rows, n_cols))
+		return false;
+
+	std::vector<uint32_t> pos(n_info);
+	for (auto &p : pos)
+		if ((p = reader.pop<uint32_t>()) >= std::max(n_rows, n_cols))
+			return false;
+
+	if (reader.pop<uint64_t>() != checksum.get() || !reader.at_end())
+		return false;
+
+	G             = Sparse_matrix(n_cols, row_to_cols);
+	info_bits_pos = std::move(pos);
+
+	return true;
+}
+
+void G_cache
+::write(const std::string &filename, const uint64_t key, const Sparse_matrix &G,
+        const std::vector<uint32_t> &info_bits_pos)
+{
+	std::vector<char> buffer(magic, magic + sizeof(magic));
+	push(buffer, byte_order);
+	push(buffer, version);
+	push(buffer, key);
+	push(buffer, (uint32_t)G.get_n_rows());
+	push(buffer, (uint32_t)G.get_n_cols());
+	push(buffer, (uint64_t)G.get_n_connections());
+	for (size_t r = 0; r < G.get_n_rows(); r++)
+	{
+		push(buffer, (uint32_t)G.get_cols_from_row(r).size());
+		for (auto c : G.get_cols_from_row(r))
+			push(buffer, (uint32_t)c);
+	}
+	push(buffer, (uint32_t)info_bits_pos.size());
+	for (auto p : info_bits_pos)
+		push(buffer, (uint32_t)p);
+
+	Hash checksum;
+	checksum.add(buffer.data(), buffer.size());
+	push(buffer, checksum.get());
+
+	// a name of temporary file that is different for each thread and each run
+	const auto salt = std::hash<std::thread::id>()(std::this_thread::get_id())
+	                ^ (size_t)std::chrono::steady_clock::now().time_since_epoch().count();
+	const auto tmp_filename = filename + ".tmp" + std::to_string(salt);
+
+	{
+		std::ofstream file(tmp_filename, std::ios::binary);
+		if (!file.is_open())
+		{
+			std::stringstream message;
+			message << "'tmp_filename' could not be opened ('tmp_filename' = \"" << tmp_filename << "\").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		file.write(buffer.data(), (std::streamsize)buffer.size());
+		if (!file.good())
+		{
+			file.close();
+			std::remove(tmp_filename.c_str());
+
+			std::stringstream message;
+			message << "'tmp_filename' could not be written ('tmp_filename' = \"" << tmp_filename << "\").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	if (std::rename(tmp_filename.c_str(), filename.c_str()))
+	{
+		std::remove(tmp_filename.c_str());
+
+		// another run may have written the same file in the meantime
+		if (!std::ifstream(filename).good())
+		{
+			std::stringstream message;
+			message << "'tmp_filename' could not be renamed in 'filename' ('tmp_filename' = \"" << tmp_filename
+			        << "\", 'filename' = \"" << filename << "\").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+}
@@ -0,0 +1,52 @@
+#ifndef G_CACHE_HPP_
+#define G_CACHE_HPP_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Cache of the generator matrices G built from the parity matrices H: one binary file per (H, build method) couple in
+ * a cache folder, named from a hash of the content of H and of the method, so the runs on the same matrix skip the
+ * Gaussian elimination. A file stores G and the positions of the information bits, it is checked (format version,
+ * key, dimensions, checksum) before to be used.
+ */
+struct G_cache
+{
+public:
+	/*
+	 * Key of the G matrix built from H with the 'G_method' method (hash of the method and of the connections of H, the
+	 * order of the connections in a row does not matter)
+	 */
+	static uint64_t get_key(const Sparse_matrix &H, const std::string &G_method);
+
+	/*
+	 * Path of the file of the key 'key' in the cache folder 'folder'
+	 */
+	static std::string get_path(const std::string &folder, const uint64_t key);
+
+	/*
+	 * Read G and the information bits positions from a cache file.
+	 * \return false when the file does not exist or is not valid for this key (then G and info_bits_pos are not
+	 *         modified).
+	 */
+	static bool read(const std::string &filename, const uint64_t key, Sparse_matrix &G,
+	                 std::vector<uint32_t> &info_bits_pos);
+
+	/*
+	 * Write G and the information bits positions in a cache file. The data are written in a temporary file which is
+	 * renamed at the end, so a concurrent run never reads a partial file.
+	 */
+	static void write(const std::string &filename, const uint64_t key, const Sparse_matrix &G,
+	                  const std::vector<uint32_t> &info_bits_pos);
+};
+}
+}
+
+#endif /* G_CACHE_HPP_ */
@@ -1,11 +1,15 @@
 #include <functional>
 #include <sstream>
 #include <fstream>
+#include <memory>
 
 #include "Tools/Code/LDPC/AList/AList.hpp"
 #include "Tools/Code/LDPC/QC/QC.hpp"
+#include "Tools/Code/LDPC/BIN/BIN.hpp"
+#include "Tools/Code/LDPC/Standard/NR/NR_base_graph.hpp"
 #include "Tools/general_utils.h"
 #include "Tools/Math/matrix.h"
+#include "Tools/Threads/Thread_team.hpp"
 
 #include "Tools/Exception/exception.hpp"
 
@@ -33,6 +37,12 @@ LDPC_matrix_handler::Matrix_format LDPC_matrix_handler
 {
 	file.seekg(0);
 
+	if (tools::BIN::is_bin(file))
+		return Matrix_format::BIN;
+
+	if (tools::NR_base_graph::is_nr(file))
+		return Matrix_format::NR;
+
 	std::string line;
 	tools::getline(file, line);
 
@@ -45,7 +55,7 @@ LDPC_matrix_handler::Matrix_format LDPC_matrix_handler
 		return Matrix_format::ALIST;
 
 	std::stringstream message;
-	message << "The given LDPC matrix file does not represent a known matrix type (ALIST, QC).";
+	message << "The given LDPC matrix file does not represent a known matrix type (ALIST, QC, BIN, NR).";
 	throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 }
 
@@ -61,9 +71,30 @@ Sparse_matrix LDPC_matrix_handler
 		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	// the BIN files are memory mapped instead of being read through the stream
+	if (get_matrix_format(file) == Matrix_format::BIN)
+		return tools::BIN::read(filename, info_bits_pos, pct_pattern);
+
 	return read(file, info_bits_pos, pct_pattern);
 }
 
+std::shared_ptr<const Sparse_matrix> LDPC_matrix_handler
+::read_shared(const std::string& filename, Positions_vector* info_bits_pos, std::vector<bool>* pct_pattern)
+{
+	std::ifstream file(filename);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "'filename' couldn't be opened ('filename' = " << filename << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (get_matrix_format(file) == Matrix_format::BIN)
+		return tools::BIN::read_shared(filename, info_bits_pos, pct_pattern);
+
+	return Shared_sparse_matrix::make(read(file, info_bits_pos, pct_pattern));
+}
+
 Sparse_matrix LDPC_matrix_handler
 ::read(std::ifstream& file, Positions_vector* info_bits_pos, std::vector<bool>* pct_pattern)
 {
@@ -100,6 +131,18 @@ Sparse_matrix LDPC_matrix_handler
 				}
 			break;
 		}
+		case Matrix_format::BIN:
+		{
+			S = std::move(tools::BIN::read(file, info_bits_pos, pct_pattern));
+			break;
+		}
+		case Matrix_format::NR:
+		{
+			std::stringstream message;
+			message << "The matrix of a 5G NR base graph depends on the lifting size, it has to be built with "
+			        << "'NR_base_graph'.";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
 	}
 
 	return S;
@@ -138,9 +181,130 @@ void LDPC_matrix_handler
 			tools::AList::read_matrix_size(file, H, N);
 			break;
 		}
+		case Matrix_format::BIN:
+		{
+			tools::BIN::read_matrix_size(file, H, N);
+			break;
+		}
+		case Matrix_format::NR:
+		{
+			std::stringstream message;
+			message << "The matrix of a 5G NR base graph depends on the lifting size, it has to be built with "
+			        << "'NR_base_graph'.";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
 	}
 }
 
+int LDPC_matrix_handler
+::read_lifting_size(const std::string& filename)
+{
+	std::ifstream file(filename);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "'filename' couldn't be opened ('filename' = " << filename << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto format = get_matrix_format(file);
+
+	file.seekg(0);
+
+	int H, N, Z = 0;
+	if (format == Matrix_format::QC)
+		tools::QC::read_matrix_size(file, H, N, Z);
+	else if (format == Matrix_format::BIN)
+		tools::BIN::read_matrix_size(file, H, N, Z); // Z is 0 if the BIN file has not been converted from a QC file
+
+	if (Z == 0)
+	{
+		std::stringstream message;
+		message << "The lifting size can only be read from a QC matrix file or from a BIN file converted from a QC "
+		        << "matrix file ('filename' = " << filename << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return Z;
+}
+
+void LDPC_matrix_handler
+::convert_to_bin(const std::string& filename, const std::string& bin_filename)
+{
+	std::ifstream file(filename);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "'filename' couldn't be opened ('filename' = " << filename << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto format = get_matrix_format(file);
+
+	Positions_vector  info_bits_pos;
+	std::vector<bool> pct_pattern;
+	int Z = 0;
+
+	file.seekg(0);
+	Sparse_matrix S;
+
+	switch (format)
+	{
+		case Matrix_format::QC:
+		{
+			int H, N;
+			tools::QC::read_matrix_size(file, H, N, Z);
+
+			file.seekg(0);
+			S = std::move(tools::QC::read(file));
+
+			try
+			{
+				pct_pattern = tools::QC::read_pct_pattern(file);
+			}
+			catch (std::exception const&)
+			{
+				pct_pattern.clear();
+				// puncturing pattern is not in the matrix file
+			}
+			break;
+		}
+		case Matrix_format::ALIST:
+		{
+			S = std::move(tools::AList::read(file));
+
+			try
+			{
+				info_bits_pos = tools::AList::read_info_bits_pos(file);
+			}
+			catch (std::exception const&)
+			{
+				info_bits_pos.clear();
+				// information bits positions are not in the matrix file
+			}
+			break;
+		}
+		case Matrix_format::BIN:
+		{
+			int H, N;
+			tools::BIN::read_matrix_size(file, H, N, Z);
+
+			file.seekg(0);
+			S = std::move(tools::BIN::read(file, &info_bits_pos, &pct_pattern));
+			break;
+		}
+		case Matrix_format::NR:
+		{
+			std::stringstream message;
+			message << "The matrix of a 5G NR base graph depends on the lifting size, it has to be built with "
+			        << "'NR_base_graph'.";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	tools::BIN::write(S, bin_filename, info_bits_pos, pct_pattern, Z);
+}
+
 bool LDPC_matrix_handler
 ::check_info_pos(const Positions_vector& info_bits_pos, int K, int N, bool throw_when_wrong)
 {
@@ -169,345 +333,252 @@ bool LDPC_matrix_handler
 	return true;
 }
 
-Sparse_matrix LDPC_matrix_handler
-::transform_H_to_G_decomp_LU(const Sparse_matrix& H, Positions_vector& info_bits_pos)
+namespace
 {
-	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
-	LDPC_matrix Hf = sparse_to_full<LDPC_matrix::value_type>(H);
-
-	auto Gf = LDPC_matrix_handler::transform_H_to_G_decomp_LU(Hf, info_bits_pos);
+using Positions_vector = LDPC_matrix_handler::Positions_vector;
+using Word_t           = GF2_matrix::Word_t;
+constexpr size_t word_size = GF2_matrix::word_size;
 
-	return full_to_sparse(Gf);
+std::unique_ptr<Thread_team> make_team(const size_t n_threads)
+{
+	return std::unique_ptr<Thread_team>(n_threads > 1 ? new Thread_team(n_threads) : nullptr);
 }
 
-Sparse_matrix LDPC_matrix_handler
-::transform_H_to_G_identity(const Sparse_matrix& H, Positions_vector& info_bits_pos)
+/*
+ * Return the first column after 'col' with a 1 in the row 'row' (or the number of columns if there is no one)
+ */
+size_t find_next_col(const GF2_matrix& mat, const size_t row, const size_t col)
 {
-	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
-	LDPC_matrix Hf = sparse_to_full<LDPC_matrix::value_type>(H);
+	const auto first = col +1;
+	if (first >= mat.get_n_cols())
+		return mat.get_n_cols();
 
-	auto Gf = LDPC_matrix_handler::transform_H_to_G_identity(Hf, info_bits_pos);
+	auto w    = first / word_size;
+	auto bits = mat[row][w] & (~(Word_t)0 << (first % word_size));
+	while (!bits && ++w < mat.get_n_words())
+		bits = mat[row][w];
 
-	return full_to_sparse(Gf);
-}
+	if (!bits)
+		return mat.get_n_cols();
 
-void swap_columns(LDPC_matrix_handler::LDPC_matrix& mat, size_t idx1, size_t idx2)
-{
-	auto n_row = mat.get_n_rows();
-	std::vector<LDPC_matrix_handler::LDPC_matrix::value_type> tmp(n_row);
-	for (size_t l = 0; l < n_row; l++) tmp[l]       = mat[l][idx1];
-	for (size_t l = 0; l < n_row; l++) mat[l][idx1] = mat[l][idx2];
-	for (size_t l = 0; l < n_row; l++) mat[l][idx2] = tmp[l];
+	size_t b = 0;
+	while (!((bits >> b) & 1)) b++;
+	return w * word_size + b;
 }
 
-
-LDPC_matrix_handler::LDPC_matrix LU_decomp(const LDPC_matrix_handler::LDPC_matrix& Hp)
+/*
+ * TOP_LEFT diagonal, the columns are processed by blocks of 64 (the columns of a word) like in M4RI.
+ * Inside a block, the pivots are searched and swapped exactly like in the column by column elimination, but the rows
+ * below the block are updated only once when the block is complete, with the four Russians tables. Meanwhile the row
+ * of a new pivot is updated with the previous pivots of the block one by one, and 'win' keeps the words of the block
+ * of the pivot rows, reduced between them, to read the current value of a row of the column.
+ */
+LDPC_matrix_handler::Positions_pair_vector form_diagonal_top_left(GF2_matrix& mat, Thread_team* team)
 {
-	using V = LDPC_matrix_handler::LDPC_matrix::value_type;
-
-	Hp.is_of_way_throw(Matrix::Way::HORIZONTAL);
+	LDPC_matrix_handler::Positions_pair_vector swapped_cols;
 
-	auto M = Hp.get_n_rows();
-
-	LDPC_matrix_handler::LDPC_matrix Hinv = Hp.resize(M, 2 * M, Matrix::Origin::TOP_LEFT);
+	const auto n_col = mat.get_n_cols();
+	auto n_row = mat.get_n_rows();
 
-	// Create identity on right part
-	for (size_t i = 0; i < M; i++)
-			Hinv[i][M + i] = 1;
+	std::vector<Word_t> win;
+	win.reserve(word_size);
 
-	// Gaussian elimination (Forward)
-	for (size_t r = 0; r < M; r++)
+	size_t i = 0;
+	while (i < n_row)
 	{
-		if (Hinv[r][r] == 0)
-		{
-			size_t r_swap = 0;
-			for (auto r2 = r + 1; r2 < M; r2++)
-			{
-				if (Hinv[r2][r] != 0)
-				{
-					r_swap = r2;
-					break;
-				}
-			}
+		const auto w     = i / word_size;
+		const auto b     = i % word_size;
+		const auto first = i - b; // row of the first pivot of the block
 
-			if (r_swap == 0)
-			{
-				std::stringstream message;
-				message << "Matrix H2 (H = [H1 H2]) is not invertible";
-				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
+		// remove from the row r the columns of the pivots of the block (in the order of the pivots)
+		auto update_row = [&](const size_t r)
+		{
+			for (size_t p = 0; p < win.size(); p++)
+				if ((mat[r][w] >> p) & 1)
+					mat.add_row(first + p, r, w);
+		};
 
-			std::swap(Hinv[r], Hinv[r_swap]);
-		}
+		update_row(i);
+		bool found = mat.at(i, i);
 
-		// XOR on lines
-		for (auto r2 = r + 1; r2 < M; r2++)
+		if (!found)
 		{
-			if (Hinv[r2][r] != 0)
+			// try to find an other row which as a 1 in column i
+			for (auto j = i +1; j < n_row; j++)
 			{
-				const auto loop_size1 = (size_t)(2 * M / mipp::nElReg<V>());
-				for (size_t i = 0; i < loop_size1; i++)
-				{
-					const auto rLgn  = mipp::Reg<V>(&Hinv[r ][i * mipp::nElReg<V>()]);
-					const auto rLgn2 = mipp::Reg<V>(&Hinv[r2][i * mipp::nElReg<V>()]);
-					auto rLgn3       = rLgn2 ^ rLgn;
-					rLgn3.store(&Hinv[r2][i * mipp::nElReg<V>()]);
-				}
-				for (unsigned i = loop_size1 * mipp::nElReg<V>(); i < 2 * M; i++)
-					Hinv[r2][i] = Hinv[r2][i] ^ Hinv[r][i];
-			}
-		}
-	}
+				auto x = mat[j][w];
+				const auto raw = x;
+				for (size_t p = 0; p < win.size(); p++)
+					if ((raw >> p) & 1)
+						x ^= win[p];
 
-	// Gaussian elimination (Backward)
-	for (auto r = M - 1; r > 0; r--)
-	{
-		// XOR on lines
-		for (auto r2 = r; r2 > 0; r2--)
-		{
-			auto rm1 = r2 - 1;
-			if (Hinv[rm1][r] != 0)
-			{
-				const auto loop_size1 = (size_t)(2 * M / mipp::nElReg<V>());
-				for (size_t i = 0; i < loop_size1; i++)
+				if ((x >> b) & 1)
 				{
-					const auto rLgn  = mipp::Reg<V>(&Hinv[r  ][i * mipp::nElReg<V>()]);
-					const auto rLgn2 = mipp::Reg<V>(&Hinv[rm1][i * mipp::nElReg<V>()]);
-					auto rLgn3       = rLgn2 ^ rLgn;
-					rLgn3.store(&Hinv[rm1][i * mipp::nElReg<V>()]);
+					mat.swap_rows(i, j);
+					update_row(i);
+					found = true;
+					break;
 				}
-				for (auto i = loop_size1 * mipp::nElReg<V>(); i < 2 * M; i++)
-					Hinv[rm1][i] = Hinv[rm1][i] ^ Hinv[r][i];
 			}
-		}
-	}
 
-
-	Hinv.self_resize(M, M, Matrix::Origin::TOP_RIGHT);
-
-	return Hinv;
-}
-
-/* // Benjamin's version
-template<bool allow_rank_deficient = true>
-LDPC_matrix_handler::LDPC_matrix LU_decomp2(const LDPC_matrix_handler::LDPC_matrix& Hp)
-{
-	using V = LDPC_matrix_handler::LDPC_matrix::value_type;
-
-	auto mat = Hp;
-
-	auto n_rows = mat.get_n_rows();
-	auto n_cols = mat.get_n_cols();
-
-	auto n_min = std::min(n_rows, n_cols);
-	bool rank_deficient = false;
-	LDPC_matrix_handler::Positions_vector null_rows;
-
-
-	// add an identity to the right part
-	mat.self_resize(n_rows, n_cols + n_rows, Matrix::Origin::TOP_LEFT);
-	for (size_t i = 0; i < n_rows; i++) // Add falling diagonal identity at the end
-		mat[i][i + n_cols] = true;
-
-	LDPC_matrix_handler::Positions_vector pos_rows(n_rows), pos_cols(n_cols);
-	std::iota(pos_rows.begin(), pos_rows.end(), 0);
-	std::iota(pos_cols.begin(), pos_cols.end(), 0);
-
-	// Gaussian elimination (Forward)
-	// try to generate an identity diagonal in the left part
-	for (size_t d = 0; d < n_min; d++)
-	{
-		// permutation step
-		bool found = false;
-		for (auto c = d; c < n_cols; c++)
-		{
-			for (size_t r = d; r < n_rows; r++)
-				if (mat[r][c])
+			if (!found) // no other row after (i+1) of the same column i with a 1
+			{
+				const auto j = find_next_col(mat, i, i); // find an other column which is good on row i
+				if (j < n_col)
 				{
-					if (r != d)
-					{
-						// row permutation
-						std::swap(pos_rows[d], pos_rows[r]);
-						std::swap(mat     [d], mat     [r]);
-					}
+					swapped_cols.push_back(std::make_pair(i,j));
+					mat.swap_cols(i, j);
 
-					if (c != d)
-					{
-						// col permutation
-						std::swap(pos_cols[d], pos_cols[c]);
-						swap_columns(mat, d, c);
-					}
+					// the swap can change the reduced words of the pivot rows of the block
+					for (size_t p = 0; p < win.size(); p++)
+						win[p] = mat[first + p][w];
+					for (auto p = win.size(); p > 0; p--)
+						for (size_t q = 0; q < p -1; q++)
+							if ((win[q] >> (p -1)) & 1)
+								win[q] ^= win[p -1];
 
 					found = true;
-					break;
 				}
-
-			if (found)
-				break;
+			}
 		}
 
-		if (!found)
+		if (found)
 		{
-			n_min = d;
-			rank_deficient = true;
-			throw runtime_error(__FILE__, __LINE__, __func__, "The matrix H is rank deficient, the SPARSE method can't handle it for now.");
-			break;
+			// there is a 1 on row i of the column i, the row is a new pivot of the block
+			const auto x = mat[i][w];
+			for (auto &y : win)
+				if ((y >> b) & 1)
+					y ^= x;
+			win.push_back(x);
+			i++;
 		}
-
-		// elimination step
-		for (auto r = d + 1; r < n_rows; r++)
-			if (mat[r][d])
-				std::transform(mat[d].begin() + d + 1, mat[d].end(), //ref
-				               mat[r].begin() + d + 1, mat[r].begin() + d + 1,
-				               std::not_equal_to<V>());
-	}
-
-
-	// keep the right part of the initial identity and add zeros below to find back original mat size
-	auto X = mat.resize(n_min, n_rows, Matrix::Origin::TOP_RIGHT); // delete rows below n_min
-	X.self_resize(n_cols, n_rows, Matrix::Origin::TOP_LEFT); // add null rows below part if n_cols != n_min
-
-
-	// Gaussian elimination (Backward)
-	// back substitution
-	X.self_transpose(); // X is now HORIZONTAL
-	for (size_t r = 0; r < X.get_n_rows(); r++)
-		for (size_t d = n_min - 1; d > 0; d--)
-			for (size_t c = d; c < n_min; c++)
-				X[r][d - 1] = X[r][d - 1] != ((mat[d - 1][c] != (V)0) && (X[r][c] != (V)0)); // row of 'mat' * row of 'X'
-
-
-	if (allow_rank_deficient && rank_deficient)
-	{
-		auto Hp2 = Hp;
-		// find null rows of X and delete them in Hp2
-		for (auto r = X.get_n_rows(); r > 0; r--)
+		else
 		{
-			auto r_test = r - 1;
-			if (std::find(X[r_test].begin(), X[r_test].end(), (V)true) == X[r_test].end())
-				Hp2.erase_row(r_test);
+			// the row is the null vector then delete it
+			mat.erase_row(i);
+			n_row--;
 		}
 
-		X.self_transpose(); // X is now VERTICAL
-
-		// permute rows of "X" according to permuted cols of "mat"
-		for (size_t i = 0; i < n_cols; i++)
-			std::swap(X[i], X[pos_cols[i]]);
-
-		// find null cols of X and delete them in Hp2
-		for (auto r = X.get_n_rows(); r > 0; r--)
+		if (!win.empty() && (i % word_size == 0 || i >= n_row))
 		{
-			auto r_test = r - 1;
-			if (std::find(X[r_test].begin(), X[r_test].end(), (V)true) == X[r_test].end())
-				Hp2.erase_col(r_test);
+			// the block is complete: remove its columns from the rows below (i+1) with the reduced pivots
+			auto pivots = mat.extract(first, win.size(), 0, n_col);
+			for (auto p = pivots.get_n_rows(); p > 0; p--)
+				for (size_t q = 0; q < p -1; q++)
+					if (pivots.at(q, first + p -1))
+						pivots.add_row(p -1, q, w);
+
+			mat.add_combinations(pivots, w, i, n_row, team);
+			win.clear();
 		}
-
-		return LU_decomp2<false>(Hp2);
 	}
-	else
-	{
-		X.self_transpose(); // X is now VERTICAL
-
-		// permute rows of "X" according to permuted cols of "mat"
-		for (size_t i = 0; i < n_cols; i++)
-			std::swap(X[i], X[pos_cols[i]]);
 
-		return X;
-	}
-}*/
+	return swapped_cols;
+}
 
-LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
-::LU_decomposition(const Sparse_matrix& H)
+/*
+ * TOP_LEFT identity, the columns are processed by blocks of 64 from the last one: a block is reduced inside then
+ * removed from the rows above with the four Russians tables.
+ */
+void form_identity_top_left(GF2_matrix& mat, Thread_team* team)
 {
-	using V = LDPC_matrix::value_type;
+	const auto n_row = mat.get_n_rows();
+	const auto n_col = mat.get_n_cols();
 
-	auto Ht = H.turn(Matrix::Way::HORIZONTAL);
+	for (auto w = (n_row + word_size -1) / word_size; w > 0; w--)
+	{
+		const auto first = (w -1) * word_size;
+		const auto last  = std::min(first + word_size, n_row);
 
-	auto M = Ht.get_n_rows();
-	Ht.self_resize(M, M, Matrix::Origin::TOP_RIGHT);
+		for (auto c = last -1; c > first; c--)
+			for (auto r = first; r < c; r++)
+				if (mat.at(r, c))
+					mat.add_row(c, r, w -1);
 
-	return LU_decomp(tools::sparse_to_full<V>(Ht));
+		mat.add_combinations(mat.extract(first, last - first, 0, n_col), w -1, 0, first, team);
+	}
 }
 
-LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
-::LU_decomposition(const LDPC_matrix& H)
+/*
+ * Inverse of the square matrix 'Hp' by Gauss-Jordan elimination of [Hp I]
+ */
+GF2_matrix invert(const GF2_matrix& Hp, Thread_team* team)
 {
-	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
+	const auto M = Hp.get_n_rows();
 
-	auto M = H.get_n_rows();
-	auto Hp = H.resize(M, M, Matrix::Origin::TOP_RIGHT); // parity part of H -> Horizontal M * M
+	GF2_matrix Hinv(M, 2 * M);
+	for (size_t r = 0; r < M; r++)
+	{
+		std::copy(Hp[r], Hp[r] + Hp.get_n_words(), Hinv[r]);
+		Hinv.set(r, M + r);
+	}
+
+	// a column swap or a null row means that there is no pivot for a column of Hp
+	const auto swapped_cols = form_diagonal_top_left(Hinv, team);
+	if (!swapped_cols.empty() || Hinv.get_n_rows() != M)
+	{
+		std::stringstream message;
+		message << "Matrix H2 (H = [H1 H2]) is not invertible";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	form_identity_top_left(Hinv, team);
 
-	return LU_decomp(Hp);
+	return Hinv.extract(0, M, M, M);
 }
 
 // Benjamin's version
-LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
-::transform_H_to_G_decomp_LU(const LDPC_matrix& H, Positions_vector& info_bits_pos)
+GF2_matrix decomp_LU(const GF2_matrix& H, Positions_vector& info_bits_pos, Thread_team* team)
 {
-	auto M = H.get_n_rows();
-	auto N = H.get_n_cols();
-	auto K = N - M;
-
-	LDPC_matrix Gp = LU_decomposition(H); // Gp is VERTICAL -> M * M
+	const auto M = H.get_n_rows();
+	const auto N = H.get_n_cols();
+	const auto K = N - M;
 
-
-	auto Hs = H.resize(M, K, Matrix::Origin::TOP_LEFT); // systematic part of H
-	Hs.self_transpose();
-	auto GH = bgemmt(Gp, Hs); // Gp * Hs -> horizontal M * K
-	// GH.self_resize(GH.get_n_rows(), GH.get_n_cols() - M, Matrix::Origin::TOP_LEFT); // remove right part
-	GH.self_transpose(); // now vertical K * M
+	auto Gp = invert(H.extract(0, M, K, M), team); // inverse of the parity part of H -> M * M
+	auto GH = GF2_matrix::mult(Gp, H.extract(0, M, 0, K), team).transpose(); // (Gp * Hs)' -> K * M
 
 	// add identity on the left part
-	GH.self_resize(K, N, Matrix::Origin::TOP_RIGHT);
+	GF2_matrix G(K, N);
 	for (size_t r = 0; r < K; r++)
-		GH[r][r] = 1;
-
-	// GH is now G -> K * N
-
-
-	// // check that G is good
-	// Hp.self_transpose(); // now vertical M*M
-	// auto GHp = bgemmt(Gp, Hp); // Gp * Hp
-
-	// // remove the identy
-	// auto min_size = std::min(GHp.get_n_rows(), GHp.get_n_cols());
-	// for (size_t r = 0; r < min_size; r++)
-	// 	GHp[r][r] = !GHp[r][r];
+	{
+		G.set(r, r);
+		for (size_t c = 0; c < M; c++)
+			if (GH.at(r, c))
+				G.set(r, K + c);
+	}
 
-	// if (!all_zeros(GHp))
-	// 	throw runtime_error(__FILE__, __LINE__, __func__, "Generated Gp from H is not good (Gp * Hp != Identity).");
+	// G -> K * N
 
 	info_bits_pos.resize(K);
 	std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
 
-	return GH;
+	return G;
 }
 
 // Valentin's version
-LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
-::transform_H_to_G_identity(const LDPC_matrix& H, Positions_vector& info_bits_pos)
+GF2_matrix identity(GF2_matrix& H, Positions_vector& info_bits_pos, Thread_team* team)
 {
-	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
-	auto G = H;
-
-	auto M = H.get_n_rows();
-	auto N = H.get_n_cols();
-	auto K = N - M;
-
-	auto swapped_cols = LDPC_matrix_handler::form_diagonal(G, Matrix::Origin::TOP_LEFT);
-	LDPC_matrix_handler::form_identity(G, Matrix::Origin::TOP_LEFT);
-
-
-	// erase the just created M*M identity in the left part of H and add the K*K identity below
-	G.self_resize(N, K, Matrix::Origin::TOP_RIGHT);
+	const auto M = H.get_n_rows();
+	const auto N = H.get_n_cols();
+	const auto K = N - M;
+
+	auto swapped_cols = form_diagonal_top_left(H, team);
+	form_identity_top_left(H, team);
+
+	// take the parity part of H (the right of the just created identity) and add the K*K identity below, when H is
+	// rank deficient the rows of the erased null rows are 0
+	auto P = H.extract(0, H.get_n_rows(), M, K);
+	GF2_matrix G(N, K);
+	for (size_t r = 0; r < P.get_n_rows(); r++)
+		std::copy(P[r], P[r] + P.get_n_words(), G[r]);
 	for (auto i = M; i < N; i++) // Add rising diagonal identity at the end
-		G[i][i - M] = 1;
+		G.set(i, i - M);
 
 	// G is now VERTICAL
 
 	// Re-organization: get G
 	for (auto l = swapped_cols.size(); l > 0; l--)
-		std::swap(G[swapped_cols[l-1].first], G[swapped_cols[l-1].second]);
+		G.swap_rows(swapped_cols[l-1].first, swapped_cols[l-1].second);
 
 	// return info bits positions
 	info_bits_pos.resize(K);
@@ -522,6 +593,65 @@ LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
 
 	return G;
 }
+}
+
+Sparse_matrix LDPC_matrix_handler
+::transform_H_to_G_decomp_LU(const Sparse_matrix& H, Positions_vector& info_bits_pos, const size_t n_threads)
+{
+	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
+
+	auto team = make_team(n_threads);
+	return decomp_LU(GF2_matrix(H), info_bits_pos, team.get()).to_sparse();
+}
+
+LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
+::transform_H_to_G_decomp_LU(const LDPC_matrix& H, Positions_vector& info_bits_pos, const size_t n_threads)
+{
+	auto team = make_team(n_threads);
+	return decomp_LU(GF2_matrix(H), info_bits_pos, team.get()).to_full<LDPC_matrix::value_type>();
+}
+
+Sparse_matrix LDPC_matrix_handler
+::transform_H_to_G_identity(const Sparse_matrix& H, Positions_vector& info_bits_pos, const size_t n_threads)
+{
+	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
+
+	GF2_matrix G(H);
+	auto team = make_team(n_threads);
+	return identity(G, info_bits_pos, team.get()).to_sparse();
+}
+
+LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
+::transform_H_to_G_identity(const LDPC_matrix& H, Positions_vector& info_bits_pos, const size_t n_threads)
+{
+	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
+
+	GF2_matrix G(H);
+	auto team = make_team(n_threads);
+	return identity(G, info_bits_pos, team.get()).to_full<LDPC_matrix::value_type>();
+}
+
+LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
+::LU_decomposition(const Sparse_matrix& H, const size_t n_threads)
+{
+	auto Ht = GF2_matrix(H.turn(Matrix::Way::HORIZONTAL));
+
+	auto M = Ht.get_n_rows();
+	auto team = make_team(n_threads);
+	return invert(Ht.extract(0, M, Ht.get_n_cols() - M, M), team.get()).to_full<LDPC_matrix::value_type>();
+}
+
+LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
+::LU_decomposition(const LDPC_matrix& H, const size_t n_threads)
+{
+	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
+
+	auto M = H.get_n_rows();
+	auto Hp = GF2_matrix(H).extract(0, M, H.get_n_cols() - M, M); // parity part of H -> Horizontal M * M
+
+	auto team = make_team(n_threads);
+	return invert(Hp, team.get()).to_full<LDPC_matrix::value_type>();
+}
 
 
 // Olivier's version = Valentin's version with identity formed on the right part but does not work, why ?
@@ -567,6 +697,19 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 {
 	mat.self_turn(Matrix::Way::HORIZONTAL);
 
+	GF2_matrix packed(mat);
+	auto swapped_cols = LDPC_matrix_handler::form_diagonal(packed, o);
+	mat = packed.to_full<LDPC_matrix::value_type>();
+
+	return swapped_cols;
+}
+
+LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
+::form_diagonal(GF2_matrix& mat, Matrix::Origin o, const size_t n_threads)
+{
+	if (mat.get_n_rows() > mat.get_n_cols())
+		mat = mat.transpose();
+
 	auto n_row = mat.get_n_rows();
 	auto n_col = mat.get_n_cols();
 
@@ -575,71 +718,24 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 	switch (o)
 	{
 		case Matrix::Origin::TOP_LEFT:
-			for (size_t i = 0; i < n_row; i++)
-			{
-				bool found = mat[i][i];
-
-				if (!found)
-				{
-					// try to find an other row which as a 1 in column i
-					for (auto j = i +1; j < n_row; j++)
-						if (mat[j][i])
-						{
-							std::swap(mat[i], mat[j]);
-							found = true;
-							break;
-						}
-
-
-					if (!found) // no other row after (i+1) of the same column i with a 1
-					{
-						for (auto j = i +1; j < n_col; j++) // find an other column which is good on row i
-						{
-							if (mat[i][j])
-							{
-								swapped_cols.push_back(std::make_pair(i,j));
-
-								swap_columns(mat, i, j);
-
-								found = true;
-								break;
-							}
-						}
-					}
-				}
-
-				if (found)
-				{
-					// there is a 1 on row i of the column i
-					// then remove any 1 of the column i from the row (i+1)
-					for (auto j = i +1; j < n_row; j++)
-		 				if (mat[j][i])
-							std::transform(mat[i].begin() + i, mat[i].end(), //ref
-							               mat[j].begin() + i, mat[j].begin() + i,
-							               std::not_equal_to<LDPC_matrix::value_type>());
-				}
-				else
-				{
-					// the row is the null vector then delete it
-					mat.erase_row(i);
-					i--;
-					n_row--;
-				}
-			}
+		{
+			auto team = make_team(n_threads);
+			swapped_cols = form_diagonal_top_left(mat, team.get());
+		}
 		break;
 		case Matrix::Origin::TOP_RIGHT:
 			for (size_t i = 0; i < n_row; i++)
 			{
 				auto ref_col = n_col - i - 1;
-				bool found = mat[i][ref_col];
+				bool found = mat.at(i, ref_col);
 
 				if (!found)
 				{
 					// try to find an other row which as a 1 in column ref_col
 					for (auto j = i +1; j < n_row; j++)
-						if (mat[j][ref_col])
+						if (mat.at(j, ref_col))
 						{
-							std::swap(mat[i], mat[j]);
+							mat.swap_rows(i, j);
 							found = true;
 							break;
 						}
@@ -650,11 +746,11 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 						for (auto j = ref_col; j > 0; j--) // find an other column which is good on row i
 						{
 							auto c = j -1;
-							if (mat[i][c])
+							if (mat.at(i, c))
 							{
 								swapped_cols.push_back(std::make_pair(i,c));
 
-								swap_columns(mat, i, c);
+								mat.swap_cols(i, c);
 
 								found = true;
 								break;
@@ -668,10 +764,8 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 					// there is a 1 on row i of the column ref_col
 					// then remove any 1 of the column ref_col from the row (i+1)
 					for (auto j = i +1; j < n_row; j++)
-		 				if (mat[j][ref_col])
-							std::transform(mat[i].begin(), mat[i].begin() + ref_col + 1, //ref
-							               mat[j].begin(), mat[j].begin(),
-							               std::not_equal_to<LDPC_matrix::value_type>());
+		 				if (mat.at(j, ref_col))
+							mat.add_row(i, j, 0, ref_col +1);
 				}
 				else
 				{
@@ -687,7 +781,7 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 			{
 				auto ref_row = i - 1;
 				auto ref_col = n_row - ref_row - 1;
-				bool found = mat[ref_row][ref_col];
+				bool found = mat.at(ref_row, ref_col);
 
 				if (!found)
 				{
@@ -695,9 +789,9 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 					for (auto j = ref_row; j > 0; j--)
 					{
 						auto tested_row = j - 1;
-						if (mat[tested_row][ref_col])
+						if (mat.at(tested_row, ref_col))
 						{
-							std::swap(mat[ref_row], mat[tested_row]);
+							mat.swap_rows(ref_row, tested_row);
 							found = true;
 							break;
 						}
@@ -708,11 +802,11 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 					{
 						for (auto j = ref_col +1; j < n_col; j++) // find an other column which is good on row ref_row
 						{
-							if (mat[ref_row][j])
+							if (mat.at(ref_row, j))
 							{
 								swapped_cols.push_back(std::make_pair(ref_col,j));
 
-								swap_columns(mat, ref_col, j);
+								mat.swap_cols(ref_col, j);
 
 								found = true;
 								break;
@@ -728,10 +822,8 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 					for (auto j = ref_row; j > 0; j--)
 					{
 						auto tested_row = j - 1;
-		 				if (mat[tested_row][ref_col])
-							std::transform(mat[ref_row   ].begin() + ref_col, mat[ref_row   ].end(), //ref
-							               mat[tested_row].begin() + ref_col, mat[tested_row].begin() + ref_col,
-							               std::not_equal_to<LDPC_matrix::value_type>());
+		 				if (mat.at(tested_row, ref_col))
+							mat.add_row(ref_row, tested_row, ref_col, n_col);
 					}
 				}
 				else
@@ -747,7 +839,7 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 			{
 				auto ref_row = i - 1;
 				auto ref_col = n_col - n_row + ref_row;
-				bool found = mat[ref_row][ref_col];
+				bool found = mat.at(ref_row, ref_col);
 
 				if (!found)
 				{
@@ -755,9 +847,9 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 					for (auto j = ref_row; j > 0; j--)
 					{
 						auto tested_row = j - 1;
-						if (mat[tested_row][ref_col])
+						if (mat.at(tested_row, ref_col))
 						{
-							std::swap(mat[ref_row], mat[tested_row]);
+							mat.swap_rows(ref_row, tested_row);
 							found = true;
 							break;
 						}
@@ -769,11 +861,11 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 						for (auto j = ref_col; j > 0; j--) // find an other column which is good on row ref_row
 						{
 							auto tested_col = j - 1;
-							if (mat[ref_row][tested_col])
+							if (mat.at(ref_row, tested_col))
 							{
 								swapped_cols.push_back(std::make_pair(ref_col,tested_col));
 
-								swap_columns(mat, ref_col, tested_col);
+								mat.swap_cols(ref_col, tested_col);
 
 								found = true;
 								break;
@@ -789,10 +881,8 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 					for (auto j = ref_row; j > 0; j--)
 					{
 						auto tested_row = j - 1;
-		 				if (mat[tested_row][ref_col])
-							std::transform(mat[ref_row   ].begin() + ref_col, mat[ref_row   ].end(), //ref
-							               mat[tested_row].begin() + ref_col, mat[tested_row].begin() + ref_col,
-							               std::not_equal_to<LDPC_matrix::value_type>());
+		 				if (mat.at(tested_row, ref_col))
+							mat.add_row(ref_row, tested_row, ref_col, n_col);
 					}
 				}
 				else
@@ -813,32 +903,39 @@ void LDPC_matrix_handler
 {
 	mat.self_turn(Matrix::Way::HORIZONTAL);
 
+	GF2_matrix packed(mat);
+	LDPC_matrix_handler::form_identity(packed, o);
+	mat = packed.to_full<LDPC_matrix::value_type>();
+}
+
+void LDPC_matrix_handler
+::form_identity(GF2_matrix& mat, Matrix::Origin o, const size_t n_threads)
+{
+	if (mat.get_n_rows() > mat.get_n_cols())
+		mat = mat.transpose();
+
 	auto n_row = mat.get_n_rows();
 	auto n_col = mat.get_n_cols();
 	auto diff  = n_col - n_row;
 
+	if (n_row == 0)
+		return;
+
 	switch (o)
 	{
 		case Matrix::Origin::TOP_LEFT:
-			for (auto c = n_row - 1; c > 0; c--)
-			{
-				auto ref_row = c;
-				for (auto r = c; r > 0; r--)
-					if (mat[r - 1][c])
-						std::transform (mat[ref_row].begin() + c, mat[ref_row].end(), // ref
-						                mat[r - 1  ].begin() + c, mat[r - 1  ].begin() + c,
-						                std::not_equal_to<LDPC_matrix::value_type>());
-			}
+		{
+			auto team = make_team(n_threads);
+			form_identity_top_left(mat, team.get());
+		}
 		break;
 		case Matrix::Origin::TOP_RIGHT:
 			for (auto c = diff; c < (n_col - 1); c++)
 			{
 				auto ref_row = n_row - c + diff - 1;
 				for (auto r = ref_row; r > 0; r--)
-					if (mat[r - 1][c])
-						std::transform (mat[ref_row].begin(), mat[ref_row].begin() + c + 1, // ref
-						                mat[r - 1  ].begin(), mat[r - 1  ].begin(),
-						                std::not_equal_to<LDPC_matrix::value_type>());
+					if (mat.at(r - 1, c))
+						mat.add_row(ref_row, r - 1, 0, c + 1);
 			}
 		break;
 		case Matrix::Origin::BOTTOM_LEFT:
@@ -846,10 +943,8 @@ void LDPC_matrix_handler
 			{
 				auto ref_row = n_row - c - 1;
 				for (auto r = ref_row + 1; r < n_row; r++)
-					if (mat[r][c])
-						std::transform (mat[ref_row].begin() + c, mat[ref_row].end(), // ref
-						                mat[r      ].begin() + c, mat[r      ].begin() + c,
-						                std::not_equal_to<LDPC_matrix::value_type>());
+					if (mat.at(r, c))
+						mat.add_row(ref_row, r, c, n_col);
 			}
 		break;
 		case Matrix::Origin::BOTTOM_RIGHT:
@@ -857,10 +952,8 @@ void LDPC_matrix_handler
 			{
 				auto ref_row = c - diff;
 				for (auto r = ref_row + 1; r < n_row; r++)
-					if (mat[r][c])
-						std::transform (mat[ref_row].begin(), mat[ref_row].begin() + c + 1, // ref
-						                mat[r      ].begin(), mat[r      ].begin(),
-						                std::not_equal_to<LDPC_matrix::value_type>());
+					if (mat.at(r, c))
+						mat.add_row(ref_row, r, 0, c + 1);
 			}
 		break;
 	}
@@ -963,7 +1056,7 @@ bool LDPC_matrix_handler
 bool LDPC_matrix_handler
 ::check_GH(const LDPC_matrix& H, const LDPC_matrix& G)
 {
-	LDPC_matrix GH;
+	GF2_matrix GH;
 
 	switch (H.get_way())
 	{
@@ -971,10 +1064,10 @@ bool LDPC_matrix_handler
 			switch (G.get_way())
 			{
 				case Matrix::Way::HORIZONTAL:
-					GH = bgemmt(H, G);
+					GH = GF2_matrix::mult(GF2_matrix(H), GF2_matrix(G).transpose());
 				break;
 				case Matrix::Way::VERTICAL:
-					GH = bgemm(H, G);
+					GH = GF2_matrix::mult(GF2_matrix(H), GF2_matrix(G));
 				break;
 			}
 		break;
@@ -982,7 +1075,7 @@ bool LDPC_matrix_handler
 			switch (G.get_way())
 			{
 				case Matrix::Way::HORIZONTAL:
-					GH = bgemm(G, H);
+					GH = GF2_matrix::mult(GF2_matrix(G), GF2_matrix(H));
 				break;
 				case Matrix::Way::VERTICAL:
 					throw runtime_error(__FILE__, __LINE__, __func__, "G and H can't be both in VERTICAL way.");
@@ -991,5 +1084,5 @@ bool LDPC_matrix_handler
 		break;
 	}
 
-	return all_zeros(GH);
+	return GH.all_zeros();
 }
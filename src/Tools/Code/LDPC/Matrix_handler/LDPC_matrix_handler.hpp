@@ -1,6 +1,7 @@
 #ifndef LDPC_MATRIX_HANDLER_HPP_
 #define LDPC_MATRIX_HANDLER_HPP_
 
+#include <memory>
 #include <vector>
 #include <algorithm>
 #include <functional>
@@ -9,6 +10,8 @@
 #include <mipp.h>
 
 #include "Tools/Algo/Matrix/matrix_utils.h"
+#include "Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Shared_sparse_matrix.hpp"
 
 namespace aff3ct
 {
@@ -21,10 +24,11 @@ public:
 	using Positions_vector      = std::vector<uint32_t>;
 	using Positions_pair_vector = std::vector<std::pair<size_t,size_t>>;
 
-	enum class Matrix_format : int8_t {ALIST, QC};
+	enum class Matrix_format : int8_t {ALIST, QC, BIN, NR};
 
 	/*
-	 * read the matrix from the given file
+	 * read the matrix from the given file (not for a 5G NR base graph: its matrix depends on the lifting size, see
+	 * NR_base_graph)
 	 */
 	static Sparse_matrix read(const std::string& filename, Positions_vector* info_bits_pos = nullptr,
 	                          std::vector<bool>* pct_pattern = nullptr);
@@ -32,6 +36,14 @@ public:
 	static Sparse_matrix read(std::ifstream &file, Positions_vector* info_bits_pos = nullptr,
 	                          std::vector<bool>* pct_pattern = nullptr);
 
+	/*
+	 * same as 'read' but the matrix is read-only and registered in 'Shared_sparse_matrix', a BIN file is read once
+	 * for all the threads of the process
+	 */
+	static std::shared_ptr<const Sparse_matrix> read_shared(const std::string& filename,
+	                                                        Positions_vector* info_bits_pos = nullptr,
+	                                                        std::vector<bool>* pct_pattern = nullptr);
+
 	/*
 	 * try to guess the matrix format from the given input stream
 	 */
@@ -46,6 +58,18 @@ public:
 	static void read_matrix_size(const std::string& filename, int& H, int& N);
 	static void read_matrix_size(std::ifstream &file, int& H, int& N);
 
+	/*
+	 * get the lifting size Z of a QC matrix file (throw if the file is not in the QC format, or in the BIN format
+	 * without lifting size)
+	 */
+	static int read_lifting_size(const std::string& filename);
+
+	/*
+	 * convert a matrix file (AList, QC or BIN) to the BIN format, with the information bits positions, the
+	 * puncturing pattern and the lifting size when the source file gives them
+	 */
+	static void convert_to_bin(const std::string& filename, const std::string& bin_filename);
+
 
 	/*
 	 * Check if the input info bits position are in the matrix dimensions (K*N)
@@ -57,14 +81,19 @@ public:
 	 * \brief Reorder rows and columns to create a diagonal of binary ones from the given origin of the matrix.
 	 * Matrix is turned in Horizontal way
 	 * \return swapped columns positions pairs. Warning, a column might be swapped several times.
+	 * \param n_threads is the number of threads used to update the rows (TOP_LEFT origin only).
 	 */
 	static Positions_pair_vector form_diagonal(LDPC_matrix& mat, Matrix::Origin o = Matrix::Origin::TOP_LEFT);
+	static Positions_pair_vector form_diagonal(GF2_matrix&  mat, Matrix::Origin o = Matrix::Origin::TOP_LEFT,
+	                                           const size_t n_threads = 1);
 
 	/*
 	 * Reorder rows and columns to create an identity of binary ones on the left part of the matrix.
 	 * This function need you call first form_diagonal().
 	 */
 	static void form_identity(LDPC_matrix& mat, Matrix::Origin o = Matrix::Origin::TOP_LEFT);
+	static void form_identity(GF2_matrix&  mat, Matrix::Origin o = Matrix::Origin::TOP_LEFT,
+	                          const size_t n_threads = 1);
 
 	/*
 	 * \brief Compute a G matrix related to the given H matrix. This method favors a hallowed generator matrix build.
@@ -72,9 +101,12 @@ public:
 	 * \return G horizontal with a guarantee to have the identity on the left part.
 	 * \param info_bits_pos is filled with the positions (that are 0 to K-1) of the information bits.
 	 * \param H (in Horizontal way) is the parity matrix from which G is built.
+	 * \param n_threads is the number of threads used by the elimination and the product.
 	 */
-	static Sparse_matrix transform_H_to_G_decomp_LU(const Sparse_matrix& H, Positions_vector& info_bits_pos);
-	static LDPC_matrix   transform_H_to_G_decomp_LU(const LDPC_matrix&   H, Positions_vector& info_bits_pos);
+	static Sparse_matrix transform_H_to_G_decomp_LU(const Sparse_matrix& H, Positions_vector& info_bits_pos,
+	                                                const size_t n_threads = 1);
+	static LDPC_matrix   transform_H_to_G_decomp_LU(const LDPC_matrix&   H, Positions_vector& info_bits_pos,
+	                                                const size_t n_threads = 1);
 
 	/*
 	 * \brief Compute a G matrix related to the given H matrix. This method builds a matrix by creating an identity on
@@ -82,9 +114,13 @@ public:
 	 * \return G vertical with not necessary an identity.
 	 * \param info_bits_pos is filled with the positions (between 0 to N-1) of the information bits in G.
 	 * \param H (in Horizontal way) is the parity matrix from which G is built.
+	 * \param n_threads is the number of threads used by the elimination.
+	 * When H is rank deficient, the null rows of the elimination are dropped and the matching parity bits are 0.
 	 */
-	static Sparse_matrix transform_H_to_G_identity(const Sparse_matrix& H, Positions_vector& info_bits_pos);
-	static LDPC_matrix   transform_H_to_G_identity(const LDPC_matrix&   H, Positions_vector& info_bits_pos);
+	static Sparse_matrix transform_H_to_G_identity(const Sparse_matrix& H, Positions_vector& info_bits_pos,
+	                                               const size_t n_threads = 1);
+	static LDPC_matrix   transform_H_to_G_identity(const LDPC_matrix&   H, Positions_vector& info_bits_pos,
+	                                               const size_t n_threads = 1);
 
 	/*
 	 * integrate an interleaver inside the matrix to avoid this step.
@@ -105,8 +141,8 @@ public:
 	/*
 	 * inverse H2 (H = [H1 H2] with size(H2) = M x M) to allow encoding with p = H1 x inv(H2) x u
 	 */
-	static LDPC_matrix LU_decomposition(const Sparse_matrix& H);
-	static LDPC_matrix LU_decomposition(const LDPC_matrix&   H);
+	static LDPC_matrix LU_decomposition(const Sparse_matrix& H, const size_t n_threads = 1);
+	static LDPC_matrix LU_decomposition(const LDPC_matrix&   H, const size_t n_threads = 1);
 
 
 	/*
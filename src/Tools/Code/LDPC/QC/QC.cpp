@@ -156,6 +156,13 @@ void QC
 
 void QC
 ::read_matrix_size(std::istream &stream, int& H, int& N)
+{
+	int Z;
+	read_matrix_size(stream, H, N, Z);
+}
+
+void QC
+::read_matrix_size(std::istream &stream, int& H, int& N, int& Z)
 {
 	std::string line;
 
@@ -168,13 +175,13 @@ void QC
 		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	unsigned N_red = 0, M_red = 0, Z = 0;
+	unsigned N_red = 0, M_red = 0;
 
 	N_red = std::stoi(values[0]);
 	M_red = std::stoi(values[1]);
 	Z = std::stoi(values[2]);
 
-	if (N_red == 0 || M_red == 0 || Z == 0)
+	if (N_red == 0 || M_red == 0 || Z <= 0)
 	{
 		std::stringstream message;
 		message << "'N_red', 'M_red' and 'Z' have to be greater than 0 ('N_red' = " << N_red
@@ -184,4 +191,62 @@ void QC
 
 	N = N_red * Z;
 	H = M_red * Z;
+}
+
+std::vector<std::vector<int>> QC
+::get_base_matrix(const Sparse_matrix &H, const int Z)
+{
+	// the variable nodes are along the rows and the check nodes along the columns
+	const auto H_v = H.turn(Sparse_matrix::Way::VERTICAL);
+
+	if (Z <= 0 || H_v.get_n_rows() % Z || H_v.get_n_cols() % Z)
+	{
+		std::stringstream message;
+		message << "The dimensions of 'H' have to be multiples of 'Z' ('H.get_n_rows()' = " << H_v.get_n_rows()
+		        << ", 'H.get_n_cols()' = " << H_v.get_n_cols() << ", 'Z' = " << Z << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto N_red = H_v.get_n_rows() / Z;
+	const auto M_red = H_v.get_n_cols() / Z;
+
+	std::vector<std::vector<int>> base(M_red, std::vector<int>(N_red, -1));
+	for (size_t i = 0; i < M_red; i++)
+	{
+		// the first check node of the block row gives the shifts
+		const auto &first = H_v.get_rows_from_col(i * Z);
+		for (auto v : first)
+		{
+			if (base[i][v / Z] != -1)
+			{
+				std::stringstream message;
+				message << "'H' is not a QC matrix with a lifting size of " << Z << " (the check node " << i * Z
+				        << " has several connections in the block column " << v / Z << ").";
+				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+			base[i][v / Z] = (int)(v % Z);
+		}
+
+		// the other check nodes of the block row have to be connected to the shifted variable nodes
+		for (size_t k = 1; k < (size_t)Z; k++)
+		{
+			const auto &cur = H_v.get_rows_from_col(i * Z + k);
+			auto is_shifted = cur.size() == first.size();
+			for (size_t c = 0; c < cur.size() && is_shifted; c++)
+			{
+				const auto shift = base[i][cur[c] / Z];
+				is_shifted = shift != -1 && cur[c] % Z == (k + shift) % Z;
+			}
+
+			if (!is_shifted)
+			{
+				std::stringstream message;
+				message << "'H' is not a QC matrix with a lifting size of " << Z << " (the check node " << i * Z + k
+				        << " is not a shift of the check node " << i * Z << ").";
+				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+		}
+	}
+
+	return base;
 }
\ No newline at end of file
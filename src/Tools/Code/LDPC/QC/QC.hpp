@@ -26,6 +26,20 @@ public:
 	 */
 	static void read_matrix_size(std::istream &stream, int& H, int& N);
 
+	/*
+	 * get the matrix dimensions H and N and the lifting size Z from the input stream
+	 */
+	static void read_matrix_size(std::istream &stream, int& H, int& N, int& Z);
+
+	/*
+	 * get the base matrix of a QC matrix: the shift of each Z x Z circulant permutation matrix (-1 if the block is
+	 * null), the check nodes are along the rows of the base matrix
+	 * @H is the expanded matrix
+	 * @Z is the lifting size
+	 * throw if H is not made of Z x Z circulant permutation matrices
+	 */
+	static std::vector<std::vector<int>> get_base_matrix(const Sparse_matrix &H, const int Z);
+
 private:
 	static Sparse_matrix _read(std::istream &stream);
 };
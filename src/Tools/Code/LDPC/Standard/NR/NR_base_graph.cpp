@@ -0,0 +1,260 @@
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/general_utils.h"
+
+#include "NR_base_graph.hpp"
+
+#include "NR_base_graph_BG1.hpp"
+#include "NR_base_graph_BG2.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+constexpr int NR_base_graph::n_sets;
+
+NR_base_graph
+::NR_base_graph(const int bg)
+: n_rows(0), n_cols(0)
+{
+	switch (bg)
+	{
+		case 1: this->name = "BG1"; this->n_rows = 46; this->n_cols = 68; this->entries = NR_base_graph_BG1; break;
+		case 2: this->name = "BG2"; this->n_rows = 42; this->n_cols = 52; this->entries = NR_base_graph_BG2; break;
+		default:
+		{
+			std::stringstream message;
+			message << "'bg' has to be equal to 1 or 2 ('bg' = " << bg << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+}
+
+NR_base_graph
+::NR_base_graph(std::istream &stream)
+: n_rows(0), n_cols(0)
+{
+	try
+	{
+		this->_read(stream);
+	}
+	catch (std::exception const& e)
+	{
+		std::stringstream message;
+		message << "The given stream does not refer to a 5G NR base graph file (" << e.what() << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+NR_base_graph
+::NR_base_graph(const std::string &filename)
+: n_rows(0), n_cols(0)
+{
+	std::ifstream file(filename);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "'filename' couldn't be opened ('filename' = " << filename << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	try
+	{
+		this->_read(file);
+	}
+	catch (std::exception const& e)
+	{
+		std::stringstream message;
+		message << "'filename' is not a 5G NR base graph file ('filename' = " << filename << ", " << e.what() << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+bool NR_base_graph
+::is_nr(std::istream &stream)
+{
+	const auto pos = stream.tellg();
+
+	std::string line;
+	try
+	{
+		getline(stream, line);
+	}
+	catch (std::exception const&)
+	{
+		line.clear();
+	}
+
+	stream.clear();
+	stream.seekg(pos);
+
+	const auto values = split(line);
+	return values.size() == 1 && (values[0] == "BG1" || values[0] == "BG2");
+}
+
+void NR_base_graph
+::_read(std::istream &stream)
+{
+	std::string line;
+
+	getline(stream, line);
+	auto values = split(line);
+	if (values.size() != 1)
+	{
+		std::stringstream message;
+		message << "'values.size()' has to be equal to 1 ('values.size()' = " << values.size() << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+	this->name = values[0];
+
+	getline(stream, line);
+	values = split(line);
+	if (values.size() != 3)
+	{
+		std::stringstream message;
+		message << "'values.size()' has to be equal to 3 ('values.size()' = " << values.size() << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto M_red     = std::stoi(values[0]);
+	const auto N_red     = std::stoi(values[1]);
+	const auto n_entries = std::stoi(values[2]);
+
+	if (M_red <= 0 || N_red <= M_red || n_entries <= 0 || N_red > 0xFFFF)
+	{
+		std::stringstream message;
+		message << "'M_red', 'N_red' and 'n_entries' have to be positive, with 'N_red' > 'M_red' ('M_red' = "
+		        << M_red << ", 'N_red' = " << N_red << ", 'n_entries' = " << n_entries << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->n_rows = (size_t)M_red;
+	this->n_cols = (size_t)N_red;
+	this->entries.resize(n_entries);
+
+	for (auto &e : this->entries)
+	{
+		getline(stream, line);
+		values = split(line);
+		if ((int)values.size() != 2 + n_sets)
+		{
+			std::stringstream message;
+			message << "'values.size()' has to be equal to " << 2 + n_sets << " ('values.size()' = "
+			        << values.size() << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		const auto row = std::stoi(values[0]);
+		const auto col = std::stoi(values[1]);
+		if (row < 0 || row >= M_red || col < 0 || col >= N_red)
+		{
+			std::stringstream message;
+			message << "The entry is out of the base matrix ('row' = " << row << ", 'col' = " << col << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		e.row = (uint16_t)row;
+		e.col = (uint16_t)col;
+		for (auto s = 0; s < n_sets; s++)
+		{
+			const auto V = std::stoi(values[2 + s]);
+			if (V < 0 || V > 0xFFFF)
+			{
+				std::stringstream message;
+				message << "The shift coefficients have to be positive ('row' = " << row << ", 'col' = " << col
+				        << ", 'V' = " << V << ").";
+				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+			e.V[s] = (uint16_t)V;
+		}
+	}
+
+	std::sort(this->entries.begin(), this->entries.end(), [](const Entry &a, const Entry &b)
+	{
+		return a.row != b.row ? a.row < b.row : a.col < b.col;
+	});
+
+	for (size_t i = 1; i < this->entries.size(); i++)
+		if (this->entries[i].row == this->entries[i -1].row && this->entries[i].col == this->entries[i -1].col)
+		{
+			std::stringstream message;
+			message << "The entry is given twice ('row' = " << this->entries[i].row << ", 'col' = "
+			        << this->entries[i].col << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+}
+
+int NR_base_graph
+::get_set_index(const int Z)
+{
+	// Z = a * 2^j, with a in {2, 3, 5, 7, 9, 11, 13, 15} and Z <= 384
+	if (Z >= 2 && Z <= 384)
+	{
+		auto a = Z;
+		while (a % 2 == 0 && a > 2)
+			a /= 2;
+
+		if (a == 2)
+			return 0;
+
+		if (a % 2 == 1 && a >= 3 && a <= 15)
+			return (a -1) / 2;
+	}
+
+	std::stringstream message;
+	message << "'Z' is not a lifting size of the 5G NR standard ('Z' = " << Z << ").";
+	throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+}
+
+int NR_base_graph
+::select_lifting_size(const int K) const
+{
+	const auto n_info_cols = (int)this->get_n_info_cols();
+
+	auto Z_min = 0;
+	for (auto a : {2, 3, 5, 7, 9, 11, 13, 15})
+		for (auto Z = a; Z <= 384; Z *= 2)
+			if (n_info_cols * Z >= K && (Z_min == 0 || Z < Z_min))
+				Z_min = Z;
+
+	if (Z_min == 0)
+	{
+		std::stringstream message;
+		message << "'K' is too big for the base graph ('K' = " << K << ", 'get_n_info_cols()' = " << n_info_cols
+		        << ", 'name' = " << this->name << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return Z_min;
+}
+
+std::vector<std::vector<int>> NR_base_graph
+::get_base_matrix(const int Z) const
+{
+	const auto s = get_set_index(Z);
+
+	std::vector<std::vector<int>> base(this->n_rows, std::vector<int>(this->n_cols, -1));
+	for (auto &e : this->entries)
+		base[e.row][e.col] = (int)e.V[s] % Z;
+
+	return base;
+}
+
+Sparse_matrix NR_base_graph
+::expand(const int Z) const
+{
+	const auto s = get_set_index(Z);
+
+	// each variable node is connected to one check node per circulant of its block column
+	std::vector<std::vector<Sparse_matrix::Idx_t>> row_to_cols(this->n_cols * Z);
+	for (auto &e : this->entries)
+	{
+		const auto shift = (int)e.V[s] % Z;
+		for (auto k = 0; k < Z; k++)
+			row_to_cols[e.col * Z + (k + shift) % Z].push_back((Sparse_matrix::Idx_t)(e.row * Z + k));
+	}
+
+	return Sparse_matrix(this->n_rows * Z, row_to_cols);
+}
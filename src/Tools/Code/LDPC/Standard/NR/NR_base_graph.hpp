@@ -0,0 +1,101 @@
+/*
+ * Link to the 5G NR channel coding standard (3GPP TS 38.212, section 5.3.2): https://www.etsi.org/deliver/etsi_ts/138200_138299/138212/15.02.00_60/ts_138212v150200p.pdf
+ */
+
+#ifndef NR_BASE_GRAPH_HPP_
+#define NR_BASE_GRAPH_HPP_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <iostream>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Base graph of the 5G NR LDPC codes (BG1: 46 x 68, BG2: 42 x 52). Only the non-null entries of the base matrix are
+ * stored, each one with its shift coefficient V for the 8 sets of lifting sizes (TS 38.212, tables 5.3.2-2 and
+ * 5.3.2-3), so a code of any lifting size Z is obtained without reading a matrix file again: the shift of the
+ * Z x Z circulant is V mod Z, V being taken in the set of Z. The check nodes are along the rows of the base matrix,
+ * the information bits are in the first 'n_cols - n_rows' block columns.
+ *
+ * The shift coefficients of the standard are compiled in (see NR_base_graph(const int)), they can also be read from a
+ * text file:
+ * - the name of the base graph ("BG1" or "BG2"),
+ * - the number of rows, the number of columns and the number of non-null entries of the base matrix,
+ * - one line per non-null entry: its row, its column and its 8 shift coefficients (set index 0 to 7).
+ * The lines starting with a '#' are ignored.
+ */
+class NR_base_graph
+{
+public:
+	static constexpr int n_sets = 8;
+
+	struct Entry
+	{
+		uint16_t row;
+		uint16_t col;
+		uint16_t V[n_sets];
+	};
+
+private:
+	std::string        name;
+	size_t             n_rows;
+	size_t             n_cols;
+	std::vector<Entry> entries; // row after row, by increasing column in a row
+
+public:
+	/*
+	 * the base graph 1 or 2 of the standard
+	 */
+	explicit NR_base_graph(const int bg);
+	explicit NR_base_graph(std::istream &stream);
+	explicit NR_base_graph(const std::string &filename);
+	virtual ~NR_base_graph() = default;
+
+	/*
+	 * return true if the stream starts with the name of a base graph (the position of the stream is restored)
+	 */
+	static bool is_nr(std::istream &stream);
+
+	inline const std::string& get_name() const { return this->name; }
+
+	inline size_t get_n_rows     () const { return this->n_rows;                }
+	inline size_t get_n_cols     () const { return this->n_cols;                }
+	inline size_t get_n_info_cols() const { return this->n_cols - this->n_rows; }
+
+	inline const std::vector<Entry>& get_entries() const { return this->entries; }
+
+	/*
+	 * the set index (iLS) of the lifting size Z (TS 38.212, table 5.3.2-1), throw if Z is not a lifting size of the
+	 * standard
+	 */
+	static int get_set_index(const int Z);
+
+	/*
+	 * the smallest lifting size Z such that the 'K' information bits fit in the information block columns
+	 */
+	int select_lifting_size(const int K) const;
+
+	/*
+	 * the shift of each Z x Z circulant (-1 if the block is null), in the same format as QC::get_base_matrix
+	 */
+	std::vector<std::vector<int>> get_base_matrix(const int Z) const;
+
+	/*
+	 * the expanded parity matrix of lifting size Z (the variable nodes along the rows), for the decoders that do not
+	 * work on the circulants
+	 */
+	Sparse_matrix expand(const int Z) const;
+
+private:
+	void _read(std::istream &stream);
+};
+}
+}
+
+#endif /* NR_BASE_GRAPH_HPP_ */
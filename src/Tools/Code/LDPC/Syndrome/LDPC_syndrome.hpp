@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Compact_sparse_matrix.hpp"
 
 namespace aff3ct
 {
@@ -23,6 +24,17 @@ public:
 
 	template <typename R>
 	static inline bool check_soft(const R *Y_N, const Sparse_matrix &H);
+
+	template <typename B, typename I>
+	static inline bool check_hard(const B *X_N, const Compact_sparse_matrix<I> &H);
+
+	template <typename R, typename I>
+	static inline bool check_soft(const R *Y_N, const Compact_sparse_matrix<I> &H);
+
+	// checks only the parity of the check nodes in [c_first, c_last[
+	template <typename R, typename I>
+	static inline bool check_soft(const R *Y_N, const Compact_sparse_matrix<I> &H, const int c_first,
+	                              const int c_last);
 };
 }
 }
@@ -75,5 +75,47 @@ bool LDPC_syndrome
 	return LDPC_syndrome::check_soft<R>(Y_N.data(), H);
 }
 
+template <typename B, typename I>
+bool LDPC_syndrome
+::check_hard(const B *X_N, const Compact_sparse_matrix<I> &H)
+{
+	const auto n_chk_nodes = (int)H.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		auto sign = 0;
+		for (auto v : H[c])
+			sign ^= X_N[v] ? -1 : 0;
+
+		if (sign)
+			return false;
+	}
+
+	return true;
+}
+
+template <typename R, typename I>
+bool LDPC_syndrome
+::check_soft(const R *Y_N, const Compact_sparse_matrix<I> &H)
+{
+	return LDPC_syndrome::check_soft<R,I>(Y_N, H, 0, (int)H.get_n_cols());
+}
+
+template <typename R, typename I>
+bool LDPC_syndrome
+::check_soft(const R *Y_N, const Compact_sparse_matrix<I> &H, const int c_first, const int c_last)
+{
+	for (auto c = c_first; c < c_last; c++)
+	{
+		auto sign = 0;
+		for (auto v : H[c])
+			sign ^= (Y_N[v] < 0) ? -1 : 0;
+
+		if (sign)
+			return false;
+	}
+
+	return true;
+}
+
 }
 }
\ No newline at end of file
@@ -4,8 +4,10 @@
 #include <vector>
 #include <limits>
 #include <string>
+#include <type_traits>
 #include <mipp.h>
 
+#include "Tools/Exception/exception.hpp"
 #include "Tools/Math/max.h"
 
 namespace aff3ct
@@ -24,15 +26,19 @@ protected:
 	mipp::Reg<R> min;
 	mipp::Reg<R> delta_min;
 	mipp::Reg<R> delta;
+	const int n_decimals; // number of fractional bits of the fixed-point LLRs (MINL correction)
 
 	int n_ite;
 	int ite;
 
 public:
-	Update_rule_AMS_simd()
+	explicit Update_rule_AMS_simd(const int n_decimals = 2)
 	: name("AMS"), false_msk(false), max(std::numeric_limits<R>::max()), zero((R)0), sign(false), min(max),
-	  delta_min(max), delta(max), n_ite(0), ite(0)
+	  delta_min(max), delta(max), n_decimals(n_decimals), n_ite(0), ite(0)
 	{
+		if (!std::is_floating_point<R>::value && MIN == min_star_i<R>)
+			throw invalid_argument(__FILE__, __LINE__, __func__, "The 'min_star_i' approximation (MINS) does not work "
+			                                                     "in fixed-point, use MIN or MINL instead.");
 	}
 
 	virtual ~Update_rule_AMS_simd()
@@ -73,12 +79,12 @@ public:
 
 		this->sign     ^= var_sgn;
 		this->min       = mipp::min(this->min, var_abs);
-		this->delta_min = MIN(this->delta_min, mipp::blend(tmp, var_abs, var_abs == this->min));
+		this->delta_min = this->min_star(this->delta_min, mipp::blend(tmp, var_abs, var_abs == this->min));
 	}
 
 	inline void end_chk_node_in()
 	{
-		this->delta     = mipp::max(zero, MIN(this->delta_min, this->min));
+		this->delta     = mipp::max(zero, this->min_star(this->delta_min, this->min));
 		this->delta_min = mipp::max(zero, this->delta_min);
 	}
 
@@ -107,6 +113,16 @@ public:
 	inline void end_decoding()
 	{
 	}
+
+protected:
+	inline mipp::Reg<R> min_star(const mipp::Reg<R> a, const mipp::Reg<R> b) const
+	{
+		// in fixed-point, the linear correction depends on the quantization of the LLRs
+		if (!std::is_floating_point<R>::value && MIN == min_star_linear2_i<R>)
+			return min_star_linear2_fix_i<R>(a, b, this->n_decimals);
+		else
+			return MIN(a, b);
+	}
 };
 }
 }
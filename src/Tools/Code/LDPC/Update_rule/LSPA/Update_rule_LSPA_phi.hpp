@@ -0,0 +1,124 @@
+#ifndef UPDATE_RULE_LSPA_PHI_HPP
+#define UPDATE_RULE_LSPA_PHI_HPP
+
+#include <sstream>
+#include <cassert>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/phi.h"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Log Sum Product Algorithm written with the phi(x) = -log(tanh(x/2)) function, 'PHI' is phi or one of its
+ * approximations (see Tools/Math/phi.h): phi_lut and phi_pwl trade some accuracy for the speed of the min-sum.
+ */
+template <typename R = float, proto_phi<R> PHI = phi_pwl>
+class Update_rule_LSPA_phi
+{
+protected:
+	const std::string name;
+	std::vector<R> values;
+	int sign;
+	R   sum;
+	int n_ite;
+	int ite;
+
+public:
+	explicit Update_rule_LSPA_phi(const unsigned max_chk_node_degree)
+	: name("LSPA"), values(max_chk_node_degree), sign(0), sum(0), n_ite(0), ite(0)
+	{
+		if (max_chk_node_degree == 0)
+		{
+			std::stringstream message;
+			message << "'max_chk_node_degree' has to greater than 0.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (!std::is_same<R, double>::value && !std::is_same<R, float>::value)
+		{
+			std::stringstream message;
+			message << "The 'LSPA' update rule supports only 'float' or 'double' datatypes.";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	virtual ~Update_rule_LSPA_phi()
+	{
+	}
+
+	std::string get_name() const
+	{
+		return this->name;
+	}
+
+	inline void begin_decoding(const int n_ite)
+	{
+		this->n_ite = n_ite;
+	}
+
+	inline void begin_ite(const int ite)
+	{
+		this->ite = ite;
+	}
+
+	// incoming values from the variable nodes into the check nodes
+	inline void begin_chk_node_in(const int chk_id, const int chk_degree)
+	{
+		assert(chk_degree <= (int)values.size());
+
+		this->sign = 0;
+		this->sum  = 0;
+	}
+
+	inline void compute_chk_node_in(const int var_id, const R var_val)
+	{
+		const auto res      = PHI((R)std::abs(var_val));
+		const auto var_sign = std::signbit((float)var_val) ? -1 : 0;
+
+		this->sign          ^= var_sign;
+		this->sum           += res;
+		this->values[var_id] = res;
+	}
+
+	inline void end_chk_node_in()
+	{
+	}
+
+	// outcomming values from the check nodes into the variable nodes
+	inline void begin_chk_node_out(const int chk_id, const int chk_degree)
+	{
+	}
+
+	inline R compute_chk_node_out(const int var_id, const R var_val)
+	{
+		// the rounding errors can give a small negative value
+		const auto res_abs = PHI(std::max((R)(this->sum - this->values[var_id]), (R)0));
+		const auto res_sgn = this->sign ^ (std::signbit((float)var_val) ? -1 : 0);
+
+		return (R)std::copysign(res_abs, res_sgn);
+	}
+
+	inline void end_chk_node_out()
+	{
+	}
+
+	inline void end_ite()
+	{
+	}
+
+	inline void end_decoding()
+	{
+	}
+};
+}
+}
+
+#endif /* UPDATE_RULE_LSPA_PHI_HPP */
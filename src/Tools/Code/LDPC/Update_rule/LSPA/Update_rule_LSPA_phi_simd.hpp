@@ -0,0 +1,129 @@
+#ifndef UPDATE_RULE_LSPA_PHI_SIMD_HPP
+#define UPDATE_RULE_LSPA_PHI_SIMD_HPP
+
+#include <sstream>
+#include <cassert>
+#include <vector>
+#include <string>
+#include <type_traits>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/phi.h"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * SIMD version of Update_rule_LSPA_phi (one frame per SIMD lane), 'PHI' is phi_i or one of its approximations.
+ */
+template <typename R = float, proto_phi_i<R> PHI = phi_pwl_i>
+class Update_rule_LSPA_phi_simd
+{
+protected:
+	const std::string name;
+	const mipp::Msk<mipp::N<R>()> false_msk;
+	const mipp::Reg<R> zero;
+	std::vector<mipp::Reg<R>> values;
+	mipp::Msk<mipp::N<R>()> sign;
+	mipp::Reg<R> sum;
+
+	int n_ite;
+	int ite;
+
+public:
+	explicit Update_rule_LSPA_phi_simd(const unsigned max_chk_node_degree)
+	: name("LSPA"), false_msk(false), zero((R)0), values(max_chk_node_degree), sign(false), sum(zero), n_ite(0),
+	  ite(0)
+	{
+		if (max_chk_node_degree == 0)
+		{
+			std::stringstream message;
+			message << "'max_chk_node_degree' has to greater than 0.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (!std::is_same<R, double>::value && !std::is_same<R, float>::value)
+		{
+			std::stringstream message;
+			message << "The 'LSPA' update rule supports only 'float' or 'double' datatypes.";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	virtual ~Update_rule_LSPA_phi_simd()
+	{
+	}
+
+	std::string get_name() const
+	{
+		return this->name;
+	}
+
+	// ----------------------------------------------------------------------------------------------------------------
+	// ----------------------------------------------------------------------------------------------------------------
+
+	inline void begin_decoding(const int n_ite)
+	{
+		this->n_ite = n_ite;
+	}
+
+	inline void begin_ite(const int ite)
+	{
+		this->ite = ite;
+	}
+
+	// incoming values from the variable nodes into the check nodes
+	inline void begin_chk_node_in(const int chk_id, const int chk_degree)
+	{
+		assert(chk_degree <= (int)this->values.size());
+
+		this->sign = this->false_msk;
+		this->sum  = this->zero;
+	}
+
+	inline void compute_chk_node_in(const int var_id, const mipp::Reg<R> var_val)
+	{
+		const auto res      = PHI(mipp::abs(var_val));
+		const auto var_sign = mipp::sign(var_val);
+
+		this->sign          ^= var_sign;
+		this->sum           += res;
+		this->values[var_id] = res;
+	}
+
+	inline void end_chk_node_in()
+	{
+	}
+
+	// outcomming values from the check nodes into the variable nodes
+	inline void begin_chk_node_out(const int chk_id, const int chk_degree)
+	{
+	}
+
+	inline mipp::Reg<R> compute_chk_node_out(const int var_id, const mipp::Reg<R> var_val)
+	{
+		// the rounding errors can give a small negative value
+		const auto res_abs = PHI(mipp::max(this->sum - this->values[var_id], this->zero));
+		const auto res_sgn = this->sign ^ mipp::sign(var_val);
+
+		return mipp::copysign(res_abs, res_sgn);
+	}
+
+	inline void end_chk_node_out()
+	{
+	}
+
+	inline void end_ite()
+	{
+	}
+
+	inline void end_decoding()
+	{
+	}
+};
+}
+}
+
+#endif /* UPDATE_RULE_LSPA_PHI_SIMD_HPP */
@@ -50,9 +50,6 @@ public:
 	explicit Update_rule_NMS_simd(const float normalize_factor)
 	: name("NMS"), normalize_factor(normalize_factor), MS()
 	{
-		if (sizeof(R) == 1)
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, "This update rule does not work in 8-bit fixed-point.");
-
 		if (typeid(R) == typeid(int16_t) || typeid(R) == typeid(int8_t))
 		{
 			bool error = false;
@@ -0,0 +1,130 @@
+#include <cmath>
+#include <cctype>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Generator_polar.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Generator_polar
+::Generator_polar(const int K, const int N, const std::vector<bool> &frozen_bits, const std::string &class_name,
+                  const std::string &fb_name)
+: K(K), N(N), m((int)std::log2(N)), frozen_bits(frozen_bits), class_name(class_name), fb_name(fb_name), parser()
+{
+	if (N <= 1 || (N & (N -1)) != 0)
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 greater than 1 ('N' = " << N << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << N << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto k = (int)std::count(frozen_bits.begin(), frozen_bits.end(), false);
+	if (K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = "
+		        << k << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+void Generator_polar
+::init_parser(std::vector<std::unique_ptr<Pattern_polar_i>> &&patterns, const int idx_r0, const int idx_r1)
+{
+	this->parser.reset(new Pattern_polar_parser(N, frozen_bits, std::move(patterns), idx_r0, idx_r1));
+}
+
+void Generator_polar
+::generate(std::ostream &stream)
+{
+	if (this->parser == nullptr)
+		throw runtime_error(__FILE__, __LINE__, __func__, "'parser' can't be null.");
+
+	auto guard = class_name + "_HPP_";
+	std::transform(guard.begin(), guard.end(), guard.begin(), [](unsigned char c) { return (char)std::toupper(c); });
+
+	stream << "// generated by the polar decoders generator, do not edit (see the AFF3CT_POLAR_GEN_* CMake options)"
+	       << std::endl;
+	stream << "#ifndef " << guard << std::endl;
+	stream << "#define " << guard << std::endl;
+	stream << std::endl;
+	stream << "#include <vector>"  << std::endl;
+	stream << "#include <string>"  << std::endl;
+	stream << "#include <sstream>" << std::endl;
+	stream << std::endl;
+	stream << "#include \"Tools/Exception/exception.hpp\"" << std::endl;
+	stream << "#include \"" << this->base_class_path() << "\"" << std::endl;
+	stream << std::endl;
+	stream << "namespace aff3ct"  << std::endl;
+	stream << "{"                 << std::endl;
+	stream << "namespace module"  << std::endl;
+	stream << "{"                 << std::endl;
+
+	this->generate_frozen_bits(stream);
+
+	stream << std::endl;
+	stream << "template <typename B, typename R, class API_polar>" << std::endl;
+	stream << "class " << class_name << " : public " << this->base_class_name() << "<B,R,API_polar>" << std::endl;
+	stream << "{" << std::endl;
+	stream << "public:" << std::endl;
+
+	this->generate_constructor(stream);
+
+	stream << std::endl;
+	stream << "\tvirtual ~" << class_name << "() = default;" << std::endl;
+	stream << std::endl;
+	stream << "protected:" << std::endl;
+
+	this->generate_decode(stream);
+
+	stream << "};" << std::endl;
+	stream << "}"  << std::endl;
+	stream << "}"  << std::endl;
+	stream << std::endl;
+	stream << "#endif /* " << guard << " */" << std::endl;
+}
+
+void Generator_polar
+::generate_frozen_bits(std::ostream &stream) const
+{
+	stream << "static const std::vector<bool> " << fb_name << " = {";
+	for (auto i = 0; i < N; i++)
+	{
+		if (i % 32 == 0) stream << std::endl << "\t";
+		stream << (frozen_bits[i] ? 1 : 0) << ((i < N -1) ? ", " : "");
+	}
+	stream << "};" << std::endl;
+}
+
+void Generator_polar
+::generate_checks(std::ostream &stream) const
+{
+	stream << "\t\tif (N != " << N << " || K != " << K << ")" << std::endl;
+	stream << "\t\t{" << std::endl;
+	stream << "\t\t\tstd::stringstream message;" << std::endl;
+	stream << "\t\t\tmessage << \"'N' has to be equal to " << N << " and 'K' has to be equal to " << K
+	       << " ('N' = \" << N << \", 'K' = \" << K << \").\";" << std::endl;
+	stream << "\t\t\tthrow tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());" << std::endl;
+	stream << "\t\t}" << std::endl;
+}
+
+bool Generator_polar
+::is_terminal(const polar_node_t node_type)
+{
+	return (node_type == polar_node_t::RATE_0) ||
+	       (node_type == polar_node_t::RATE_1) ||
+	       (node_type == polar_node_t::REP)    ||
+	       (node_type == polar_node_t::SPC);
+}
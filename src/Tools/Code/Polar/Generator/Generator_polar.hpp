@@ -0,0 +1,85 @@
+/*!
+ * \file
+ * \brief Generates the C++ source code of a polar decoder specialized (fully unrolled) for a given frozen bits set.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef GENERATOR_POLAR_HPP_
+#define GENERATOR_POLAR_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_i.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Generator_polar
+ * \brief Generates the C++ source code of a polar decoder specialized (fully unrolled) for a given frozen bits set.
+ *
+ * The polar tree is parsed with the same patterns as the decoder to specialize, then the tree traversal is written as
+ * a flat sequence of calls with constant offsets and sizes.
+ */
+class Generator_polar
+{
+protected:
+	const int               K;           /*!< Number of information bits in the frame. */
+	const int               N;           /*!< Codeword size. */
+	const int               m;           /*!< Tree depth. */
+	const std::vector<bool> frozen_bits; /*!< Vector of frozen bits (true if frozen, false otherwise). */
+	const std::string       class_name;  /*!< Name of the generated class. */
+	const std::string       fb_name;     /*!< Name of the generated frozen bits vector. */
+
+	std::unique_ptr<Pattern_polar_parser> parser;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param K:           number of information bits in the frame.
+	 * \param N:           codeword size.
+	 * \param frozen_bits: vector of frozen bits (true if frozen, false otherwise).
+	 * \param class_name:  name of the generated class.
+	 * \param fb_name:     name of the generated frozen bits vector.
+	 */
+	Generator_polar(const int K, const int N, const std::vector<bool> &frozen_bits, const std::string &class_name,
+	                const std::string &fb_name);
+
+	virtual ~Generator_polar() = default;
+
+	/*!
+	 * \brief Writes the header file of the specialized decoder.
+	 *
+	 * \param stream: the output stream.
+	 */
+	void generate(std::ostream &stream);
+
+protected:
+	/*!
+	 * \brief Parses the polar tree with the patterns of the decoder to specialize (has to be called by the
+	 *        constructors of the sub-classes).
+	 */
+	void init_parser(std::vector<std::unique_ptr<Pattern_polar_i>> &&patterns, const int idx_r0, const int idx_r1);
+
+	virtual std::string base_class_name() const = 0;
+	virtual std::string base_class_path() const = 0;
+
+	virtual void generate_constructor(std::ostream &stream) const = 0;
+	virtual void generate_decode     (std::ostream &stream) const = 0;
+
+	void generate_frozen_bits(std::ostream &stream) const;
+	void generate_checks     (std::ostream &stream) const;
+
+	static bool is_terminal(const polar_node_t node_type);
+};
+}
+}
+
+#endif /* GENERATOR_POLAR_HPP_ */
@@ -0,0 +1,258 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
+
+#include "Generator_polar_SCL_sys.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Generator_polar_SCL_sys
+::Generator_polar_SCL_sys(const int K, const int N, const std::vector<bool> &frozen_bits,
+                          const std::string &class_name, const std::string &fb_name)
+: Generator_polar(K, N, frozen_bits, class_name, fb_name)
+{
+	// same patterns as in the Decoder_polar_SCL_fast_sys constructor
+	std::vector<std::unique_ptr<Pattern_polar_i>> patterns;
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_std       ));
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_r0        ));
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_r1        ));
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_r0_left   ));
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_rep_left  ));
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_rep       ));
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_spc(2, 2)));
+
+	this->init_parser(std::move(patterns), 1, 2);
+
+	if (is_terminal(this->parser->get_node_type(0)))
+	{
+		std::stringstream message;
+		message << "The root node can't be a terminal pattern in the SCL decoder ('K' = " << K << ", 'N' = " << N
+		        << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+std::string Generator_polar_SCL_sys
+::base_class_name() const
+{
+	return "Decoder_polar_SCL_fast_CA_sys";
+}
+
+std::string Generator_polar_SCL_sys
+::base_class_path() const
+{
+	return "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp";
+}
+
+void Generator_polar_SCL_sys
+::generate_constructor(std::ostream &stream) const
+{
+	stream << "\t" << class_name << "(const int& K, const int& N, const int& L, CRC<B>& crc, const int n_frames = 1)"
+	       << std::endl;
+	stream << "\t: Decoder(K, N, n_frames, API_polar::get_n_frames())," << std::endl;
+	stream << "\t  Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>(K, N, L, " << fb_name << ", crc, n_frames)"
+	       << std::endl;
+	stream << "\t{" << std::endl;
+	stream << "\t\tconst std::string name = \"" << class_name << "\";" << std::endl;
+	stream << "\t\tthis->set_name(name);" << std::endl;
+	stream << std::endl;
+	this->generate_checks(stream);
+	stream << "\t}" << std::endl;
+}
+
+void Generator_polar_SCL_sys
+::generate_decode(std::ostream &stream) const
+{
+	stream << "\tvoid _decode(const R *Y_N)" << std::endl;
+	stream << "\t{" << std::endl;
+	stream << "\t\tauto &l = this->l;" << std::endl;
+	stream << "\t\tauto &s = this->s;" << std::endl;
+	stream << std::endl;
+
+	int node_id = 0;
+	this->recursive_generate(stream, 0, 0, m, node_id);
+
+	stream << "\t}" << std::endl;
+}
+
+void Generator_polar_SCL_sys
+::recursive_generate(std::ostream &stream, const int off_l, const int off_s, const int rev_depth, int &node_id) const
+{
+	// this is the traversal of the Decoder_polar_SCL_fast_sys::recursive_decode method
+	const int n_elmts = 1 << rev_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = parser->get_node_type(node_id);
+
+	const auto n     = std::to_string(n_elm_2);
+	const auto rd    = std::to_string(rev_depth);
+	const auto rd_m1 = std::to_string(rev_depth -1);
+	const auto s_a   = std::to_string(off_s);
+	const auto s_b   = std::to_string(off_s + n_elm_2);
+
+	const auto api = std::string("API_polar::template ");
+
+	auto loop_begin = [&](const bool with_parent)
+	{
+		stream << "\t\tfor (auto i = 0; i < this->n_active_paths; i++)" << std::endl;
+		stream << "\t\t{" << std::endl;
+		stream << "\t\t\tconst auto path   = this->paths[i];" << std::endl;
+		if (with_parent)
+			stream << "\t\t\tconst auto parent = l[this->path_2_array[path][" << rd << "]].data();" << std::endl;
+		stream << "\t\t\tconst auto child  = l[this->up_ref_array_idx(path, " << rd_m1 << ")].data();" << std::endl;
+	};
+
+	auto loop_end = [&]()
+	{
+		stream << "\t\t}" << std::endl;
+	};
+
+	auto xor_loop = [&]()
+	{
+		switch (node_type)
+		{
+			case polar_node_t::STANDARD:
+			case polar_node_t::REP_LEFT:
+				stream << "\t\tfor (auto i = 0; i < this->n_active_paths; i++)" << std::endl;
+				stream << "\t\t\t" << api << "xo <" << n << ">(s[this->paths[i]], " << s_a << ", " << s_b << ", "
+				       << s_a << ", " << n << ");" << std::endl;
+				break;
+			case polar_node_t::RATE_0_LEFT:
+				stream << "\t\tfor (auto i = 0; i < this->n_active_paths; i++)" << std::endl;
+				stream << "\t\t\t" << api << "xo0<" << n << ">(s[this->paths[i]], " << s_b << ", " << s_a << ", "
+				       << n << ");" << std::endl;
+				break;
+			default:
+				break;
+		}
+	};
+
+	if (rev_depth == m) // root node
+	{
+		// f
+		switch (node_type)
+		{
+			case polar_node_t::STANDARD:
+			case polar_node_t::REP_LEFT:
+				stream << "\t\t" << api << "f  <" << n << ">(Y_N, Y_N + " << n << ", l[0].data(), " << n << ");"
+				       << std::endl;
+				break;
+			default:
+				break;
+		}
+
+		this->recursive_generate(stream, off_l, off_s, rev_depth -1, ++node_id); // recursive call left
+
+		// g
+		switch (node_type)
+		{
+			case polar_node_t::STANDARD:
+				loop_begin(false);
+				stream << "\t\t\t" << api << "g  <" << n << ">(Y_N, Y_N + " << n << ", s[path].data() + " << s_a
+				       << ", child, " << n << ");" << std::endl;
+				loop_end();
+				break;
+			case polar_node_t::RATE_0_LEFT:
+				loop_begin(false);
+				stream << "\t\t\t" << api << "g0 <" << n << ">(Y_N, Y_N + " << n << ", child, " << n << ");"
+				       << std::endl;
+				loop_end();
+				break;
+			case polar_node_t::REP_LEFT:
+				loop_begin(false);
+				stream << "\t\t\t" << api << "gr <" << n << ">(Y_N, Y_N + " << n << ", s[path].data() + " << s_a
+				       << ", child, " << n << ");" << std::endl;
+				loop_end();
+				break;
+			default:
+				break;
+		}
+
+		this->recursive_generate(stream, off_l, off_s + n_elm_2, rev_depth -1, ++node_id); // recursive call right
+
+		xor_loop();
+	}
+	else if (!is_terminal(node_type) && rev_depth) // other node (not root or leaf)
+	{
+		const auto l_a = std::to_string(off_l);
+		const auto l_b = std::to_string(off_l + n_elm_2);
+		const auto l_c = std::to_string(off_l + n_elmts);
+
+		// f
+		if (node_type == polar_node_t::STANDARD ||
+		    node_type == polar_node_t::REP_LEFT ||
+		    node_type == polar_node_t::RATE_0_LEFT)
+		{
+			if (node_type == polar_node_t::RATE_0_LEFT)
+				stream << "\t\tif (this->n_active_paths > 1)" << std::endl;
+			loop_begin(true);
+			stream << "\t\t\t" << api << "f  <" << n << ">(parent + " << l_a << ", parent + " << l_b
+			       << ", child + " << l_c << ", " << n << ");" << std::endl;
+			loop_end();
+		}
+
+		this->recursive_generate(stream, off_l + n_elmts, off_s, rev_depth -1, ++node_id); // recursive call left
+
+		// g
+		switch (node_type)
+		{
+			case polar_node_t::STANDARD:
+				loop_begin(true);
+				stream << "\t\t\t" << api << "g  <" << n << ">(parent + " << l_a << ", parent + " << l_b
+				       << ", s[path].data() + " << s_a << ", child + " << l_c << ", " << n << ");" << std::endl;
+				loop_end();
+				break;
+			case polar_node_t::RATE_0_LEFT:
+				loop_begin(true);
+				stream << "\t\t\t" << api << "g0 <" << n << ">(parent + " << l_a << ", parent + " << l_b
+				       << ", child + " << l_c << ", " << n << ");" << std::endl;
+				loop_end();
+				break;
+			case polar_node_t::REP_LEFT:
+				loop_begin(true);
+				stream << "\t\t\t" << api << "gr <" << n << ">(parent + " << l_a << ", parent + " << l_b
+				       << ", s[path].data() + " << s_a << ", child + " << l_c << ", " << n << ");" << std::endl;
+				loop_end();
+				break;
+			default:
+				break;
+		}
+
+		this->recursive_generate(stream, off_l + n_elmts, off_s + n_elm_2, rev_depth -1, ++node_id); // call right
+
+		xor_loop();
+	}
+	else // leaf node
+	{
+		const auto l_a = std::to_string(off_l);
+		const auto n_l = std::to_string(n_elmts);
+
+		// h
+		std::string update;
+		switch (node_type)
+		{
+			case polar_node_t::RATE_0: update = "update_paths_r0 "; break;
+			case polar_node_t::REP:    update = "update_paths_rep"; break;
+			case polar_node_t::RATE_1: update = "update_paths_r1 "; break;
+			case polar_node_t::SPC:    update = "update_paths_spc"; break;
+			default:
+				break;
+		}
+
+		if (!update.empty())
+			stream << "\t\tthis->template " << update << "<" << rd << ", " << n_l << ">(" << l_a << ", " << s_a
+			       << ");" << std::endl;
+
+		stream << "\t\tnormalize_scl_metrics<R>(this->metrics, this->L);" << std::endl;
+	}
+}
@@ -0,0 +1,43 @@
+/*!
+ * \file
+ * \brief Generates a Decoder_polar_SCL_fast_CA_sys specialized (fully unrolled) for a given frozen bits set.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef GENERATOR_POLAR_SCL_SYS_HPP_
+#define GENERATOR_POLAR_SCL_SYS_HPP_
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "Generator_polar.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+class Generator_polar_SCL_sys : public Generator_polar
+{
+public:
+	Generator_polar_SCL_sys(const int K, const int N, const std::vector<bool> &frozen_bits,
+	                        const std::string &class_name, const std::string &fb_name);
+
+	virtual ~Generator_polar_SCL_sys() = default;
+
+protected:
+	std::string base_class_name() const;
+	std::string base_class_path() const;
+
+	void generate_constructor(std::ostream &stream) const;
+	void generate_decode     (std::ostream &stream) const;
+
+private:
+	void recursive_generate(std::ostream &stream, const int off_l, const int off_s, const int rev_depth,
+	                        int &node_id) const;
+};
+}
+}
+
+#endif /* GENERATOR_POLAR_SCL_SYS_HPP_ */
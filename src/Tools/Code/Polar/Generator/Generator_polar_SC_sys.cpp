@@ -0,0 +1,171 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
+
+#include "Generator_polar_SC_sys.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Generator_polar_SC_sys
+::Generator_polar_SC_sys(const int K, const int N, const std::vector<bool> &frozen_bits,
+                         const std::string &class_name, const std::string &fb_name)
+: Generator_polar(K, N, frozen_bits, class_name, fb_name)
+{
+	// same patterns as in the Decoder_polar_SC_fast_sys constructor
+	std::vector<std::unique_ptr<Pattern_polar_i>> patterns;
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_std     ));
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_r0_left ));
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_r0      ));
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_r1      ));
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_rep_left));
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_rep     ));
+	patterns.push_back(std::unique_ptr<Pattern_polar_i>(new Pattern_polar_spc     ));
+
+	this->init_parser(std::move(patterns), 2, 3);
+}
+
+std::string Generator_polar_SC_sys
+::base_class_name() const
+{
+	return "Decoder_polar_SC_fast_sys";
+}
+
+std::string Generator_polar_SC_sys
+::base_class_path() const
+{
+	return "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp";
+}
+
+void Generator_polar_SC_sys
+::generate_constructor(std::ostream &stream) const
+{
+	stream << "\t" << class_name << "(const int& K, const int& N, const int n_frames = 1)" << std::endl;
+	stream << "\t: Decoder(K, N, n_frames, API_polar::get_n_frames())," << std::endl;
+	stream << "\t  Decoder_polar_SC_fast_sys<B,R,API_polar>(K, N, " << fb_name << ", n_frames)" << std::endl;
+	stream << "\t{" << std::endl;
+	stream << "\t\tconst std::string name = \"" << class_name << "\";" << std::endl;
+	stream << "\t\tthis->set_name(name);" << std::endl;
+	stream << std::endl;
+	this->generate_checks(stream);
+	stream << "\t}" << std::endl;
+}
+
+void Generator_polar_SC_sys
+::generate_decode(std::ostream &stream) const
+{
+	stream << "\tvoid _decode()" << std::endl;
+	stream << "\t{" << std::endl;
+	stream << "\t\tauto &l = this->l;" << std::endl;
+	stream << "\t\tauto &s = this->s;" << std::endl;
+	stream << std::endl;
+
+	int node_id = 0;
+	this->recursive_generate(stream, 0, 0, m, node_id);
+
+	stream << "\t}" << std::endl;
+}
+
+void Generator_polar_SC_sys
+::recursive_generate(std::ostream &stream, const int off_l, const int off_s, const int rev_depth, int &node_id) const
+{
+	// this is the traversal of the Decoder_polar_SC_fast_sys::recursive_decode method
+	const int n_elmts = 1 << rev_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = parser->get_node_type(node_id);
+
+	const auto api = std::string("\t\tAPI_polar::template ");
+
+	if (!is_terminal(node_type) && rev_depth)
+	{
+		const auto l_a = std::to_string(off_l);
+		const auto l_b = std::to_string(off_l + n_elm_2);
+		const auto l_c = std::to_string(off_l + n_elmts);
+		const auto s_a = std::to_string(off_s);
+		const auto s_b = std::to_string(off_s + n_elm_2);
+		const auto n   = std::to_string(n_elm_2);
+
+		// f
+		switch (node_type)
+		{
+			case polar_node_t::STANDARD:
+			case polar_node_t::REP_LEFT:
+				stream << api << "f  <" << n << ">(   l, " << l_a << ", " << l_b << ", " << l_c << ", " << n << ");"
+				       << std::endl;
+				break;
+			default:
+				break;
+		}
+
+		this->recursive_generate(stream, off_l + n_elmts, off_s, rev_depth -1, ++node_id); // recursive call left
+
+		// g
+		switch (node_type)
+		{
+			case polar_node_t::STANDARD:
+				stream << api << "g  <" << n << ">(s, l, " << l_a << ", " << l_b << ", " << s_a << ", " << l_c
+				       << ", " << n << ");" << std::endl;
+				break;
+			case polar_node_t::RATE_0_LEFT:
+				stream << api << "g0 <" << n << ">(   l, " << l_a << ", " << l_b << ", " << l_c << ", " << n << ");"
+				       << std::endl;
+				break;
+			case polar_node_t::REP_LEFT:
+				stream << api << "gr <" << n << ">(s, l, " << l_a << ", " << l_b << ", " << s_a << ", " << l_c
+				       << ", " << n << ");" << std::endl;
+				break;
+			default:
+				break;
+		}
+
+		this->recursive_generate(stream, off_l + n_elmts, off_s + n_elm_2, rev_depth -1, ++node_id); // call right
+
+		// xor
+		switch (node_type)
+		{
+			case polar_node_t::STANDARD:
+			case polar_node_t::REP_LEFT:
+				stream << api << "xo <" << n << ">(s, " << s_a << ", " << s_b << ", " << s_a << ", " << n << ");"
+				       << std::endl;
+				break;
+			case polar_node_t::RATE_0_LEFT:
+				stream << api << "xo0<" << n << ">(s, " << s_b << ", " << s_a << ", " << n << ");" << std::endl;
+				break;
+			default:
+				break;
+		}
+	}
+	else
+	{
+		const auto l_a = std::to_string(off_l);
+		const auto s_a = std::to_string(off_s);
+		const auto n   = std::to_string(n_elmts);
+
+		// h
+		switch (node_type)
+		{
+			case polar_node_t::RATE_0:
+				stream << api << "h0 <" << n << ">(s, " << s_a << ", " << n << ");" << std::endl;
+				break;
+			case polar_node_t::RATE_1:
+				stream << api << "h  <" << n << ">(s, l, " << l_a << ", " << s_a << ", " << n << ");" << std::endl;
+				break;
+			case polar_node_t::REP:
+				stream << api << "rep<" << n << ">(s, l, " << l_a << ", " << s_a << ", " << n << ");" << std::endl;
+				break;
+			case polar_node_t::SPC:
+				stream << api << "spc<" << n << ">(s, l, " << l_a << ", " << s_a << ", " << n << ");" << std::endl;
+				break;
+			default:
+				break;
+		}
+	}
+}
@@ -9,32 +9,38 @@ using namespace aff3ct;
 using namespace aff3ct::tools;
 
 void Statistics
-::separation1(std::ostream &stream)
+::separation1(const bool hw, std::ostream &stream)
 {
-	stream << "# " << rang::style::bold << "-------------------------------------------||------------------------------||--------------------------------||--------------------------------" << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << "-------------------------------------------||------------------------------||--------------------------------||--------------------------------";
+	if (hw)
+		stream << "||-----------------------------------------------------------------";
+	stream << rang::style::reset << std::endl;
 }
 
 void Statistics
-::separation2(std::ostream &stream)
+::separation2(const bool hw, std::ostream &stream)
 {
-	stream << "# " << rang::style::bold << "-------------|-------------------|---------||----------|----------|--------||----------|----------|----------||----------|----------|----------" << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << "-------------|-------------------|---------||----------|----------|--------||----------|----------|----------||----------|----------|----------";
+	if (hw)
+		stream << "||----------|----------|----------|----------|----------|----------";
+	stream << rang::style::reset << std::endl;
 }
 
 void Statistics
-::show_header(std::ostream &stream)
+::show_header(const bool hw, std::ostream &stream)
 {
-	Statistics::separation1(stream);
+	Statistics::separation1(hw, stream);
 //	stream << "# " << rang::style::bold << "-------------------------------------------||------------------------------||--------------------------------||--------------------------------" << rang::style::reset << std::endl;
-	stream << "# " << rang::style::bold << "       Statistics for the given task       ||       Basic statistics       ||       Measured throughput      ||        Measured latency        " << rang::style::reset << std::endl;
-	stream << "# " << rang::style::bold << "    ('*' = any, '-' = same as previous)    ||          on the task         ||   considering the last socket  ||   considering the last socket  " << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << "       Statistics for the given task       ||       Basic statistics       ||       Measured throughput      ||        Measured latency        " << (hw ? "||                        Hardware counters                        " : "") << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << "    ('*' = any, '-' = same as previous)    ||          on the task         ||   considering the last socket  ||   considering the last socket  " << (hw ? "||                   average per call of the task                  " : "") << rang::style::reset << std::endl;
 //	stream << "# " << rang::style::bold << "-------------------------------------------||------------------------------||--------------------------------||--------------------------------" << rang::style::reset << std::endl;
-	Statistics::separation1(stream);
-	Statistics::separation2(stream);
+	Statistics::separation1(hw, stream);
+	Statistics::separation2(hw, stream);
 //	stream << "# " << rang::style::bold << "-------------|-------------------|---------||----------|----------|--------||----------|----------|----------||----------|----------|----------" << rang::style::reset << std::endl;
-	stream << "# " << rang::style::bold << "      MODULE |              TASK |   TIMER ||    CALLS |     TIME |   PERC ||  AVERAGE |  MINIMUM |  MAXIMUM ||  AVERAGE |  MINIMUM |  MAXIMUM " << rang::style::reset << std::endl;
-	stream << "# " << rang::style::bold << "             |                   |         ||          |      (s) |    (%) ||   (Mb/s) |   (Mb/s) |   (Mb/s) ||     (us) |     (us) |     (us) " << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << "      MODULE |              TASK |   TIMER ||    CALLS |     TIME |   PERC ||  AVERAGE |  MINIMUM |  MAXIMUM ||  AVERAGE |  MINIMUM |  MAXIMUM " << (hw ? "||   CYCLES |   INSTR. |      IPC | L1D MISS | LLC MISS | BR. MISS " : "") << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << "             |                   |         ||          |      (s) |    (%) ||   (Mb/s) |   (Mb/s) |   (Mb/s) ||     (us) |     (us) |     (us) " << (hw ? "||          |          |          |          |          |          " : "") << rang::style::reset << std::endl;
 //	stream << "# " << rang::style::bold << "-------------|-------------------|---------||----------|----------|--------||----------|----------|----------||----------|----------|----------" << rang::style::reset << std::endl;
-	Statistics::separation2(stream);
+	Statistics::separation2(hw, stream);
 }
 
 void Statistics
@@ -46,6 +52,8 @@ void Statistics
             const std::chrono::nanoseconds task_tot_duration,
             const std::chrono::nanoseconds task_min_duration,
             const std::chrono::nanoseconds task_max_duration,
+            const Perf_counters::Values   *task_hw_counters,
+            const uint32_t                 task_hw_n_calls,
                   std::ostream             &stream)
 {
 	if (task_n_calls == 0)
@@ -105,8 +113,12 @@ void Statistics
 	       << ssmax_thr.str() << rang::style::bold << " || " << rang::style::reset
 	       << ssavg_lat.str() << rang::style::bold << " | "  << rang::style::reset
 	       << ssmin_lat.str() << rang::style::bold << " | "  << rang::style::reset
-	       << ssmax_lat.str() << ""
-	       << std::endl;
+	       << ssmax_lat.str() << "";
+
+	if (task_hw_counters != nullptr)
+		Statistics::show_hw_counters(task_hw_n_calls, task_hw_counters, stream);
+
+	stream << std::endl;
 }
 
 void Statistics
@@ -118,6 +130,7 @@ void Statistics
              const std::chrono::nanoseconds timer_tot_duration,
              const std::chrono::nanoseconds timer_min_duration,
              const std::chrono::nanoseconds timer_max_duration,
+             const bool                     hw,
                    std::ostream             &stream)
 {
 	if (task_n_calls == 0 || timer_n_calls == 0)
@@ -171,8 +184,53 @@ void Statistics
 	       << rang::style::italic << ssrmax_thr.str() << rang::style::reset << rang::style::bold << " || " << rang::style::reset
 	       << rang::style::italic << ssravg_lat.str() << rang::style::reset << rang::style::bold << " | "  << rang::style::reset
 	       << rang::style::italic << ssrmin_lat.str() << rang::style::reset << rang::style::bold << " | "  << rang::style::reset
-	       << rang::style::italic << ssrmax_lat.str() << rang::style::reset << ""
-	       << std::endl;
+	       << rang::style::italic << ssrmax_lat.str() << rang::style::reset << "";
+
+	// the hardware counters are only measured on the whole task
+	if (hw)
+		Statistics::show_hw_counters(timer_n_calls, nullptr, stream);
+
+	stream << std::endl;
+}
+
+void Statistics
+::show_hw_counters(const uint32_t               n_calls,
+                   const Perf_counters::Values *hw_counters,
+                         std::ostream          &stream)
+{
+	using PC = Perf_counters;
+
+#ifdef _WIN32
+	auto P = 1;
+#else
+	auto P = 2;
+#endif
+
+	float l2 = 99999.99f;
+
+	std::vector<float> values;
+	if (hw_counters != nullptr && n_calls)
+	{
+		auto &hw = *hw_counters;
+		values.push_back((float)hw[PC::CYCLES       ] / n_calls);
+		values.push_back((float)hw[PC::INSTRUCTIONS ] / n_calls);
+		values.push_back(hw[PC::CYCLES] ? (float)hw[PC::INSTRUCTIONS] / (float)hw[PC::CYCLES] : 0.f);
+		values.push_back((float)hw[PC::L1D_MISSES   ] / n_calls);
+		values.push_back((float)hw[PC::LLC_MISSES   ] / n_calls);
+		values.push_back((float)hw[PC::BRANCH_MISSES] / n_calls);
+	}
+
+	for (size_t v = 0; v < 6; v++)
+	{
+		std::stringstream ssvalue;
+		if (values.empty())
+			ssvalue << std::setw(8) << "-";
+		else
+			ssvalue << std::setprecision(values[v] > l2 ? P : 2) << (values[v] > l2 ? std::scientific : std::fixed)
+			        << std::setw(8) << values[v];
+
+		stream << rang::style::bold << (v == 0 ? " || " : " | ") << rang::style::reset << ssvalue.str();
+	}
 }
 
 void Statistics
@@ -207,13 +265,25 @@ void Statistics
 	auto ttask_min_duration = std::chrono::nanoseconds(0);
 	auto ttask_max_duration = std::chrono::nanoseconds(0);
 
+	auto hw = false;
+	Perf_counters::Values ttask_hw_counters;
+	ttask_hw_counters.fill(0);
+
+	// the counters of each task are extrapolated to all its calls, to be averaged over the calls of the TOTAL line
 	for (auto *t : tasks)
+	{
 		ttask_tot_duration += t->get_duration_total();
+		hw |= t->is_hw_counters();
+		if (t->get_hw_n_calls())
+			for (size_t e = 0; e < ttask_hw_counters.size(); e++)
+				ttask_hw_counters[e] += (uint64_t)((double)t->get_hw_counters()[e] * (double)t->get_n_calls() /
+				                                   (double)t->get_hw_n_calls());
+	}
 	auto total_sec = ((float)ttask_tot_duration.count()) * 0.000000001f;
 
 	if (ttask_tot_duration.count())
 	{
-		Statistics::show_header(stream);
+		Statistics::show_header(hw, stream);
 
 		size_t   ttask_n_elmts = 0;
 		uint32_t ttask_n_calls = 0;
@@ -254,7 +324,8 @@ void Statistics
 			ttask_max_duration += (task_max_duration * task_n_calls) / ttask_n_calls;
 
 			Statistics::show_task(total_sec, module_sname, task_name, task_n_elmts, task_n_calls,
-			                      task_tot_duration, task_min_duration, task_max_duration, stream);
+			                      task_tot_duration, task_min_duration, task_max_duration,
+			                      hw ? &t->get_hw_counters() : nullptr, t->get_hw_n_calls(), stream);
 
 			auto task_total_sec = ((float)task_tot_duration.count()) * 0.000000001f;
 
@@ -269,13 +340,14 @@ void Statistics
 			{
 				Statistics::show_timer(task_total_sec, task_n_calls, timers_n_elmts,
 				                       timers_name[i], timers_n_calls[i], timers_tot_duration[i],
-				                       timers_min_duration[i], timers_max_duration[i], stream);
+				                       timers_min_duration[i], timers_max_duration[i], hw, stream);
 			}
 		}
-		Statistics::separation2(stream);
+		Statistics::separation2(hw, stream);
 
 		Statistics::show_task(total_sec, "TOTAL", "*", ttask_n_elmts, ttask_n_calls,
-		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration, stream);
+		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration,
+		                      hw ? &ttask_hw_counters : nullptr, ttask_n_calls, stream);
 	}
 	else
 	{
@@ -289,17 +361,22 @@ void Statistics
 {
 	std::vector<std::vector<const module::Task*>> tasks;
 	for (auto &vm : modules)
-		if (vm.size() > 0 && vm[0] != nullptr)
+	{
+		// some threads may not build the module (the pipeline stages for instance)
+		auto m0 = std::find_if(vm.begin(), vm.end(), [](const module::Module *m) { return m != nullptr; });
+		if (m0 != vm.end())
 		{
-			auto &tasks0 = vm[0]->tasks;
+			auto &tasks0 = (*m0)->tasks;
 			for (size_t t = 0; t < tasks0.size(); t++)
 			{
 				std::vector<const module::Task*> tsk;
 				for (auto& m : vm)
-					tsk.push_back(m->tasks[t].get());
+					if (m != nullptr)
+						tsk.push_back(m->tasks[t].get());
 				tasks.push_back(tsk);
 			}
 		}
+	}
 
 	Statistics::show(tasks, ordered, stream);
 }
@@ -333,14 +410,26 @@ void Statistics
 	auto ttask_min_duration = nanoseconds(0);
 	auto ttask_max_duration = nanoseconds(0);
 
+	auto hw = false;
+	Perf_counters::Values ttask_hw_counters;
+	ttask_hw_counters.fill(0);
+
+	// the counters of each task are extrapolated to all its calls, to be averaged over the calls of the TOTAL line
 	for (auto &vt : tasks)
 		for (auto *t : vt)
+		{
 			ttask_tot_duration += t->get_duration_total();
+			hw |= t->is_hw_counters();
+			if (t->get_hw_n_calls())
+				for (size_t e = 0; e < ttask_hw_counters.size(); e++)
+					ttask_hw_counters[e] += (uint64_t)((double)t->get_hw_counters()[e] * (double)t->get_n_calls() /
+					                                   (double)t->get_hw_n_calls());
+		}
 	auto total_sec = ((float)ttask_tot_duration.count()) * 0.000000001f;
 
 	if (ttask_tot_duration.count())
 	{
-		Statistics::show_header(stream);
+		Statistics::show_header(hw, stream);
 
 		size_t ttask_n_elmts = 0;
 		auto   ttask_n_calls = 0;
@@ -379,20 +468,26 @@ void Statistics
 			auto task_tot_duration = nanoseconds(0);
 			auto task_min_duration = ttask_tot_duration;
 			auto task_max_duration = nanoseconds(0);
+			auto task_hw_counters  = Perf_counters::Values();
+			auto task_hw_n_calls   = 0u;
 
 			for (auto *t : vt)
 			{
 				task_n_calls      += t->get_n_calls();
+				task_hw_n_calls   += t->get_hw_n_calls();
 				task_tot_duration += t->get_duration_total();
 				task_min_duration  = std::min(task_min_duration, t->get_duration_min());
 				task_max_duration  = std::max(task_max_duration, t->get_duration_max());
+				for (size_t e = 0; e < task_hw_counters.size(); e++)
+					task_hw_counters[e] += t->get_hw_counters()[e];
 			}
 
 			ttask_min_duration += (task_min_duration * task_n_calls) / ttask_n_calls;
 			ttask_max_duration += (task_max_duration * task_n_calls) / ttask_n_calls;
 
 			Statistics::show_task(total_sec, module_sname, task_name, task_n_elmts, task_n_calls,
-			                      task_tot_duration, task_min_duration, task_max_duration, stream);
+			                      task_tot_duration, task_min_duration, task_max_duration,
+			                      hw ? &task_hw_counters : nullptr, task_hw_n_calls, stream);
 
 			auto task_total_sec = ((float)task_tot_duration.count()) * 0.000000001f;
 
@@ -415,13 +510,14 @@ void Statistics
 
 				Statistics::show_timer(task_total_sec, task_n_calls, timers_n_elmts,
 				                       timers_name[tn], timers_n_calls[tn], timers_tot_duration[tn],
-				                       timers_min_duration[tn], timers_max_duration[tn], stream);
+				                       timers_min_duration[tn], timers_max_duration[tn], hw, stream);
 			}
 		}
-		Statistics::separation2(stream);
+		Statistics::separation2(hw, stream);
 
 		Statistics::show_task(total_sec, "TOTAL", "*", ttask_n_elmts, ttask_n_calls,
-		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration, stream);
+		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration,
+		                      hw ? &ttask_hw_counters : nullptr, ttask_n_calls, stream);
 	}
 	else
 	{
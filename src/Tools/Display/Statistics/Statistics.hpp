@@ -3,6 +3,7 @@
 
 #include "Module/Module.hpp"
 #include "Module/Task.hpp"
+#include "Tools/Perf/Counters/Perf_counters.hpp"
 
 #include <vector>
 #include <iostream>
@@ -30,11 +31,11 @@ public:
 	                 std::ostream &stream = std::cout);
 
 private:
-	static void separation1(std::ostream &stream = std::cout);
+	static void separation1(const bool hw = false, std::ostream &stream = std::cout);
 
-	static void separation2(std::ostream &stream = std::cout);
+	static void separation2(const bool hw = false, std::ostream &stream = std::cout);
 
-	static void show_header(std::ostream &stream = std::cout);
+	static void show_header(const bool hw = false, std::ostream &stream = std::cout);
 
 	static void show_task(const float                    total_sec,
 	                      const std::string&             module_sname,
@@ -44,6 +45,8 @@ private:
 	                      const std::chrono::nanoseconds task_tot_duration,
 	                      const std::chrono::nanoseconds task_min_duration,
 	                      const std::chrono::nanoseconds task_max_duration,
+	                      const Perf_counters::Values   *task_hw_counters = nullptr,
+	                      const uint32_t                 task_hw_n_calls = 0,
 	                            std::ostream             &stream = std::cout);
 
 	static void show_timer(const float                    total_sec,
@@ -54,7 +57,12 @@ private:
 	                       const std::chrono::nanoseconds timer_tot_duration,
 	                       const std::chrono::nanoseconds timer_min_duration,
 	                       const std::chrono::nanoseconds timer_max_duration,
+	                       const bool                     hw = false,
 	                             std::ostream             &stream = std::cout);
+
+	static void show_hw_counters(const uint32_t               n_calls,
+	                             const Perf_counters::Values *hw_counters,
+	                                   std::ostream          &stream = std::cout);
 };
 
 using Stats = Statistics;
@@ -45,6 +45,9 @@ template <typename R> __forceinline mipp::Reg<R> max_star_i  (const mipp::Reg<R>
 template <typename R> __forceinline mipp::Reg<R> min_i             (const mipp::Reg<R> a, const mipp::Reg<R> b);
 template <typename R> __forceinline mipp::Reg<R> min_star_linear2_i(const mipp::Reg<R> a, const mipp::Reg<R> b);
 template <typename R> __forceinline mipp::Reg<R> min_star_i        (const mipp::Reg<R> a, const mipp::Reg<R> b);
+
+template <typename R> __forceinline mipp::Reg<R> min_star_linear2_fix_i(const mipp::Reg<R> a, const mipp::Reg<R> b,
+                                                                        const int n_decimals);
 }
 }
 
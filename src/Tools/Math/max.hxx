@@ -1,5 +1,6 @@
 #include <cmath>     // min(), fabs(), copysign()...
 #include <algorithm> // min()
+#include <limits>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -136,6 +137,63 @@ inline mipp::Reg<R> min_star_linear2_i(const mipp::Reg<R> a, const mipp::Reg<R>
 	return mipp::min(a, b) + correction_linear2_i(a + b) - correction_linear2_i(mipp::abs(a - b));
 }
 
+// fixed-point version of the linear correction (the float coefficients would be truncated to 0): for LLRs quantized
+// with 'n_decimals' fractional bits, c(x) ~= max(0, (3 - x) / 4) becomes max(0, (3 * 2^n_decimals - x_q) / 4), the
+// computations are saturated (a min star can be initialized with the largest value of the type)
+template <typename R>
+inline mipp::Reg<R> min_star_linear2_fix_i(const mipp::Reg<R> a, const mipp::Reg<R> b, const int n_decimals)
+{
+	// the operands are clamped to the point where the correction is zero so that 'a + b' cannot overflow
+	const auto zero  = mipp::Reg<R>((R)0);
+	const auto three = mipp::Reg<R>((R)(3 << n_decimals));
+
+	const auto c_sum  = mipp::max(zero, three - (mipp::min(a, three) + mipp::min(b, three))) >> 2;
+	const auto c_diff = mipp::max(zero, three - (mipp::max(a, b) - mipp::min(a, b))) >> 2;
+	return mipp::min(a, b) + c_sum - c_diff;
+}
+
+// in floating-point, the same correction as 'min_star_linear2_i' with the constants scaled by 2^n_decimals
+template <>
+inline mipp::Reg<float> min_star_linear2_fix_i(const mipp::Reg<float> a, const mipp::Reg<float> b,
+                                               const int n_decimals)
+{
+	const auto scale = (float)(1 << n_decimals);
+	return min_star_linear2_i(a / scale, b / scale) * scale;
+}
+
+template <>
+inline mipp::Reg<double> min_star_linear2_fix_i(const mipp::Reg<double> a, const mipp::Reg<double> b,
+                                                const int n_decimals)
+{
+	const auto scale = (double)(1 << n_decimals);
+	return min_star_linear2_i(a / scale, b / scale) * scale;
+}
+
+template <typename R>
+inline mipp::Reg<R> correction_linear2_sat_i(const mipp::Reg<R> x, const int n_decimals)
+{
+	const auto three = std::min((int)std::numeric_limits<R>::max(), 3 << n_decimals);
+	return mipp::max(mipp::Reg<R>((R)0), mipp::subs(mipp::Reg<R>((R)three), x) >> 2);
+}
+
+template <>
+inline mipp::Reg<int16_t> min_star_linear2_fix_i(const mipp::Reg<int16_t> a, const mipp::Reg<int16_t> b,
+                                                 const int n_decimals)
+{
+	const auto c_sum  = correction_linear2_sat_i(mipp::adds(a, b), n_decimals);
+	const auto c_diff = correction_linear2_sat_i(mipp::subs(mipp::max(a, b), mipp::min(a, b)), n_decimals);
+	return mipp::subs(mipp::adds(mipp::min(a, b), c_sum), c_diff);
+}
+
+template <>
+inline mipp::Reg<int8_t> min_star_linear2_fix_i(const mipp::Reg<int8_t> a, const mipp::Reg<int8_t> b,
+                                                const int n_decimals)
+{
+	const auto c_sum  = correction_linear2_sat_i(mipp::adds(a, b), n_decimals);
+	const auto c_diff = correction_linear2_sat_i(mipp::subs(mipp::max(a, b), mipp::min(a, b)), n_decimals);
+	return mipp::subs(mipp::adds(mipp::min(a, b), c_sum), c_diff);
+}
+
 template <typename R>
 inline mipp::Reg<R> min_star_i(const mipp::Reg<R> a, const mipp::Reg<R> b)
 {
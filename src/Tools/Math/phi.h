@@ -0,0 +1,49 @@
+#ifndef PHI_H
+#define PHI_H
+
+#include <mipp.h>
+
+#ifndef _MSC_VER
+#ifndef __forceinline
+#define __forceinline inline __attribute__((always_inline))
+#endif
+#endif
+
+namespace aff3ct
+{
+namespace tools
+{
+// -------------------------------------------------------------------------- special function prototypes for templates
+
+template <typename R>
+using proto_phi = R (*)(const R x);
+
+template <typename R>
+using proto_phi_i = mipp::Reg<R> (*)(const mipp::Reg<R> x);
+
+// ------------------------------------------------------------------------------------------- special function headers
+
+/*
+ * phi(x) = -log(tanh(x / 2)), for x >= 0. phi is its own inverse: the magnitude of the message from a check node to a
+ * variable node in the SPA is phi(sum of phi(|x|) over the other variable nodes of the check node).
+ *
+ * - phi     is computed with the logarithm and the hyperbolic tangent, it is saturated at 'phi_max<R>()',
+ * - phi_lut is read from a table of 256 values (x quantized with a step of 1/32 on [0;8[, the mean of phi in each step),
+ * - phi_pwl is the piecewise-linear interpolation of phi at x = 2^k / 128 (k = 0...10), phi being convex this is the
+ *   max of the 10 lines (then only some multiply-add and max operations on the SIMD registers).
+ */
+template <typename R> __forceinline R phi_max();
+
+template <typename R> __forceinline R phi    (const R x);
+template <typename R> __forceinline R phi_lut(const R x);
+template <typename R> __forceinline R phi_pwl(const R x);
+
+template <typename R> __forceinline mipp::Reg<R> phi_i    (const mipp::Reg<R> x);
+template <typename R> __forceinline mipp::Reg<R> phi_lut_i(const mipp::Reg<R> x);
+template <typename R> __forceinline mipp::Reg<R> phi_pwl_i(const mipp::Reg<R> x);
+}
+}
+
+#include "phi.hxx"
+
+#endif /* PHI_H */
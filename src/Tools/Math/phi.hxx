@@ -0,0 +1,125 @@
+#include <cmath>     // log(), tanh()
+#include <algorithm> // min(), max()
+#include <array>
+
+#include "phi.h"
+
+namespace aff3ct
+{
+namespace tools
+{
+constexpr int phi_lut_size     = 256;
+constexpr int phi_lut_step_inv = 32;
+constexpr int phi_pwl_n_lines  = 10;
+
+template <typename R>
+inline const std::array<R,phi_lut_size>& phi_lut_table()
+{
+	static const std::array<R,phi_lut_size> table = []()
+	{
+		// the mean of phi over each quantization step (from 16 points of the step)
+		std::array<R,phi_lut_size> t;
+		for (auto i = 0; i < phi_lut_size; i++)
+		{
+			auto sum = 0.;
+			for (auto j = 0; j < 16; j++)
+			{
+				const auto x = ((double)i + ((double)j + 0.5) / 16.) / (double)phi_lut_step_inv;
+				sum += -std::log(std::tanh(x * 0.5));
+			}
+			t[i] = (R)(sum / 16.);
+		}
+		return t;
+	}();
+
+	return table;
+}
+
+template <typename R>
+inline const std::array<std::array<R,2>,phi_pwl_n_lines>& phi_pwl_lines()
+{
+	// the chords of phi between x = 2^k / 128 and x = 2^(k+1) / 128: {intercept, slope}
+	static const std::array<std::array<R,2>,phi_pwl_n_lines> lines = {{
+		{{(R)6.23831445e+00, (R)-8.87208860e+01}}, // [1/128;1/64]
+		{{(R)5.54513676e+00, (R)-4.43575136e+01}}, // [1/64;1/32]
+		{{(R)4.85186757e+00, (R)-2.21728995e+01}}, // [1/32;1/16]
+		{{(R)4.15823308e+00, (R)-1.10747477e+01}}, // [1/16;1/8]
+		{{(R)3.46314827e+00, (R)-5.51406921e+00}}, // [1/8;1/4]
+		{{(R)2.76243282e+00, (R)-2.71120742e+00}}, // [1/4;1/2]
+		{{(R)2.04172139e+00, (R)-1.26978456e+00}}, // [1/2;1]
+		{{(R)1.27153220e+00, (R)-4.99595364e-01}}, // [1;2]
+		{{(R)5.08047563e-01, (R)-1.17853047e-01}}, // [2;4]
+		{{(R)7.25998242e-02, (R)-8.99111237e-03}}  // [4;8]
+	}};
+
+	return lines;
+}
+
+template <typename R>
+inline R phi_max()
+{
+	return (R)16;
+}
+
+template <typename R>
+inline R phi(const R x)
+{
+	// tanh(0) = 0 gives +inf, saturated
+	return std::min((R)-std::log(std::tanh(x * (R)0.5)), phi_max<R>());
+}
+
+template <typename R>
+inline R phi_lut(const R x)
+{
+	const auto x_max = (R)((R)phi_lut_size / (R)phi_lut_step_inv);
+	const auto idx   = std::min((int)(std::min(x, x_max) * (R)phi_lut_step_inv), phi_lut_size -1);
+	return phi_lut_table<R>()[idx];
+}
+
+template <typename R>
+inline R phi_pwl(const R x)
+{
+	auto &lines = phi_pwl_lines<R>();
+
+	auto res = (R)0;
+	for (auto l = 0; l < phi_pwl_n_lines; l++)
+		res = std::max(res, (R)(lines[l][0] + lines[l][1] * x));
+
+	return res;
+}
+
+template <typename R>
+inline mipp::Reg<R> phi_i(const mipp::Reg<R> x)
+{
+	const auto zero = mipp::Reg<R>((R)0  );
+	const auto half = mipp::Reg<R>((R)0.5);
+
+	// the saturation value is the second operand: it is returned if the log gives a NaN
+	return mipp::min(zero - mipp::log(mipp::tanh(x * half)), mipp::Reg<R>(phi_max<R>()));
+}
+
+template <typename R>
+inline mipp::Reg<R> phi_lut_i(const mipp::Reg<R> x)
+{
+	// there is no gather in MIPP: the lanes are looked up one by one
+	R mem[mipp::N<R>()];
+	x.storeu(mem);
+	for (auto i = 0; i < mipp::N<R>(); i++)
+		mem[i] = phi_lut(mem[i]);
+
+	return mipp::loadu<R>(mem);
+}
+
+template <typename R>
+inline mipp::Reg<R> phi_pwl_i(const mipp::Reg<R> x)
+{
+	auto &lines = phi_pwl_lines<R>();
+
+	auto res = mipp::Reg<R>((R)0);
+	for (auto l = 0; l < phi_pwl_n_lines; l++)
+		res = mipp::max(res, mipp::Reg<R>(lines[l][0]) + mipp::Reg<R>(lines[l][1]) * x);
+
+	return res;
+}
+}
+}
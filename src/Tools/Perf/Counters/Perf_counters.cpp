@@ -0,0 +1,135 @@
+#if defined(__linux__)
+#include <cstring>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include "Perf_counters.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+#if defined(__linux__)
+namespace
+{
+struct Group
+{
+	std::array<int, Perf_counters::N_EVENTS> fds;      // file descriptors of the events (-1 if not opened)
+	std::array<int, Perf_counters::N_EVENTS> position; // position of the events in the group read (-1 if not opened)
+	int n_opened;
+
+	Group() : n_opened(0)
+	{
+		const std::array<uint32_t, Perf_counters::N_EVENTS> types =
+		{
+			PERF_TYPE_HARDWARE,
+			PERF_TYPE_HARDWARE,
+			PERF_TYPE_HW_CACHE,
+			PERF_TYPE_HARDWARE,
+			PERF_TYPE_HARDWARE
+		};
+
+		const std::array<uint64_t, Perf_counters::N_EVENTS> configs =
+		{
+			PERF_COUNT_HW_CPU_CYCLES,
+			PERF_COUNT_HW_INSTRUCTIONS,
+			PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+			PERF_COUNT_HW_CACHE_MISSES,
+			PERF_COUNT_HW_BRANCH_MISSES
+		};
+
+		fds.fill(-1);
+		position.fill(-1);
+
+		for (auto e = 0; e < Perf_counters::N_EVENTS; e++)
+		{
+			perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.type           = types[e];
+			attr.size           = sizeof(attr);
+			attr.config         = configs[e];
+			attr.disabled       = e == 0 ? 1 : 0; // the whole group is enabled with the leader
+			attr.exclude_kernel = 1;
+			attr.exclude_hv     = 1;
+			attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+			// the cycles event is the group leader, nothing can be measured without it
+			const int leader = e == 0 ? -1 : fds[0];
+			fds[e] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+			if (fds[e] == -1 && e == 0)
+				return;
+			if (fds[e] != -1)
+				position[e] = n_opened++;
+		}
+
+		ioctl(fds[0], PERF_EVENT_IOC_RESET,  PERF_IOC_FLAG_GROUP);
+		ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+
+	~Group()
+	{
+		for (auto fd : fds)
+			if (fd != -1)
+				close(fd);
+	}
+
+	bool is_open() const
+	{
+		return fds[0] != -1;
+	}
+};
+
+thread_local Group group;
+}
+#endif
+
+bool Perf_counters
+::is_available()
+{
+#if defined(__linux__)
+	return group.is_open();
+#else
+	return false;
+#endif
+}
+
+bool Perf_counters
+::read(Sample &sample)
+{
+#if defined(__linux__)
+	if (!group.is_open())
+		return false;
+
+	// format of a group read: the number of events, the enabled and running times, then the values in opening order
+	uint64_t buffer[3 + N_EVENTS];
+	if (::read(group.fds[0], buffer, sizeof(buffer)) == -1)
+		return false;
+
+	sample.time_enabled = buffer[1];
+	sample.time_running = buffer[2];
+	for (auto e = 0; e < N_EVENTS; e++)
+		sample.values[e] = group.position[e] != -1 ? buffer[3 + group.position[e]] : 0;
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool Perf_counters
+::accumulate(const Sample &start, const Sample &stop, Values &total)
+{
+	const auto enabled = stop.time_enabled - start.time_enabled;
+	const auto running = stop.time_running - start.time_running;
+	if (running == 0)
+		return false;
+
+	// the events have been counted only a part of the time when the kernel multiplexed the hardware counters
+	const auto scale = running < enabled ? (double)enabled / (double)running : 1.;
+	for (auto e = 0; e < N_EVENTS; e++)
+		total[e] += (uint64_t)((double)(stop.values[e] - start.values[e]) * scale);
+
+	return true;
+}
@@ -0,0 +1,70 @@
+/*!
+ * \file
+ * \brief Reads the hardware performance counters of the calling thread (Linux perf events).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef PERF_COUNTERS_HPP_
+#define PERF_COUNTERS_HPP_
+
+#include <array>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Perf_counters
+ *
+ * \brief Reads the hardware performance counters of the calling thread (Linux perf events).
+ *
+ * The counters are opened lazily, once per thread, as a single perf events group. When the perf events are not
+ * allowed (or not supported by the system) the counters are unavailable and the "read" method returns false. An
+ * event that is not supported by the CPU is always read as 0. When there are more events than hardware counters, the
+ * kernel multiplexes them: the counted values are then extrapolated to the enabled time by the "accumulate" method.
+ */
+class Perf_counters
+{
+public:
+	enum event : uint8_t { CYCLES = 0, INSTRUCTIONS, L1D_MISSES, LLC_MISSES, BRANCH_MISSES, N_EVENTS };
+
+	using Values = std::array<uint64_t, event::N_EVENTS>;
+
+	struct Sample
+	{
+		Values   values;
+		uint64_t time_enabled; // time during which the events have been enabled (in ns)
+		uint64_t time_running; // time during which the events have really been counted (in ns)
+	};
+
+	/*!
+	 * \brief Checks if the hardware counters can be opened on the calling thread.
+	 */
+	static bool is_available();
+
+	/*!
+	 * \brief Reads the current values of the hardware counters of the calling thread.
+	 *
+	 * \param sample: the read values and times.
+	 *
+	 * \return false if the counters are unavailable.
+	 */
+	static bool read(Sample &sample);
+
+	/*!
+	 * \brief Adds the events counted between two samples, extrapolated to the enabled time if they were multiplexed.
+	 *
+	 * \param start: the sample read before the measured code.
+	 * \param stop:  the sample read after the measured code.
+	 * \param total: the values to increment.
+	 *
+	 * \return false if the counters did not run between the two samples ('total' is unchanged).
+	 */
+	static bool accumulate(const Sample &start, const Sample &stop, Values &total);
+};
+}
+}
+
+#endif /* PERF_COUNTERS_HPP_ */
@@ -0,0 +1,123 @@
+#include <thread>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <functional>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Module.hpp"
+#include "Module/Task.hpp"
+
+#include "Tracer.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+const size_t                                 aff3ct::tools::Tracer::capacity = 1 << 16;
+std::mutex                                   aff3ct::tools::Tracer::mutex;
+std::vector<std::unique_ptr<Tracer::Buffer>> aff3ct::tools::Tracer::buffers;
+std::atomic<uint64_t>                        aff3ct::tools::Tracer::generation(0);
+thread_local Tracer::Buffer*                 aff3ct::tools::Tracer::local_buffer = nullptr;
+thread_local uint64_t                        aff3ct::tools::Tracer::local_generation = 0;
+thread_local int64_t                         aff3ct::tools::Tracer::local_tid = -1;
+
+void Tracer
+::set_thread_id(const int tid)
+{
+	Tracer::local_tid = tid;
+}
+
+Tracer::Buffer* Tracer
+::register_buffer()
+{
+	std::unique_ptr<Buffer> buffer(new Buffer());
+	buffer->events.resize(Tracer::capacity);
+	buffer->n_events = 0;
+	buffer->tid      = Tracer::local_tid >= 0 ? (uint64_t)Tracer::local_tid
+	                                          : (uint64_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+
+	std::lock_guard<std::mutex> lock(Tracer::mutex);
+	Tracer::local_buffer     = buffer.get();
+	Tracer::local_generation = Tracer::generation;
+	Tracer::buffers.push_back(std::move(buffer));
+
+	return Tracer::local_buffer;
+}
+
+void Tracer
+::dump(std::ostream &stream)
+{
+	std::lock_guard<std::mutex> lock(Tracer::mutex);
+
+	// the origin of the timeline is the first recorded event
+	auto t_origin = std::chrono::steady_clock::time_point::max();
+	for (auto &b : Tracer::buffers)
+	{
+		const auto n = std::min(b->n_events, Tracer::capacity);
+		for (size_t e = 0; e < n; e++)
+			t_origin = std::min(t_origin, b->events[e].t_start);
+	}
+
+	auto to_us = [](const std::chrono::steady_clock::duration &d)
+	{
+		return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(d).count() * 1e-3;
+	};
+
+	stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	auto first = true;
+	for (auto &buffer : Tracer::buffers)
+	{
+		auto &b = *buffer;
+		const auto n     = std::min(b.n_events, Tracer::capacity);
+		const auto begin = b.n_events - n; // the oldest event still in the ring buffer
+
+		for (size_t i = begin; i < b.n_events; i++)
+		{
+			auto &e = b.events[i % Tracer::capacity];
+
+			stream << (first ? "" : ",") << std::endl
+			       << "{\"name\":\"" << e.task->get_module().get_name() << "::" << e.task->get_name() << "\","
+			       << "\"cat\":\"" << e.task->get_module().get_name() << "\","
+			       << "\"ph\":\"X\","
+			       << "\"pid\":0,"
+			       << "\"tid\":" << b.tid << ","
+			       << "\"ts\":" << to_us(e.t_start - t_origin) << ","
+			       << "\"dur\":" << to_us(e.t_stop - e.t_start) << ","
+			       << "\"args\":{\"frame\":" << e.frame_id << "}}";
+			first = false;
+		}
+	}
+	stream << std::endl << "]}" << std::endl;
+
+	Tracer::_clear();
+}
+
+void Tracer
+::dump(const std::string &path)
+{
+	std::ofstream file(path);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the trace file ('path' = " << path << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	file << std::fixed;
+	Tracer::dump(file);
+}
+
+void Tracer
+::clear()
+{
+	std::lock_guard<std::mutex> lock(Tracer::mutex);
+	Tracer::_clear();
+}
+
+void Tracer
+::_clear()
+{
+	// the threads will register a new buffer at their next event
+	Tracer::buffers.clear();
+	Tracer::generation++;
+}
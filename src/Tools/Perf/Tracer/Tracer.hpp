@@ -0,0 +1,109 @@
+/*!
+ * \file
+ * \brief Records the execution timeline of the tasks and exports it in the Chrome trace-event format.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef TRACER_HPP_
+#define TRACER_HPP_
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <iostream>
+
+namespace aff3ct
+{
+namespace module
+{
+class Task;
+}
+namespace tools
+{
+/*!
+ * \class Tracer
+ *
+ * \brief Records the execution timeline of the tasks and exports it in the Chrome trace-event format.
+ *
+ * Each thread records its events in its own ring buffer (no lock after the first event), only the last events are
+ * kept when a buffer is full. The buffers are flushed by the "dump" method, the resulting file can be opened with
+ * chrome://tracing or Perfetto. The events of a thread are shown with the id given to "set_thread_id" (the thread
+ * number of the simulation), or with a hash of its std::thread::id if it has not been given.
+ */
+class Tracer
+{
+private:
+	struct Event
+	{
+		const module::Task*                   task;
+		uint32_t                              frame_id;
+		std::chrono::steady_clock::time_point t_start;
+		std::chrono::steady_clock::time_point t_stop;
+	};
+
+	struct Buffer
+	{
+		std::vector<Event> events;   // ring buffer
+		size_t             n_events; // total number of recorded events (may be greater than the capacity)
+		uint64_t           tid;      // id of the thread in the trace
+	};
+
+	static const size_t capacity; // number of events per thread
+
+	static std::mutex                           mutex; // protects 'buffers' (and the content of the buffers in "dump")
+	static std::vector<std::unique_ptr<Buffer>> buffers;
+	static std::atomic<uint64_t>                generation;
+
+	static thread_local Buffer*  local_buffer;
+	static thread_local uint64_t local_generation;
+	static thread_local int64_t  local_tid;
+
+public:
+	/*!
+	 * \brief Records the execution of a task on the calling thread.
+	 *
+	 * \param task:     the executed task.
+	 * \param frame_id: the number of the call of the task.
+	 * \param t_start:  date of the beginning of the execution.
+	 * \param t_stop:   date of the end of the execution.
+	 */
+	static inline void record(const module::Task &task, const uint32_t frame_id,
+	                          const std::chrono::steady_clock::time_point &t_start,
+	                          const std::chrono::steady_clock::time_point &t_stop);
+
+	/*!
+	 * \brief Sets the id of the calling thread in the trace (from its next buffer).
+	 *
+	 * \param tid: the id of the thread (the thread number of the simulation for instance).
+	 */
+	static void set_thread_id(const int tid);
+
+	/*!
+	 * \brief Writes the recorded events in the Chrome trace-event JSON format and empties the buffers.
+	 *
+	 * The buffers are locked against the registration of a new thread and against "clear", but the events are
+	 * recorded without lock: the traced threads have to be stopped.
+	 */
+	static void dump(std::ostream &stream);
+	static void dump(const std::string &path);
+
+	/*!
+	 * \brief Empties the buffers (the traced threads have to be stopped).
+	 */
+	static void clear();
+
+private:
+	static Buffer* register_buffer();
+	static void _clear();
+};
+}
+}
+
+#include "Tracer.hxx"
+
+#endif /* TRACER_HPP_ */
@@ -0,0 +1,30 @@
+#ifndef TRACER_HXX_
+#define TRACER_HXX_
+
+#include "Tracer.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+void Tracer
+::record(const module::Task &task, const uint32_t frame_id,
+         const std::chrono::steady_clock::time_point &t_start,
+         const std::chrono::steady_clock::time_point &t_stop)
+{
+	auto buffer = Tracer::local_buffer;
+	if (buffer == nullptr || Tracer::local_generation != Tracer::generation.load(std::memory_order_relaxed))
+		buffer = Tracer::register_buffer();
+
+	auto &e = buffer->events[buffer->n_events % Tracer::capacity];
+	e.task     = &task;
+	e.frame_id = frame_id;
+	e.t_start  = t_start;
+	e.t_stop   = t_stop;
+
+	buffer->n_events++;
+}
+}
+}
+
+#endif /* TRACER_HXX_ */
@@ -0,0 +1,95 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Socket.hpp"
+
+#include "Sequence.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Sequence
+::Sequence(const std::vector<module::Task*> &firsts, const std::vector<module::Task*> &exclusions)
+{
+	auto contains = [](const std::vector<module::Task*> &v, const module::Task *t)
+	{
+		return std::find(v.begin(), v.end(), t) != v.end();
+	};
+
+	// collect all the tasks reachable from the first tasks by following the bindings from producers to consumers
+	std::vector<module::Task*> reached;
+	for (auto t : firsts)
+		if (!contains(reached, t) && !contains(exclusions, t))
+			reached.push_back(t);
+
+	for (size_t i = 0; i < reached.size(); i++)
+		for (auto &s : reached[i]->sockets)
+			for (auto c : s->get_bound_sockets())
+			{
+				auto &t = c->get_task();
+				if (!contains(reached, &t) && !contains(exclusions, &t))
+					reached.push_back(&t);
+			}
+
+	// order the tasks: a task is ready when all its producers (among the reached tasks) are done
+	std::vector<module::Task*> ordered;
+	while (ordered.size() < reached.size())
+	{
+		auto n_ordered = ordered.size();
+		for (auto t : reached)
+		{
+			if (contains(ordered, t))
+				continue;
+
+			auto ready = true;
+			for (auto &s : t->sockets)
+			{
+				auto p = s->get_bound_socket();
+				if (p != nullptr && &p->get_task() != t && contains(reached, &p->get_task()) &&
+				    !contains(ordered, &p->get_task()))
+				{
+					ready = false;
+					break;
+				}
+			}
+
+			if (ready)
+				ordered.push_back(t);
+		}
+
+		if (ordered.size() == n_ordered)
+		{
+			std::stringstream message;
+			message << "The socket bindings contain a cycle, the tasks cannot be ordered ('reached.size()' = "
+			        << reached.size() << ", 'ordered.size()' = " << ordered.size() << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	for (auto t : ordered)
+		if (!Sequence::is_pass_through(*t))
+			this->tasks.push_back(t);
+}
+
+void Sequence
+::exec()
+{
+	for (auto t : this->tasks)
+		t->exec();
+}
+
+const std::vector<module::Task*>& Sequence
+::get_tasks() const
+{
+	return this->tasks;
+}
+
+bool Sequence
+::is_pass_through(const module::Task &task)
+{
+	for (auto &s : task.sockets)
+		if (task.get_socket_type(*s) == module::socket_t::SOUT && s->get_bound_socket() != nullptr)
+			return true;
+	return false;
+}
@@ -0,0 +1,57 @@
+/*!
+ * \file
+ * \brief Executes a pre-computed list of tasks deduced from the socket bindings.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SEQUENCE_HPP_
+#define SEQUENCE_HPP_
+
+#include <vector>
+
+#include "Module/Task.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Sequence
+ *
+ * \brief Executes a pre-computed list of tasks deduced from the socket bindings.
+ *
+ * The socket bindings are walked once from the first tasks. The tasks are ordered so that each task runs after the
+ * tasks it depends on. The tasks with a bound output socket (the "NO" modules) are skipped because their outputs are
+ * already forwarded to the upstream data.
+ */
+class Sequence
+{
+protected:
+	std::vector<module::Task*> tasks; // the tasks to execute, in order
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param firsts:     the tasks from which the socket bindings are walked.
+	 * \param exclusions: the tasks that are not executed (the bindings are not walked through them).
+	 */
+	explicit Sequence(const std::vector<module::Task*> &firsts,
+	                  const std::vector<module::Task*> &exclusions = {});
+
+	virtual ~Sequence() = default;
+
+	/*!
+	 * \brief Executes all the tasks in order.
+	 */
+	void exec();
+
+	const std::vector<module::Task*>& get_tasks() const;
+
+	static bool is_pass_through(const module::Task &task);
+};
+}
+}
+
+#endif /* SEQUENCE_HPP_ */
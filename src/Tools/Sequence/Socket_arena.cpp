@@ -0,0 +1,122 @@
+#include <limits>
+#include <algorithm>
+
+#include "Module/Socket.hpp"
+
+#include "Socket_arena.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+struct Slot
+{
+	module::Socket* socket;
+	size_t          n_bytes;
+	size_t          first;  // index of the producer task
+	size_t          last;   // index of the last consumer task
+	size_t          offset; // position in the arena
+};
+
+// extend the lifetime of a buffer to its consumers, the aliases of the buffer (the "NO" modules and the in-place
+// sockets) forward the data to their own consumers
+void visit_consumers(const module::Socket &s, const std::vector<module::Task*> &tasks, Slot &slot)
+{
+	for (auto c : s.get_bound_sockets())
+	{
+		auto &task = c->get_task();
+		auto it = std::find(tasks.begin(), tasks.end(), &task);
+		auto idx = (size_t)std::distance(tasks.begin(), it);
+
+		if (it == tasks.end() || idx <= slot.first)
+		{
+			slot.first = 0;
+			slot.last  = std::numeric_limits<size_t>::max();
+		}
+		else
+			slot.last = std::max(slot.last, idx);
+
+		if (task.get_socket_type(*c) != module::socket_t::SIN)
+			visit_consumers(*c, tasks, slot);
+	}
+}
+}
+
+Socket_arena
+::Socket_arena(const std::vector<module::Task*> &tasks)
+: n_sockets(0), n_bytes_unshared(0)
+{
+	std::vector<Slot> slots;
+	for (size_t t = 0; t < tasks.size(); t++)
+		for (auto &s : tasks[t]->sockets)
+			if (tasks[t]->get_socket_type(*s) == module::socket_t::SOUT && s->get_bound_socket() == nullptr &&
+			    s->get_databytes() != 0)
+			{
+				Slot slot = {s.get(), Socket_arena::align(s->get_databytes()), t, t, 0};
+				visit_consumers(*s, tasks, slot);
+
+				// the data of a persistent socket are written once (not at each execution of its task), they are
+				// never shared
+				if (s->is_persistent())
+				{
+					slot.first = 0;
+					slot.last  = std::numeric_limits<size_t>::max();
+				}
+
+				slots.push_back(slot);
+			}
+
+	// first fit: each buffer takes the lowest offset that does not overlap a buffer alive at the same time
+	size_t n_bytes = 0;
+	for (size_t i = 0; i < slots.size(); i++)
+	{
+		auto &cur = slots[i];
+
+		std::vector<const Slot*> alive;
+		for (size_t j = 0; j < i; j++)
+			if (slots[j].first <= cur.last && cur.first <= slots[j].last)
+				alive.push_back(&slots[j]);
+		std::sort(alive.begin(), alive.end(), [](const Slot *a, const Slot *b) { return a->offset < b->offset; });
+
+		cur.offset = 0;
+		for (auto a : alive)
+			if (cur.offset + cur.n_bytes > a->offset && a->offset + a->n_bytes > cur.offset)
+				cur.offset = a->offset + a->n_bytes;
+
+		n_bytes = std::max(n_bytes, cur.offset + cur.n_bytes);
+		this->n_bytes_unshared += cur.n_bytes;
+	}
+
+	this->arena.resize(n_bytes);
+	for (auto &slot : slots)
+		slot.socket->get_task().relocate_out_buffer(*slot.socket, (void*)(this->arena.data() + slot.offset));
+
+	this->n_sockets = slots.size();
+}
+
+size_t Socket_arena
+::get_n_sockets() const
+{
+	return this->n_sockets;
+}
+
+size_t Socket_arena
+::get_n_bytes() const
+{
+	return this->arena.size();
+}
+
+size_t Socket_arena
+::get_n_bytes_unshared() const
+{
+	return this->n_bytes_unshared;
+}
+
+size_t Socket_arena
+::align(const size_t n_bytes)
+{
+	// each buffer starts on a new cache line (and respects the SIMD alignment)
+	const size_t line = 64;
+	return ((n_bytes + line -1) / line) * line;
+}
@@ -0,0 +1,62 @@
+/*!
+ * \file
+ * \brief Allocates the output sockets of a list of tasks in a single contiguous memory space.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SOCKET_ARENA_HPP_
+#define SOCKET_ARENA_HPP_
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <mipp.h>
+
+#include "Module/Task.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Socket_arena
+ *
+ * \brief Allocates the output sockets of a list of tasks in a single contiguous memory space.
+ *
+ * The output buffers are laid out in the execution order of the tasks. The lifetime of a buffer goes from the task
+ * that produces it to the last task that consumes it: two buffers with disjoint lifetimes share the same memory.
+ * A buffer consumed by a task outside the list (or by a task executed before its producer) is kept for the whole
+ * execution of the list, as the buffer of a persistent socket (its data are not rewritten at each execution of its
+ * task).
+ */
+class Socket_arena
+{
+protected:
+	mipp::vector<uint8_t> arena;
+	size_t                n_sockets;
+	size_t                n_bytes_unshared; // the memory footprint without sharing
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * Moves the output sockets of the tasks in the arena, the sockets bound to them follow the data.
+	 *
+	 * \param tasks: the tasks in their execution order (ex: the tasks of a Sequence).
+	 */
+	explicit Socket_arena(const std::vector<module::Task*> &tasks);
+
+	virtual ~Socket_arena() = default;
+
+	size_t get_n_sockets       () const;
+	size_t get_n_bytes         () const;
+	size_t get_n_bytes_unshared() const;
+
+private:
+	static size_t align(const size_t n_bytes);
+};
+}
+}
+
+#endif /* SOCKET_ARENA_HPP_ */
@@ -0,0 +1,84 @@
+/*!
+ * \file
+ * \brief Bounded multi-producer multi-consumer lock-free queue.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef BOUNDED_QUEUE_HPP
+#define BOUNDED_QUEUE_HPP
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Bounded_queue
+ *
+ * \brief Bounded multi-producer multi-consumer lock-free queue (each cell has its own sequence number, the producers
+ *        and the consumers only compete on one atomic counter).
+ */
+template <typename T>
+class Bounded_queue
+{
+private:
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		T                   data;
+	};
+
+	const size_t      mask;
+	std::vector<Cell> buffer;
+
+	// the counters are padded to be on separate cache lines (the producers and the consumers do not share them)
+	char                pad0[64];
+	std::atomic<size_t> pos_push;
+	char                pad1[64 - sizeof(std::atomic<size_t>)];
+	std::atomic<size_t> pos_pop;
+	char                pad2[64 - sizeof(std::atomic<size_t>)];
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param capacity: maximum number of elements in the queue (rounded up to the next power of two).
+	 */
+	explicit Bounded_queue(const size_t capacity);
+
+	virtual ~Bounded_queue() = default;
+
+	size_t get_capacity() const;
+
+	/*!
+	 * \brief Push an element in the queue (non-blocking).
+	 *
+	 * \return false if the queue is full.
+	 */
+	bool try_push(const T &data);
+
+	/*!
+	 * \brief Pop an element from the queue (non-blocking).
+	 *
+	 * \return false if the queue is empty.
+	 */
+	bool try_pop(T &data);
+
+	/*!
+	 * \brief Empty the queue, this method is not thread-safe.
+	 */
+	void clear();
+
+private:
+	static size_t next_power_of_two(const size_t val);
+};
+}
+}
+
+#include "Bounded_queue.hxx"
+
+#endif /* BOUNDED_QUEUE_HPP */
@@ -0,0 +1,113 @@
+#ifndef BOUNDED_QUEUE_HXX_
+#define BOUNDED_QUEUE_HXX_
+
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Bounded_queue.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename T>
+Bounded_queue<T>
+::Bounded_queue(const size_t capacity)
+: mask(next_power_of_two(capacity) -1), buffer(mask +1), pos_push(0), pos_pop(0)
+{
+	if (capacity == 0)
+	{
+		std::stringstream message;
+		message << "'capacity' has to be greater than 0.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->clear();
+}
+
+template <typename T>
+size_t Bounded_queue<T>
+::get_capacity() const
+{
+	return this->buffer.size();
+}
+
+template <typename T>
+bool Bounded_queue<T>
+::try_push(const T &data)
+{
+	auto pos = this->pos_push.load(std::memory_order_relaxed);
+	while (true)
+	{
+		auto &cell = this->buffer[pos & this->mask];
+		auto seq = cell.sequence.load(std::memory_order_acquire);
+		auto dif = (std::ptrdiff_t)seq - (std::ptrdiff_t)pos;
+
+		if (dif == 0)
+		{
+			if (this->pos_push.compare_exchange_weak(pos, pos +1, std::memory_order_relaxed))
+			{
+				cell.data = data;
+				cell.sequence.store(pos +1, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (dif < 0)
+			return false; // the queue is full
+		else
+			pos = this->pos_push.load(std::memory_order_relaxed);
+	}
+}
+
+template <typename T>
+bool Bounded_queue<T>
+::try_pop(T &data)
+{
+	auto pos = this->pos_pop.load(std::memory_order_relaxed);
+	while (true)
+	{
+		auto &cell = this->buffer[pos & this->mask];
+		auto seq = cell.sequence.load(std::memory_order_acquire);
+		auto dif = (std::ptrdiff_t)seq - (std::ptrdiff_t)(pos +1);
+
+		if (dif == 0)
+		{
+			if (this->pos_pop.compare_exchange_weak(pos, pos +1, std::memory_order_relaxed))
+			{
+				data = cell.data;
+				cell.sequence.store(pos + this->mask +1, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (dif < 0)
+			return false; // the queue is empty
+		else
+			pos = this->pos_pop.load(std::memory_order_relaxed);
+	}
+}
+
+template <typename T>
+void Bounded_queue<T>
+::clear()
+{
+	for (size_t i = 0; i < this->buffer.size(); i++)
+		this->buffer[i].sequence.store(i, std::memory_order_relaxed);
+
+	this->pos_push.store(0, std::memory_order_relaxed);
+	this->pos_pop .store(0, std::memory_order_relaxed);
+}
+
+template <typename T>
+size_t Bounded_queue<T>
+::next_power_of_two(const size_t val)
+{
+	size_t p = 1;
+	while (p < val)
+		p <<= 1;
+	return p;
+}
+}
+}
+
+#endif /* BOUNDED_QUEUE_HXX_ */
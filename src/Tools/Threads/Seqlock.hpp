@@ -0,0 +1,60 @@
+/*!
+ * \file
+ * \brief Single-writer multi-reader sequence lock.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SEQLOCK_HPP
+#define SEQLOCK_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Seqlock
+ *
+ * \brief Single-writer multi-reader sequence lock: the writer never waits and the readers get a consistent snapshot
+ *        of the value without taking any lock (they retry if a store happened during the read).
+ *
+ * T has to be copyable with 'memcpy' (a structure of counters for instance). The value is stored in atomic words so
+ * that a concurrent read is not a data race.
+ */
+template <typename T>
+class Seqlock
+{
+private:
+	static constexpr size_t n_words = (sizeof(T) + sizeof(uint64_t) -1) / sizeof(uint64_t);
+
+	// the value is padded to be on its own cache lines (the readers do not invalidate the neighbour objects)
+	char                  pad0[64];
+	std::atomic<uint32_t> sequence; // odd while a store is in progress
+	std::atomic<uint64_t> words[n_words];
+	char                  pad1[64];
+
+public:
+	explicit Seqlock(const T &val = T());
+
+	virtual ~Seqlock() = default;
+
+	/*!
+	 * \brief Publish a new value, only one thread at a time can call this method.
+	 */
+	void store(const T &val);
+
+	/*!
+	 * \brief Get the last published value, this method can be called from any thread.
+	 */
+	T load() const;
+};
+}
+}
+
+#include "Seqlock.hxx"
+
+#endif /* SEQLOCK_HPP */
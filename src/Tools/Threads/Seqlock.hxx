@@ -0,0 +1,62 @@
+#ifndef SEQLOCK_HXX_
+#define SEQLOCK_HXX_
+
+#include <cstring>
+
+#include "Seqlock.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename T>
+Seqlock<T>
+::Seqlock(const T &val)
+: sequence(0)
+{
+	this->store(val);
+}
+
+template <typename T>
+void Seqlock<T>
+::store(const T &val)
+{
+	uint64_t buffer[n_words] = {};
+	std::memcpy((void*)buffer, (const void*)&val, sizeof(T));
+
+	const auto seq = this->sequence.load(std::memory_order_relaxed);
+	this->sequence.store(seq +1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	for (size_t w = 0; w < n_words; w++)
+		this->words[w].store(buffer[w], std::memory_order_relaxed);
+
+	this->sequence.store(seq +2, std::memory_order_release);
+}
+
+template <typename T>
+T Seqlock<T>
+::load() const
+{
+	uint64_t buffer[n_words];
+	uint32_t seq0, seq1;
+	do
+	{
+		seq0 = this->sequence.load(std::memory_order_acquire);
+
+		for (size_t w = 0; w < n_words; w++)
+			buffer[w] = this->words[w].load(std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		seq1 = this->sequence.load(std::memory_order_relaxed);
+	}
+	while ((seq0 & 1) || seq0 != seq1);
+
+	T val;
+	std::memcpy((void*)&val, (const void*)buffer, sizeof(T));
+	return val;
+}
+}
+}
+
+#endif /* SEQLOCK_HXX_ */
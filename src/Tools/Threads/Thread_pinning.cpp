@@ -0,0 +1,204 @@
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <map>
+#include <thread>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Thread_pinning.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+// read an integer from a file of the sysfs, returns -1 if the file does not exist
+int read_sysfs_int(const std::string &path)
+{
+	std::ifstream file(path);
+	int val = -1;
+	if (file.is_open())
+		file >> val;
+	return val;
+}
+}
+
+Thread_pinning
+::Thread_pinning(const std::string &policy, const int n_threads)
+: policy(policy), initial_cores(Thread_pinning::get_online_cores())
+{
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<int> cores;
+	if (policy == "compact" || policy == "scatter")
+	{
+		// group the logical cores per socket, the sibling hyper-threads are put at the end of each group
+		std::map<int, std::vector<std::pair<int,int>>> sockets; // socket id -> (sibling rank, core)
+		std::map<std::pair<int,int>, int> n_siblings; // (socket id, physical core id) -> number of seen siblings
+
+		for (auto c : this->initial_cores)
+		{
+			const std::string topo = "/sys/devices/system/cpu/cpu" + std::to_string(c) + "/topology/";
+			const auto socket_id = std::max(0, read_sysfs_int(topo + "physical_package_id"));
+			const auto core_id   =             read_sysfs_int(topo + "core_id");
+
+			const auto sibling_rank = core_id == -1 ? 0 : n_siblings[std::make_pair(socket_id, core_id)]++;
+			sockets[socket_id].push_back(std::make_pair(sibling_rank, c));
+		}
+
+		for (auto &s : sockets)
+			std::stable_sort(s.second.begin(), s.second.end(),
+			                 [](const std::pair<int,int> &a, const std::pair<int,int> &b) { return a.first < b.first; });
+
+		if (policy == "compact")
+		{
+			for (auto &s : sockets)
+				for (auto &c : s.second)
+					cores.push_back(c.second);
+		}
+		else // scatter
+		{
+			size_t max_size = 0;
+			for (auto &s : sockets)
+				max_size = std::max(max_size, s.second.size());
+
+			for (size_t i = 0; i < max_size; i++)
+				for (auto &s : sockets)
+					if (i < s.second.size())
+						cores.push_back(s.second[i].second);
+		}
+	}
+	else
+		cores = Thread_pinning::parse_core_list(policy);
+
+	if (cores.empty())
+	{
+		std::stringstream message;
+		message << "No logical core has been found for the pinning policy ('policy' = " << policy << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto tid = 0; tid < n_threads; tid++)
+		this->mapping.push_back(cores[tid % cores.size()]);
+}
+
+bool Thread_pinning
+::pin(const int tid) const
+{
+#if defined(__linux__)
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	CPU_SET(this->mapping[tid % this->mapping.size()], &cpuset);
+
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) == 0;
+#else
+	return false;
+#endif
+}
+
+bool Thread_pinning
+::unpin() const
+{
+#if defined(__linux__)
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	for (auto c : this->initial_cores)
+		if (c < CPU_SETSIZE)
+			CPU_SET(c, &cpuset);
+
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) == 0;
+#else
+	return false;
+#endif
+}
+
+const std::vector<int>& Thread_pinning
+::get_mapping() const
+{
+	return this->mapping;
+}
+
+std::string Thread_pinning
+::get_policy() const
+{
+	return this->policy;
+}
+
+std::vector<int> Thread_pinning
+::parse_core_list(const std::string &list)
+{
+	std::vector<int> cores;
+
+	const auto n_cpus = (int)std::thread::hardware_concurrency(); // 0 if unknown
+
+	std::stringstream ss(list);
+	std::string item;
+	while (std::getline(ss, item, ','))
+	{
+		int first, last;
+		char dash;
+		std::stringstream ssi(item);
+		if (!(ssi >> first))
+		{
+			std::stringstream message;
+			message << "Wrong list of logical cores ('list' = " << list << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (ssi >> dash)
+		{
+			if (dash != '-' || !(ssi >> last) || last < first)
+			{
+				std::stringstream message;
+				message << "Wrong list of logical cores ('list' = " << list << ").";
+				throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+		}
+		else
+			last = first;
+
+		if (first < 0 || (n_cpus > 0 && last >= n_cpus))
+		{
+			std::stringstream message;
+			message << "The logical cores have to be between 0 and the number of CPUs minus 1 ('list' = " << list
+			        << ", 'n_cpus' = " << n_cpus << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		for (auto c = first; c <= last; c++)
+			cores.push_back(c);
+	}
+
+	return cores;
+}
+
+std::vector<int> Thread_pinning
+::get_online_cores()
+{
+	std::vector<int> cores;
+#if defined(__linux__)
+	// only the cores allowed for the process are considered (ex: taskset, cgroups)
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuset) == 0)
+		for (auto c = 0; c < CPU_SETSIZE; c++)
+			if (CPU_ISSET(c, &cpuset))
+				cores.push_back(c);
+#endif
+	if (cores.empty())
+		for (unsigned c = 0; c < std::thread::hardware_concurrency(); c++)
+			cores.push_back((int)c);
+
+	return cores;
+}
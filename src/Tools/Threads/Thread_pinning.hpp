@@ -0,0 +1,78 @@
+/*!
+ * \file
+ * \brief Pins the simulation threads on the logical cores of the machine.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef THREAD_PINNING_HPP
+#define THREAD_PINNING_HPP
+
+#include <string>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Thread_pinning
+ *
+ * \brief Pins the simulation threads on the logical cores of the machine.
+ *
+ * Three policies are available:
+ * - "compact": the threads fill the physical cores of a socket, then its hyper-threads, before to use the next socket,
+ * - "scatter": the threads are distributed in round-robin on the sockets,
+ * - an explicit list of logical cores (ex: "0,2,4-7"), the thread "tid" is pinned on the "tid"-th core of the list.
+ * When there are more threads than cores, the mapping wraps around.
+ */
+class Thread_pinning
+{
+private:
+	const std::string policy;
+	std::vector<int>  mapping;       // logical core of each thread
+	std::vector<int>  initial_cores; // logical cores allowed for the constructing thread before the pinning
+
+public:
+	/*!
+	 * \brief Constructor, the affinity of the calling thread is saved to be restored by 'unpin'.
+	 *
+	 * \param policy:    "compact", "scatter" or an explicit list of logical cores.
+	 * \param n_threads: number of threads to pin.
+	 */
+	Thread_pinning(const std::string &policy, const int n_threads);
+
+	virtual ~Thread_pinning() = default;
+
+	/*!
+	 * \brief Pins the calling thread on the core of the thread "tid".
+	 *
+	 * \return false if the pinning is not supported or failed.
+	 */
+	bool pin(const int tid) const;
+
+	/*!
+	 * \brief Restores on the calling thread the affinity of the thread that constructed this object.
+	 *
+	 * \return false if the pinning is not supported or failed.
+	 */
+	bool unpin() const;
+
+	const std::vector<int>& get_mapping() const;
+
+	std::string get_policy() const;
+
+	/*!
+	 * \brief Parses a list of logical cores (ex: "0,2,4-7").
+	 *
+	 * Throws if a core id is negative or not lower than the number of CPUs.
+	 */
+	static std::vector<int> parse_core_list(const std::string &list);
+
+private:
+	static std::vector<int> get_online_cores();
+};
+}
+}
+
+#endif /* THREAD_PINNING_HPP */
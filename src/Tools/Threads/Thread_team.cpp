@@ -0,0 +1,145 @@
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Thread_team.hpp"
+
+using namespace aff3ct::tools;
+
+Thread_team
+::Thread_team(const size_t n_threads)
+: n_threads(n_threads), task(nullptr), task_id(0), n_running(0), stop(false), aborted(false), n_arrived(0),
+  generation(0)
+{
+	if (n_threads == 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (size_t tid = 1; tid < n_threads; tid++)
+		this->workers.push_back(std::thread(&Thread_team::worker, this, tid));
+}
+
+Thread_team
+::~Thread_team()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mtx);
+		this->stop = true;
+	}
+	this->cnd_start.notify_all();
+
+	for (auto &w : this->workers)
+		w.join();
+}
+
+size_t Thread_team
+::get_n_threads() const
+{
+	return this->n_threads;
+}
+
+void Thread_team
+::run(const std::function<void(const size_t tid)> &task)
+{
+	if (this->n_threads == 1)
+	{
+		task(0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(this->mtx);
+		this->task      = &task;
+		this->n_running = this->n_threads -1;
+		this->exception = nullptr;
+		this->task_id++;
+
+		// an aborted task may have left threads counted in the barrier
+		this->aborted   = false;
+		this->n_arrived = 0;
+	}
+	this->cnd_start.notify_all();
+
+	this->execute(0);
+
+	std::unique_lock<std::mutex> lock(this->mtx);
+	this->cnd_done.wait(lock, [this]() { return this->n_running == 0; });
+	this->task = nullptr;
+
+	if (this->exception != nullptr)
+		std::rethrow_exception(this->exception);
+}
+
+void Thread_team
+::execute(const size_t tid)
+{
+	try
+	{
+		(*this->task)(tid);
+	}
+	catch (const Aborted&)
+	{
+		// another thread threw the exception that aborted the task
+	}
+	catch (...)
+	{
+		this->aborted.store(true, std::memory_order_release);
+
+		std::lock_guard<std::mutex> lock(this->mtx);
+		if (this->exception == nullptr)
+			this->exception = std::current_exception();
+	}
+}
+
+void Thread_team
+::barrier()
+{
+	const auto gen = this->generation.load(std::memory_order_acquire);
+
+	if (this->aborted.load(std::memory_order_acquire))
+		throw Aborted();
+
+	if (this->n_arrived.fetch_add(1, std::memory_order_acq_rel) == this->n_threads -1)
+	{
+		// the last thread releases the others
+		this->n_arrived.store(0, std::memory_order_relaxed);
+		this->generation.fetch_add(1, std::memory_order_release);
+	}
+	else
+	{
+		// spin for a while before to give the core to the other threads (over-subscription)
+		for (auto i = 0; this->generation.load(std::memory_order_acquire) == gen; i++)
+		{
+			if (this->aborted.load(std::memory_order_acquire))
+				throw Aborted();
+			if (i >= 1024)
+				std::this_thread::yield();
+		}
+	}
+}
+
+void Thread_team
+::worker(const size_t tid)
+{
+	size_t last_task_id = 0;
+
+	std::unique_lock<std::mutex> lock(this->mtx);
+	while (true)
+	{
+		this->cnd_start.wait(lock, [&]() { return this->stop || this->task_id != last_task_id; });
+		if (this->stop)
+			return;
+
+		last_task_id = this->task_id;
+		lock.unlock();
+
+		this->execute(tid);
+
+		lock.lock();
+		if (--this->n_running == 0)
+			this->cnd_done.notify_one();
+	}
+}
@@ -0,0 +1,107 @@
+/*!
+ * \file
+ * \brief Team of threads that cooperate on the same task (ex: the decoding of a single frame).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef THREAD_TEAM_HPP
+#define THREAD_TEAM_HPP
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Thread_team
+ *
+ * \brief Team of threads that cooperate on the same task (ex: the decoding of a single frame).
+ *
+ * The threads are created once in the constructor and sleep between two tasks. The thread that calls the "run" method
+ * is a member of the team (tid = 0). Inside a task, the threads synchronize with the "barrier" method, it spins
+ * instead of sleeping because the phases of a task are short. When a thread throws an exception, the team is aborted:
+ * the other threads leave the task at their next barrier and "run" rethrows the first exception.
+ */
+class Thread_team
+{
+private:
+	const size_t             n_threads;
+	std::vector<std::thread> workers;
+
+	std::mutex              mtx;
+	std::condition_variable cnd_start;
+	std::condition_variable cnd_done;
+	const std::function<void(const size_t)> *task;
+	size_t                  task_id;
+	size_t                  n_running;
+	bool                    stop;
+	std::exception_ptr      exception; // the first exception thrown by a thread during the current task
+	std::atomic<bool>       aborted;   // set when a thread throws, the barriers then release the waiting threads
+
+	// the barrier counters are padded to be on their own cache lines (all the threads write them)
+	char                pad0[64];
+	std::atomic<size_t> n_arrived;
+	char                pad1[64 - sizeof(std::atomic<size_t>)];
+	std::atomic<size_t> generation;
+	char                pad2[64 - sizeof(std::atomic<size_t>)];
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param n_threads: number of threads in the team (including the calling thread).
+	 */
+	explicit Thread_team(const size_t n_threads);
+
+	virtual ~Thread_team();
+
+	size_t get_n_threads() const;
+
+	/*!
+	 * \brief Execute the task on all the threads of the team and wait until they are done.
+	 *
+	 * \param task: the function executed by each thread, its parameter is the thread id (in [0;n_threads[).
+	 */
+	void run(const std::function<void(const size_t tid)> &task);
+
+	/*!
+	 * \brief Blocking method, wait until all the threads of the team call this method (only inside a task).
+	 *
+	 * If another thread of the team threw an exception, the task is aborted: this method throws instead of waiting for
+	 * a thread that will never arrive.
+	 */
+	void barrier();
+
+	/*!
+	 * \brief Split the items [0;n_items[ in n_parts contiguous ranges of the same weight.
+	 *
+	 * \param n_items: number of items.
+	 * \param n_parts: number of ranges.
+	 * \param offset:  the accumulated weight of the items before the item 'i' (offset(n_items) is the total weight).
+	 *
+	 * \return the n_parts +1 boundaries of the ranges, the part 'p' is [ranges[p];ranges[p +1][.
+	 */
+	template <class F>
+	static std::vector<size_t> split(const size_t n_items, const size_t n_parts, F offset);
+
+private:
+	struct Aborted {}; // thrown by the barrier of an aborted task, it is not reported by "run"
+
+	void worker(const size_t tid);
+	void execute(const size_t tid);
+};
+}
+}
+
+#include "Thread_team.hxx"
+
+#endif /* THREAD_TEAM_HPP */
@@ -0,0 +1,37 @@
+#ifndef THREAD_TEAM_HXX_
+#define THREAD_TEAM_HXX_
+
+#include "Thread_team.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <class F>
+std::vector<size_t> Thread_team
+::split(const size_t n_items, const size_t n_parts, F offset)
+{
+	std::vector<size_t> ranges(n_parts +1, n_items);
+	ranges[0] = 0;
+
+	const auto total = (size_t)offset(n_items);
+	for (size_t p = 1; p < n_parts; p++)
+	{
+		// first item whose offset reaches the p-th fraction of the total weight
+		const auto target = (total * p) / n_parts;
+		auto lo = ranges[p -1], hi = n_items;
+		while (lo < hi)
+		{
+			const auto mid = (lo + hi) / 2;
+			if ((size_t)offset(mid) < target) lo = mid +1;
+			else                              hi = mid;
+		}
+		ranges[p] = lo;
+	}
+
+	return ranges;
+}
+}
+}
+
+#endif /* THREAD_TEAM_HXX_ */